@@ -15,3 +15,5 @@ CREATE TABLE IF NOT EXISTS calls(
 );
 -- calls.contactId should not be used.
 -- calls.name should not be used.
+
+CREATE INDEX IF NOT EXISTS calls_index_on_date ON calls (date);
@@ -59,14 +59,31 @@ CREATE TABLE IF NOT EXISTS contact_name
 
 CREATE TABLE IF NOT EXISTS contact_number
 (
-    _id         INTEGER PRIMARY KEY,
-    contact_id  INTEGER,
-    number_user TEXT NOT NULL,
-    number_e164 TEXT NOT NULL,
-    type        INTEGER,
+    _id           INTEGER PRIMARY KEY,
+    contact_id    INTEGER,
+    number_user   TEXT NOT NULL,
+    number_e164   TEXT NOT NULL,
+    type          INTEGER,
+    number_suffix TEXT,
     FOREIGN KEY (contact_id) REFERENCES contacts (_id)
 );
 
+CREATE TABLE IF NOT EXISTS contact_name_keys
+(
+    key     TEXT    NOT NULL,
+    name_id INTEGER NOT NULL,
+    PRIMARY KEY (key, name_id),
+    FOREIGN KEY (name_id) REFERENCES contact_name (_id)
+) WITHOUT ROWID;
+
+CREATE TABLE IF NOT EXISTS contact_number_grams
+(
+    gram      TEXT    NOT NULL,
+    number_id INTEGER NOT NULL,
+    PRIMARY KEY (gram, number_id),
+    FOREIGN KEY (number_id) REFERENCES contact_number (_id)
+) WITHOUT ROWID;
+
 CREATE TABLE IF NOT EXISTS contact_ringtones
 (
     _id        INTEGER PRIMARY KEY,
@@ -79,4 +96,12 @@ CREATE INDEX IF NOT EXISTS contact_match_group_index_on_group
     ON contact_match_groups (group_id);
 CREATE INDEX IF NOT EXISTS contact_match_group_index_on_contact
     ON contact_match_groups (contact_id);
+CREATE INDEX IF NOT EXISTS contact_number_index_on_suffix
+    ON contact_number (number_suffix);
+CREATE INDEX IF NOT EXISTS contact_name_index_on_contact
+    ON contact_name (contact_id);
+CREATE INDEX IF NOT EXISTS contact_name_keys_index_on_name
+    ON contact_name_keys (name_id);
+CREATE INDEX IF NOT EXISTS contact_number_grams_index_on_number
+    ON contact_number_grams (number_id);
 
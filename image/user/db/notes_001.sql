@@ -6,3 +6,9 @@ CREATE TABLE IF NOT EXISTS notes(
     date INTEGER,
     snippet TEXT DEFAULT ''
 );
+
+CREATE VIRTUAL TABLE IF NOT EXISTS notes_search USING fts5(snippet, content='notes', content_rowid='_id');
+
+CREATE TRIGGER IF NOT EXISTS on_note_insert_search AFTER INSERT ON notes BEGIN INSERT INTO notes_search(rowid, snippet) VALUES (new._id, new.snippet); END;
+CREATE TRIGGER IF NOT EXISTS on_note_remove_search AFTER DELETE ON notes BEGIN INSERT INTO notes_search(notes_search, rowid, snippet) VALUES ('delete', old._id, old.snippet); END;
+CREATE TRIGGER IF NOT EXISTS on_note_update_search AFTER UPDATE OF snippet ON notes BEGIN INSERT INTO notes_search(notes_search, rowid, snippet) VALUES ('delete', old._id, old.snippet); INSERT INTO notes_search(rowid, snippet) VALUES (new._id, new.snippet); END;
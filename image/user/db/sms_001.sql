@@ -14,6 +14,12 @@ CREATE TABLE IF NOT EXISTS sms
 );
 -- sms.contact_id should not be used.
 
+CREATE VIRTUAL TABLE IF NOT EXISTS sms_search USING fts5(body, content='sms', content_rowid='_id');
+
+CREATE TRIGGER IF NOT EXISTS on_sms_insert_search AFTER INSERT ON sms BEGIN INSERT INTO sms_search(rowid, body) VALUES (new._id, new.body); END;
+CREATE TRIGGER IF NOT EXISTS on_sms_remove_search AFTER DELETE ON sms BEGIN INSERT INTO sms_search(sms_search, rowid, body) VALUES ('delete', old._id, old.body); END;
+CREATE TRIGGER IF NOT EXISTS on_sms_update_search AFTER UPDATE OF body ON sms BEGIN INSERT INTO sms_search(sms_search, rowid, body) VALUES ('delete', old._id, old.body); INSERT INTO sms_search(rowid, body) VALUES (new._id, new.body); END;
+
 CREATE TABLE IF NOT EXISTS templates
 (
     _id                INTEGER PRIMARY KEY,
@@ -34,6 +40,8 @@ CREATE TABLE IF NOT EXISTS threads
 );
 -- threads.contact_id should not be used.
 
+CREATE INDEX IF NOT EXISTS threads_index_on_date ON threads (date);
+
 CREATE TABLE IF NOT EXISTS threads_count
 (
     _id   INTEGER PRIMARY KEY,
@@ -25,25 +25,36 @@ unsigned int CalllogModel::requestRecordsCount()
 
 void CalllogModel::requestRecords(uint32_t offset, uint32_t limit)
 {
-    auto query = std::make_unique<db::query::CalllogGet>(limit, offset);
+    auto query = std::make_unique<db::query::CalllogGet>(limit, offset, pageAnchors.find(offset, limit));
     auto task  = app::AsyncQuery::createFromQuery(std::move(query), db::Interface::Name::Calllog);
-    task->setCallback([this](auto response) {
+    task->setCallback([this, offset](auto response) {
         auto result = dynamic_cast<db::query::CalllogGetResult *>(response);
         if (result == nullptr) {
             return false;
         }
-        return onCalllogRetrieved(result->getRecords(), result->getTotalCount());
+        return onCalllogRetrieved(result->getRecords(), result->getTotalCount(), offset);
     });
     task->execute(application, this);
 }
 
-bool CalllogModel::onCalllogRetrieved(const std::vector<CalllogRecord> &records, unsigned int repoCount)
+bool CalllogModel::onCalllogRetrieved(const std::vector<CalllogRecord> &records,
+                                      unsigned int repoCount,
+                                      uint32_t offset)
 {
     if (recordsCount != repoCount) {
         recordsCount = repoCount;
+        pageAnchors.clear();
         list->reSendLastRebuildRequest();
         return false;
     }
+
+    std::vector<db::PageAnchor> keys;
+    keys.reserve(records.size());
+    for (const auto &record : records) {
+        keys.push_back({static_cast<std::uint64_t>(record.date), record.ID});
+    }
+    pageAnchors.store(offset, std::move(keys));
+
     return updateRecords(records);
 }
 
@@ -9,6 +9,7 @@
 #include "CalllogRecord.hpp"
 #include "Application.hpp"
 #include "ListItemProvider.hpp"
+#include <module-db/Common/PageAnchor.hpp>
 
 class CalllogModel : public app::DatabaseModel<CalllogRecord>,
                      public gui::ListItemProvider,
@@ -25,5 +26,7 @@ class CalllogModel : public app::DatabaseModel<CalllogRecord>,
     [[nodiscard]] gui::ListItem *getItem(gui::Order order) override;
 
   private:
-    bool onCalllogRetrieved(const std::vector<CalllogRecord> &records, unsigned int repoCount);
+    bool onCalllogRetrieved(const std::vector<CalllogRecord> &records, unsigned int repoCount, uint32_t offset);
+
+    db::PageAnchors pageAnchors;
 };
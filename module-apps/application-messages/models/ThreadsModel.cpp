@@ -63,7 +63,7 @@ auto ThreadsModel::getItem(gui::Order order) -> gui::ListItem *
 
 void ThreadsModel::requestRecords(uint32_t offset, uint32_t limit)
 {
-    auto query = std::make_unique<db::query::ThreadsGetForList>(offset, limit);
+    auto query = std::make_unique<db::query::ThreadsGetForList>(offset, limit, pageAnchors.find(offset, limit));
     auto task  = app::AsyncQuery::createFromQuery(std::move(query), db::Interface::Name::SMSThread);
     task->setCallback([this](auto response) { return handleQueryResponse(response); });
     task->execute(getApplication(), this);
@@ -77,6 +77,7 @@ auto ThreadsModel::handleQueryResponse(db::QueryResult *queryResult) -> bool
     // If list record count has changed we need to rebuild list.
     if (recordsCount != (msgResponse->getCount())) {
         recordsCount = msgResponse->getCount();
+        pageAnchors.clear();
         list->reSendLastRebuildRequest();
         return false;
     }
@@ -85,6 +86,16 @@ auto ThreadsModel::handleQueryResponse(db::QueryResult *queryResult) -> bool
     auto contacts = msgResponse->getContacts();
     auto numbers  = msgResponse->getNumbers();
 
+    if (const auto request = std::dynamic_pointer_cast<db::query::ThreadsGetForList>(msgResponse->getRequestQuery());
+        request != nullptr) {
+        std::vector<db::PageAnchor> keys;
+        keys.reserve(threads.size());
+        for (const auto &thread : threads) {
+            keys.push_back({thread.date, thread.ID});
+        }
+        pageAnchors.store(request->offset, std::move(keys));
+    }
+
     std::vector<ThreadListStruct> records;
 
     assert(threads.size() == contacts.size() && threads.size() == numbers.size());
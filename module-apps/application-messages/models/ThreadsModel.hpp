@@ -5,6 +5,7 @@
 
 #include <module-db/Interface/ContactRecord.hpp>
 #include "BaseThreadsRecordModel.hpp"
+#include <module-db/Common/PageAnchor.hpp>
 
 class ThreadsModel : public BaseThreadsRecordModel, public app::AsyncCallbackReceiver
 {
@@ -16,4 +17,7 @@ class ThreadsModel : public BaseThreadsRecordModel, public app::AsyncCallbackRec
     [[nodiscard]] auto getItem(gui::Order order) -> gui::ListItem * override;
 
     auto handleQueryResponse(db::QueryResult *queryResult) -> bool;
+
+  private:
+    db::PageAnchors pageAnchors;
 };
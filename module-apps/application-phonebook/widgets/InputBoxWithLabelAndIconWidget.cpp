@@ -170,7 +170,7 @@ namespace gui
 
         onSaveCallback = [&](std::shared_ptr<ContactRecord> contact) { contact->addToFavourites(tickImage->visible); };
         onLoadCallback = [&](std::shared_ptr<ContactRecord> contact) {
-            tickImage->visible = contact->isOnFavourites();
+            tickImage->setVisible(contact->isOnFavourites());
         };
     }
     void InputBoxWithLabelAndIconWidget::addToICEHandler()
@@ -213,7 +213,7 @@ namespace gui
             return false;
         };
         onSaveCallback = [&](std::shared_ptr<ContactRecord> contact) { contact->addToIce(tickImage->visible); };
-        onLoadCallback = [&](std::shared_ptr<ContactRecord> contact) { tickImage->visible = contact->isOnIce(); };
+        onLoadCallback = [&](std::shared_ptr<ContactRecord> contact) { tickImage->setVisible(contact->isOnIce()); };
     }
 
 } /* namespace gui */
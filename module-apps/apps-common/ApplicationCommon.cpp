@@ -27,6 +27,7 @@
 #include <service-appmgr/messages/UserPowerDownRequest.hpp>
 #include <service-appmgr/data/NotificationsChangedActionsParams.hpp>
 #include "service-gui/messages/DrawMessage.hpp" // for DrawMessage
+#include <Service/MessagePool.hpp>
 #include "task.h"                               // for xTaskGetTic...
 #include "windows/AppWindow.hpp"                // for AppWindow
 #include "DOMResponder.hpp"
@@ -197,6 +198,9 @@ namespace app
         LOG_DEBUG("[%s] (%s) -> (%s)", GetName().c_str(), stateStr(state), stateStr(st));
 #endif
         state = st;
+        if (state != State::ACTIVE_FORGROUND) {
+            lastRenderedWindow = nullptr;
+        }
     }
 
     void ApplicationCommon::longPressTimerCallback()
@@ -233,7 +237,12 @@ namespace app
             auto window = getCurrentWindow();
             updateStatuses(window);
 
-            auto message = std::make_shared<service::gui::DrawMessage>(window->buildDrawList(), mode);
+            auto message       = sys::makePooledMessage<service::gui::DrawMessage>(window->buildDrawList(), mode);
+            const auto changed = window->takeDirtyArea();
+            if (window == lastRenderedWindow) {
+                message->dirtyArea = changed;
+            }
+            lastRenderedWindow = window;
 
             if (systemCloseInProgress) {
                 message->setCommandType(service::gui::DrawMessage::Type::SHUTDOWN);
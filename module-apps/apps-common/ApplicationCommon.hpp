@@ -185,6 +185,8 @@ namespace app
       private:
         std::string default_window;
         State state = State::DEACTIVATED;
+        /// Window drawn with the previous render, only its changes are redrawn when it is rendered again
+        gui::AppWindow *lastRenderedWindow = nullptr;
 
         sys::MessagePointer handleSignalStrengthUpdate(sys::Message *msgl);
         sys::MessagePointer handleNetworkAccessTechnologyUpdate(sys::Message *msgl);
@@ -15,7 +15,7 @@ namespace gui
     {
         buildInterface();
 
-        preBuildDrawListHook = [this](std::list<Command> &cmd) { updateTime(); };
+        preBuildDrawListHook = [this](DrawCommandList &cmd) { updateTime(); };
     }
 
     void PhoneLockedWindow::buildInterface()
@@ -151,7 +151,7 @@ EinkStatus_e EinkUpdateFrame(
     for (uint32_t h = 0; h < H; ++h) {
         memcpy(shared_buffer + offset_eink, buffer + offset_buffer, W);
         offset_eink += BOARD_EINK_DISPLAY_RES_X;
-        offset_buffer += W;
+        offset_buffer += BOARD_EINK_DISPLAY_RES_X;
     }
 
     shared_header->frameCount++;
@@ -1309,7 +1309,7 @@ __attribute__((optimize("O1"))) static uint8_t *s_EinkTransformFrameCoordinateSy
     int32_t inputRow   = 0;
     int32_t inputCol   = 0;
 
-    for (inputRow = 0; inputRow < windowHeightPx - 1; ++inputRow) {
+    for (inputRow = 0; inputRow < windowHeightPx; ++inputRow) {
         for (inputCol = windowWidthPx - 7; inputCol >= 0; inputCol -= pixelsInByte) {
             // HACK: Did not create the loop for accessing pixels and merging them in the single byte for better
             // performance.
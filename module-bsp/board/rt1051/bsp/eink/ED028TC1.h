@@ -369,7 +369,8 @@ extern "C"
      * @param Y [in] - image start position Y in pixels
      * @param W [in] - image width in pixels
      * @param H [in] - image height in pixels
-     * @param buffer [in] -  pointer to image encoded according to \ref bpp set in initialization
+     * @param buffer [in] -  pointer to the top left pixel of the image encoded according to \ref bpp set in
+     * initialization. Rows of the image are BOARD_EINK_DISPLAY_RES_X pixels apart.
      * @param bpp [in] - The format of the \ref buffer (number of the bits per pixel)
      * @param invertColors[in] - true if colors of the image are to be inverted, false otherwise
      *
@@ -0,0 +1,50 @@
+// Copyright (c) 2017-2021, Mudita Sp. z.o.o. All rights reserved.
+// For licensing, see https://github.com/mudita/MuditaOS/LICENSE.md
+
+#include "FullTextSearch.hpp"
+
+#include <Database/Database.hpp>
+
+#include <cctype>
+
+namespace db
+{
+    std::string fullTextQuery(const std::string &text)
+    {
+        std::string query;
+        std::string word;
+
+        auto appendWord = [&query, &word]() {
+            if (word.empty()) {
+                return;
+            }
+            if (!query.empty()) {
+                query += ' ';
+            }
+            // Every word is a quoted prefix phrase, so no character of the text is taken as query syntax
+            query += '"' + word + "\"*";
+            word.clear();
+        };
+
+        for (const auto c : text) {
+            if (std::isspace(static_cast<unsigned char>(c))) {
+                appendWord();
+            }
+            else if (c == '"') {
+                word += "\"\"";
+            }
+            else {
+                word += c;
+            }
+        }
+        appendWord();
+        // An empty query is a syntax error for fts5, an empty phrase is not
+        return query.empty() ? "\"\"" : query;
+    }
+
+    bool hasFullTextTable(Database *db, const char *table)
+    {
+        auto statement = db->prepare("SELECT COUNT(*) FROM sqlite_master WHERE type = 'table' AND name = ?;", table);
+        return statement.step() && statement.getUInt32(0) > 0;
+    }
+} // namespace db
@@ -0,0 +1,18 @@
+// Copyright (c) 2017-2021, Mudita Sp. z.o.o. All rights reserved.
+// For licensing, see https://github.com/mudita/MuditaOS/LICENSE.md
+
+#pragma once
+
+#include <string>
+
+class Database;
+
+namespace db
+{
+    /// Builds a full-text search query matching texts with words starting with each of the words of the text.
+    /// If there is no word to search for, the query matches nothing.
+    std::string fullTextQuery(const std::string &text);
+
+    /// Checks if the full-text search table exists, databases created by older versions get one on open
+    bool hasFullTextTable(Database *db, const char *table);
+} // namespace db
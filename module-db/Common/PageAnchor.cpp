@@ -0,0 +1,45 @@
+// Copyright (c) 2017-2021, Mudita Sp. z.o.o. All rights reserved.
+// For licensing, see https://github.com/mudita/MuditaOS/LICENSE.md
+
+#include "PageAnchor.hpp"
+
+#include <utility>
+
+namespace db
+{
+    void PageAnchors::store(std::uint32_t pageOffset, std::vector<PageAnchor> pageKeys)
+    {
+        offset = pageOffset;
+        keys   = std::move(pageKeys);
+    }
+
+    void PageAnchors::clear()
+    {
+        offset = 0;
+        keys.clear();
+    }
+
+    std::optional<PageAnchor> PageAnchors::find(std::uint32_t requestedOffset, std::uint32_t limit) const
+    {
+        if (keys.empty() || limit == 0) {
+            return std::nullopt;
+        }
+
+        // Page starts inside or right after the stored one - continue after the row preceding it
+        if (requestedOffset > offset && requestedOffset <= offset + keys.size()) {
+            auto anchor      = keys[requestedOffset - offset - 1];
+            anchor.direction = PageAnchor::Direction::After;
+            return anchor;
+        }
+
+        // Page ends inside or right before the stored one - read backwards from the row following it
+        const auto end = requestedOffset + limit;
+        if (requestedOffset < offset && end >= offset && end < offset + keys.size()) {
+            auto anchor      = keys[end - offset];
+            anchor.direction = PageAnchor::Direction::Before;
+            return anchor;
+        }
+
+        return std::nullopt;
+    }
+} // namespace db
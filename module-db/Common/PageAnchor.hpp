@@ -0,0 +1,43 @@
+// Copyright (c) 2017-2021, Mudita Sp. z.o.o. All rights reserved.
+// For licensing, see https://github.com/mudita/MuditaOS/LICENSE.md
+
+#pragma once
+
+#include <cstdint>
+#include <optional>
+#include <vector>
+
+namespace db
+{
+    /// Position in a list sorted by date and id, newest first. Used for keyset pagination: a page is read with an
+    /// index seek right after (or right before) a row already known to the list instead of skipping `offset` rows,
+    /// so the cost of a page does not depend on how deep the list is scrolled.
+    struct PageAnchor
+    {
+        enum class Direction
+        {
+            After, ///< rows following the anchor row, in list order
+            Before ///< rows preceding the anchor row, still returned in list order
+        };
+
+        std::uint64_t date  = 0;
+        std::uint32_t id    = 0;
+        Direction direction = Direction::After;
+    };
+
+    /// Keeps keys of the rows of the last page delivered to a list model, to turn requests for overlapping or
+    /// adjacent pages into keyset queries. Requests for other offsets (jumps) fall back to plain offset queries.
+    class PageAnchors
+    {
+      public:
+        void store(std::uint32_t pageOffset, std::vector<PageAnchor> pageKeys);
+        void clear();
+
+        /// Anchor to read `limit` rows starting at `offset`, if the page touches the stored one
+        [[nodiscard]] std::optional<PageAnchor> find(std::uint32_t offset, std::uint32_t limit) const;
+
+      private:
+        std::uint32_t offset = 0;
+        std::vector<PageAnchor> keys;
+    };
+} // namespace db
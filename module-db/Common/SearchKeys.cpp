@@ -0,0 +1,130 @@
+// Copyright (c) 2017-2021, Mudita Sp. z.o.o. All rights reserved.
+// For licensing, see https://github.com/mudita/MuditaOS/LICENSE.md
+
+#include "SearchKeys.hpp"
+
+#include <algorithm>
+#include <cctype>
+#include <cstdint>
+
+namespace
+{
+    constexpr std::uint32_t latin1First    = 0x00C0;
+    constexpr std::uint32_t latinExtALast  = 0x017F;
+    constexpr std::uint32_t cyrillicFirst  = 0x0400;
+    constexpr std::uint32_t cyrillicIeLast = 0x040F;
+    constexpr std::uint32_t cyrillicALast  = 0x042F;
+
+    /// Base letters of U+00C0..U+017F (Latin-1 Supplement letters and Latin Extended-A), '-' marks no folding
+    constexpr char latinBaseLetters[] = "aaaaaaaceeeeiiiidnooooo-ouuuuyts"
+                                        "aaaaaaaceeeeiiiidnooooo-ouuuuyty"
+                                        "aaaaaaccccccccddddeeeeeeeeeegggg"
+                                        "gggghhhhiiiiiiiiiiiijjkkklllllll"
+                                        "lllnnnnnnnnnoooooooorrrrrrssssss"
+                                        "ssttttttuuuuuuuuuuuuwwyyyzzzzzzs";
+    static_assert(sizeof(latinBaseLetters) - 1 == latinExtALast - latin1First + 1);
+
+    std::uint32_t foldCode(std::uint32_t code)
+    {
+        if (code >= latin1First && code <= latinExtALast) {
+            const auto base = latinBaseLetters[code - latin1First];
+            return base != '-' ? static_cast<std::uint32_t>(base) : code;
+        }
+        if (code >= cyrillicFirst && code <= cyrillicIeLast) {
+            return code + 0x50;
+        }
+        if (code > cyrillicIeLast && code <= cyrillicALast) {
+            return code + 0x20;
+        }
+        return code;
+    }
+
+    bool isLeadOf2Bytes(unsigned char c)
+    {
+        return (c & 0xE0) == 0xC0;
+    }
+
+    bool isContinuation(unsigned char c)
+    {
+        return (c & 0xC0) == 0x80;
+    }
+
+    bool isSeparator(unsigned char c)
+    {
+        return c < 0x80 && !std::isalnum(c);
+    }
+} // namespace
+
+namespace db
+{
+    std::string foldText(const std::string &text)
+    {
+        std::string folded;
+        folded.reserve(text.size());
+
+        for (std::size_t i = 0; i < text.size(); i++) {
+            const auto c = static_cast<unsigned char>(text[i]);
+            if (c < 0x80) {
+                folded.push_back(static_cast<char>(std::tolower(c)));
+            }
+            // All the folded letters are encoded on two bytes, longer sequences are copied byte by byte
+            else if (isLeadOf2Bytes(c) && i + 1 < text.size() && isContinuation(text[i + 1])) {
+                const auto code   = ((c & 0x1Fu) << 6) | (static_cast<unsigned char>(text[i + 1]) & 0x3Fu);
+                const auto base = foldCode(code);
+                if (base < 0x80) {
+                    folded.push_back(static_cast<char>(base));
+                }
+                else {
+                    folded.push_back(static_cast<char>(0xC0 | (base >> 6)));
+                    folded.push_back(static_cast<char>(0x80 | (base & 0x3F)));
+                }
+                i++;
+            }
+            else {
+                folded.push_back(text[i]);
+            }
+        }
+        return folded;
+    }
+
+    std::vector<std::string> searchKeys(const std::string &text)
+    {
+        std::vector<std::string> keys;
+        const auto folded = foldText(text);
+
+        auto begin = folded.begin();
+        while (begin != folded.end()) {
+            begin    = std::find_if_not(begin, folded.end(), [](char c) { return isSeparator(c); });
+            auto end = std::find_if(begin, folded.end(), [](char c) { return isSeparator(c); });
+            if (begin != end) {
+                std::string key{begin, end};
+                if (std::find(keys.begin(), keys.end(), key) == keys.end()) {
+                    keys.push_back(std::move(key));
+                }
+            }
+            begin = end;
+        }
+        return keys;
+    }
+
+    bool matchesKeys(const std::vector<std::string> &keys, const std::vector<std::string> &prefixes)
+    {
+        return std::all_of(prefixes.begin(), prefixes.end(), [&keys](const std::string &prefix) {
+            return std::any_of(keys.begin(), keys.end(), [&prefix](const std::string &key) {
+                return key.compare(0, prefix.size(), prefix) == 0;
+            });
+        });
+    }
+
+    std::string prefixUpperBound(std::string prefix)
+    {
+        // Bytes of 0xFF can't be incremented, those are never part of a valid UTF-8 text anyway
+        while (!prefix.empty() && static_cast<unsigned char>(prefix.back()) == 0xFF) {
+            prefix.pop_back();
+        }
+        if (!prefix.empty()) {
+            prefix.back() = static_cast<char>(static_cast<unsigned char>(prefix.back()) + 1);
+        }
+        return prefix;
+    }
+} // namespace db
@@ -0,0 +1,25 @@
+// Copyright (c) 2017-2021, Mudita Sp. z.o.o. All rights reserved.
+// For licensing, see https://github.com/mudita/MuditaOS/LICENSE.md
+
+#pragma once
+
+#include <string>
+#include <vector>
+
+namespace db
+{
+    /// Folds the text for searching: letters are lower-cased and latin letters lose their diacritics, so that
+    /// e.g. "Łukasz", "łukasz" and "lukasz" give the same key. Characters without a folded form are kept as they are.
+    std::string foldText(const std::string &text);
+
+    /// Splits the folded text into distinct words, in order of appearance. Names are indexed by these words and
+    /// searched by prefixes of them.
+    std::vector<std::string> searchKeys(const std::string &text);
+
+    /// Checks if each of the prefixes is the beginning of some of the keys
+    bool matchesKeys(const std::vector<std::string> &keys, const std::vector<std::string> &prefixes);
+
+    /// Returns the smallest string greater than all strings starting with the prefix (in binary collation),
+    /// so a prefix search is the index range [prefix, prefixUpperBound(prefix)).
+    std::string prefixUpperBound(std::string prefix);
+} // namespace db
@@ -127,6 +127,7 @@ void Database::clearQueryStatementBuffer()
 
 Database::~Database()
 {
+    finalizeStatements();
     sqlite3_free(queryStatementBuffer);
     sqlite3_close(dbConnection);
 }
@@ -190,6 +191,45 @@ std::unique_ptr<QueryResult> Database::query(const char *format, ...)
     return queryResult;
 }
 
+Statement Database::getStatement(const char *sql)
+{
+    if (sql == nullptr) {
+        return {};
+    }
+
+    const auto cached = statements.find(std::string_view{sql});
+    if (cached != statements.end() && !cached->second.inUse) {
+        cached->second.inUse = true;
+        return Statement{cached->second.statement, &cached->second.inUse};
+    }
+
+    sqlite3_stmt *statement = nullptr;
+    if (const int result = sqlite3_prepare_v2(dbConnection, sql, -1, &statement, nullptr); result != SQLITE_OK) {
+        LOG_ERROR("SQL statement preparation failed with %d", result);
+        sqlite3_finalize(statement);
+        return {};
+    }
+
+    // Statement already in use (e.g. nested iteration) or cache full - give away a one-shot statement
+    if (cached != statements.end() || statements.size() >= maxCachedStatements) {
+        return Statement{statement, nullptr};
+    }
+
+    auto &entry = statements.emplace(sql, CachedStatement{statement, true}).first->second;
+    return Statement{entry.statement, &entry.inUse};
+}
+
+void Database::finalizeStatements()
+{
+    for (auto &[sql, entry] : statements) {
+        if (entry.inUse) {
+            LOG_ERROR("Statement still in use while closing database: %s", sql.c_str());
+        }
+        sqlite3_finalize(entry.statement);
+    }
+    statements.clear();
+}
+
 int Database::queryCallback(void *usrPtr, int count, char **data, char **columns)
 {
     QueryResult *db = reinterpret_cast<QueryResult *>(usrPtr);
@@ -214,6 +254,11 @@ uint32_t Database::getLastInsertRowId()
     return sqlite3_last_insert_rowid(dbConnection);
 }
 
+uint32_t Database::getTotalChanges()
+{
+    return sqlite3_total_changes(dbConnection);
+}
+
 auto Database::pragmaQueryForValue(const std::string &pragmaStatement, const std::int32_t value) -> bool
 {
     auto results = query(pragmaStatement.c_str());
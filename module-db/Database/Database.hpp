@@ -5,10 +5,14 @@
 
 #include "sqlite3.h"
 #include "QueryResult.hpp"
+#include "Statement.hpp"
 
 #include <memory>
 #include <stdexcept>
 #include <filesystem>
+#include <map>
+#include <string>
+#include <string_view>
 
 class DatabaseInitializer;
 
@@ -28,6 +32,17 @@ class Database
 
     bool execute(const char *format, ...);
 
+    /// Returns a prepared statement for the given SQL with all arguments bound as its parameters.
+    /// Statements are cached by their SQL text, so the text should be constant and values passed as parameters.
+    template <typename... Args> Statement prepare(const char *sql, const Args &...args)
+    {
+        auto statement = getStatement(sql);
+        if (statement && !statement.bindAll(args...)) {
+            return {};
+        }
+        return statement;
+    }
+
     // Must be invoked prior creating any database object in order to initialize database OS layer
     static bool initialize();
 
@@ -37,6 +52,8 @@ class Database
     bool storeIntoFile(const std::filesystem::path &backupPath);
 
     uint32_t getLastInsertRowId();
+    /// Number of rows changed through the connection since it was opened, a cheap way to tell if cached data is stale
+    uint32_t getTotalChanges();
     void pragmaQuery(const std::string &pragmaStatement);
 
     auto pragmaQueryForValue(const std::string &pragmaStatement, const std::int32_t value) -> bool;
@@ -52,8 +69,18 @@ class Database
     }
 
   private:
-    static constexpr auto InitScriptExtension  = "sql";
-    static constexpr std::uint32_t maxQueryLen = (8 * 1024);
+    static constexpr auto InitScriptExtension        = "sql";
+    static constexpr std::uint32_t maxQueryLen       = (8 * 1024);
+    static constexpr std::size_t maxCachedStatements = 32;
+
+    struct CachedStatement
+    {
+        sqlite3_stmt *statement = nullptr;
+        bool inUse              = false;
+    };
+
+    Statement getStatement(const char *sql);
+    void finalizeStatements();
 
     void initQueryStatementBuffer();
     void clearQueryStatementBuffer();
@@ -76,4 +103,6 @@ class Database
     char *queryStatementBuffer;
     bool isInitialized_;
     std::unique_ptr<DatabaseInitializer> initializer;
+    /// Cached statements by their SQL, looked up with the SQL text as is, without building a key string
+    std::map<std::string, CachedStatement, std::less<>> statements;
 };
@@ -0,0 +1,150 @@
+// Copyright (c) 2017-2021, Mudita Sp. z.o.o. All rights reserved.
+// For licensing, see https://github.com/mudita/MuditaOS/LICENSE.md
+
+#include "Statement.hpp"
+
+#include <log/log.hpp>
+
+#include <utility>
+
+Statement::Statement(sqlite3_stmt *statement, bool *inUse) : statement{statement}, inUse{inUse}
+{}
+
+Statement::Statement(Statement &&other) noexcept
+    : statement{std::exchange(other.statement, nullptr)}, inUse{std::exchange(other.inUse, nullptr)}
+{}
+
+Statement &Statement::operator=(Statement &&other) noexcept
+{
+    if (this != &other) {
+        release();
+        statement = std::exchange(other.statement, nullptr);
+        inUse     = std::exchange(other.inUse, nullptr);
+    }
+    return *this;
+}
+
+Statement::~Statement()
+{
+    release();
+}
+
+void Statement::release()
+{
+    if (statement == nullptr) {
+        return;
+    }
+    if (inUse != nullptr) {
+        sqlite3_reset(statement);
+        sqlite3_clear_bindings(statement);
+        *inUse = false;
+    }
+    else {
+        sqlite3_finalize(statement);
+    }
+    statement = nullptr;
+    inUse     = nullptr;
+}
+
+bool Statement::bind(int index, std::int64_t value)
+{
+    return sqlite3_bind_int64(statement, index, value) == SQLITE_OK;
+}
+
+bool Statement::bind(int index, double value)
+{
+    return sqlite3_bind_double(statement, index, value) == SQLITE_OK;
+}
+
+bool Statement::bind(int index, std::string_view value)
+{
+    return sqlite3_bind_text(statement, index, value.data(), static_cast<int>(value.size()), SQLITE_TRANSIENT) ==
+           SQLITE_OK;
+}
+
+bool Statement::bind(int index, std::nullptr_t)
+{
+    return sqlite3_bind_null(statement, index) == SQLITE_OK;
+}
+
+bool Statement::step()
+{
+    if (statement == nullptr) {
+        return false;
+    }
+    switch (const auto result = sqlite3_step(statement); result) {
+    case SQLITE_ROW:
+        return true;
+    case SQLITE_DONE:
+        return false;
+    default:
+        LOG_ERROR("SQL statement step failed with %d", result);
+        return false;
+    }
+}
+
+bool Statement::execute()
+{
+    if (statement == nullptr) {
+        return false;
+    }
+    int result;
+    do {
+        result = sqlite3_step(statement);
+    } while (result == SQLITE_ROW);
+
+    if (result != SQLITE_DONE) {
+        LOG_ERROR("Execution of statement failed with %d", result);
+        return false;
+    }
+    return true;
+}
+
+int Statement::getColumnCount() const
+{
+    return sqlite3_column_count(statement);
+}
+
+bool Statement::isNull(int column) const
+{
+    return sqlite3_column_type(statement, column) == SQLITE_NULL;
+}
+
+std::int32_t Statement::getInt32(int column) const
+{
+    return sqlite3_column_int(statement, column);
+}
+
+std::uint32_t Statement::getUInt32(int column) const
+{
+    return static_cast<std::uint32_t>(sqlite3_column_int64(statement, column));
+}
+
+std::int64_t Statement::getInt64(int column) const
+{
+    return sqlite3_column_int64(statement, column);
+}
+
+std::uint64_t Statement::getUInt64(int column) const
+{
+    return static_cast<std::uint64_t>(sqlite3_column_int64(statement, column));
+}
+
+double Statement::getDouble(int column) const
+{
+    return sqlite3_column_double(statement, column);
+}
+
+std::string Statement::getString(int column) const
+{
+    return std::string{getStringView(column)};
+}
+
+std::string_view Statement::getStringView(int column) const
+{
+    const auto text = reinterpret_cast<const char *>(sqlite3_column_text(statement, column));
+    if (text == nullptr) {
+        return {};
+    }
+    return std::string_view{text, static_cast<std::size_t>(sqlite3_column_bytes(statement, column))};
+}
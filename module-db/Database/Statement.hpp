@@ -0,0 +1,90 @@
+// Copyright (c) 2017-2021, Mudita Sp. z.o.o. All rights reserved.
+// For licensing, see https://github.com/mudita/MuditaOS/LICENSE.md
+
+#pragma once
+
+#include "sqlite3.h"
+
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <type_traits>
+
+/// Prepared sqlite statement with positional parameters and typed access to the columns of the current row.
+/// Statements are obtained from Database::prepare and go back to the statement cache of the database
+/// (reset, with bindings cleared) when destroyed, so they must not outlive the database they come from.
+class Statement
+{
+  public:
+    Statement() = default;
+    Statement(const Statement &) = delete;
+    Statement &operator=(const Statement &) = delete;
+    Statement(Statement &&other) noexcept;
+    Statement &operator=(Statement &&other) noexcept;
+    ~Statement();
+
+    [[nodiscard]] bool isValid() const noexcept
+    {
+        return statement != nullptr;
+    }
+
+    explicit operator bool() const noexcept
+    {
+        return isValid();
+    }
+
+    /// Parameters are indexed from 1 as in sqlite
+    bool bind(int index, std::int64_t value);
+    bool bind(int index, double value);
+    bool bind(int index, std::string_view value);
+    bool bind(int index, std::nullptr_t);
+
+    template <typename T, std::enable_if_t<std::is_integral_v<T>, int> = 0> bool bind(int index, T value)
+    {
+        return bind(index, static_cast<std::int64_t>(value));
+    }
+
+    bool bind(int index, const char *value)
+    {
+        return value != nullptr ? bind(index, std::string_view{value}) : bind(index, nullptr);
+    }
+
+    bool bind(int index, const std::string &value)
+    {
+        return bind(index, std::string_view{value});
+    }
+
+    /// Binds all arguments in order, starting from the first parameter
+    template <typename... Args> bool bindAll(const Args &...args)
+    {
+        [[maybe_unused]] int index = 0;
+        return (bind(++index, args) && ...);
+    }
+
+    /// Moves to the next row of the result, returns false when there are no more rows or on error
+    bool step();
+
+    /// Runs the statement to completion, ignoring any rows it returns
+    bool execute();
+
+    [[nodiscard]] int getColumnCount() const;
+    [[nodiscard]] bool isNull(int column) const;
+    [[nodiscard]] std::int32_t getInt32(int column) const;
+    [[nodiscard]] std::uint32_t getUInt32(int column) const;
+    [[nodiscard]] std::int64_t getInt64(int column) const;
+    [[nodiscard]] std::uint64_t getUInt64(int column) const;
+    [[nodiscard]] double getDouble(int column) const;
+    [[nodiscard]] std::string getString(int column) const;
+    /// Valid only until the next step of the statement
+    [[nodiscard]] std::string_view getStringView(int column) const;
+
+  private:
+    friend class Database;
+
+    Statement(sqlite3_stmt *statement, bool *inUse);
+    void release();
+
+    sqlite3_stmt *statement = nullptr;
+    /// Flag of the statement cache entry, nullptr for statements which are not cached
+    bool *inUse = nullptr;
+};
@@ -3,5 +3,11 @@
 
 #include "CalllogDB.hpp"
 
+#include <log/log.hpp>
+
 CalllogDB::CalllogDB(const char *name) : Database(name), calls(this)
-{}
+{
+    if (!calls.updateDateIndex()) {
+        LOG_ERROR("Unable to update calls date index");
+    }
+}
@@ -3,6 +3,8 @@
 
 #include "ContactsDB.hpp"
 
+#include <log/log.hpp>
+
 uint32_t ContactsDB::favouritesId = 0;
 uint32_t ContactsDB::iceId        = 0;
 uint32_t ContactsDB::blockedId    = 0;
@@ -24,4 +26,14 @@ ContactsDB::ContactsDB(const char *name)
     if (temporaryId == 0) {
         temporaryId = groups.temporaryId();
     }
+
+    if (!number.updateNumberSuffixes()) {
+        LOG_ERROR("Unable to update contact numbers suffixes");
+    }
+    if (!number.updateNumberGrams()) {
+        LOG_ERROR("Unable to update contact numbers n-grams");
+    }
+    if (!this->name.updateSearchKeys()) {
+        LOG_ERROR("Unable to update contact names search keys");
+    }
 }
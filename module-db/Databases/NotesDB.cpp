@@ -3,5 +3,11 @@
 
 #include "NotesDB.hpp"
 
+#include <log/log.hpp>
+
 NotesDB::NotesDB(const char *name) : Database(name), notes(this)
-{}
+{
+    if (!notes.updateSearchIndex()) {
+        LOG_ERROR("Unable to update notes full-text index");
+    }
+}
@@ -3,5 +3,14 @@
 
 #include "SmsDB.hpp"
 
+#include <log/log.hpp>
+
 SmsDB::SmsDB(const char *name) : Database(name), sms(this), threads(this), templates(this)
-{}
+{
+    if (!threads.updateDateIndex()) {
+        LOG_ERROR("Unable to update threads date index");
+    }
+    if (!sms.updateSearchIndex()) {
+        LOG_ERROR("Unable to update messages full-text index");
+    }
+}
@@ -254,7 +254,9 @@ std::unique_ptr<db::QueryResult> CalllogRecordInterface::runQuery(std::shared_pt
 std::unique_ptr<db::QueryResult> CalllogRecordInterface::getQuery(std::shared_ptr<db::Query> query)
 {
     auto getQuery = static_cast<db::query::CalllogGet *>(query.get());
-    auto records  = calllogDB->calls.getLimitOffset(getQuery->getOffset(), getQuery->getLimit());
+    auto records  = getQuery->getAnchor().has_value()
+                        ? calllogDB->calls.getByAnchor(*getQuery->getAnchor(), getQuery->getLimit())
+                        : calllogDB->calls.getLimitOffset(getQuery->getOffset(), getQuery->getLimit());
     std::vector<CalllogRecord> recordVector;
 
     for (auto calllog : records) {
@@ -1159,8 +1159,17 @@ auto ContactRecordInterface::buildNumberMatcher(unsigned int maxPageSize)
 {
     return utils::NumberHolderMatcher<std::vector, ContactNumberHolder>(
         [this](const utils::PhoneNumber &number, auto offset, auto limit) {
-            auto numbers = !number.get().empty() ? contactDB->number.getLimitOffset(number.get(), offset, limit)
-                                                 : contactDB->number.getLimitOffset(offset, limit);
+            std::vector<ContactsNumberTableRow> numbers;
+            if (number.get().empty()) {
+                numbers = contactDB->number.getLimitOffset(offset, limit);
+            }
+            else if (ContactsNumberTable::numberSuffix(number.get()).empty()) {
+                numbers = contactDB->number.getLimitOffset(number.get(), offset, limit);
+            }
+            else if (offset == 0) {
+                // All candidates sharing the trailing digits come in the first page
+                numbers = contactDB->number.getByNumberSuffix(number.get());
+            }
 
             std::vector<ContactNumberHolder> contactNumberHolders;
             contactNumberHolders.reserve(numbers.size());
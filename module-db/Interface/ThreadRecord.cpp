@@ -233,7 +233,9 @@ std::unique_ptr<db::QueryResult> ThreadRecordInterface::threadsGetForListQuery(c
 {
     const auto localQuery = static_cast<const db::query::ThreadsGetForList *>(query.get());
 
-    auto dbResult = smsDB->threads.getLimitOffset(localQuery->offset, localQuery->limit);
+    auto dbResult = localQuery->anchor.has_value()
+                        ? smsDB->threads.getByAnchor(*localQuery->anchor, localQuery->limit)
+                        : smsDB->threads.getLimitOffset(localQuery->offset, localQuery->limit);
     auto records  = std::vector<ThreadRecord>(dbResult.begin(), dbResult.end());
 
     std::vector<ContactRecord> contacts;
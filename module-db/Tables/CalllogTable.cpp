@@ -5,6 +5,8 @@
 #include <log/log.hpp>
 #include <Utils.hpp>
 
+#include <algorithm>
+
 CalllogTable::CalllogTable(Database *db) : Table(db)
 {}
 
@@ -110,31 +112,53 @@ std::vector<CalllogTableRow> CalllogTable::getByContactId(uint32_t id)
     return ret;
 }
 
-std::vector<CalllogTableRow> CalllogTable::getLimitOffset(uint32_t offset, uint32_t limit)
+namespace
 {
-    auto retQuery = db->query("SELECT * from calls ORDER BY date DESC LIMIT %lu OFFSET %lu;", limit, offset);
-
-    if ((retQuery == nullptr) || (retQuery->getRowCount() == 0)) {
-        return std::vector<CalllogTableRow>();
+    std::vector<CalllogTableRow> getCallsRows(Statement &statement)
+    {
+        std::vector<CalllogTableRow> ret;
+        while (statement.step()) {
+            ret.push_back(CalllogTableRow{
+                {statement.getUInt32(0)},                              // ID
+                statement.getString(1),                                // number
+                statement.getString(2),                                // e164number
+                static_cast<PresentationType>(statement.getUInt32(3)), // presentation
+                static_cast<time_t>(statement.getInt64(4)),            // date
+                static_cast<time_t>(statement.getInt64(5)),            // duration
+                static_cast<CallType>(statement.getUInt32(6)),         // type
+                statement.getString(7),                                // name
+                statement.getUInt32(8),                                // contactID
+                statement.getInt64(9) != 0,                            // isRead
+            });
+        }
+        return ret;
     }
+} // namespace
 
-    std::vector<CalllogTableRow> ret;
+std::vector<CalllogTableRow> CalllogTable::getLimitOffset(uint32_t offset, uint32_t limit)
+{
+    auto statement =
+        db->prepare("SELECT * from calls ORDER BY date DESC, _id DESC LIMIT ? OFFSET ?;", limit, offset);
+    return getCallsRows(statement);
+}
 
-    do {
-        ret.push_back(CalllogTableRow{
-            {(*retQuery)[0].getUInt32()},                              // ID
-            (*retQuery)[1].getString(),                                // number
-            (*retQuery)[2].getString(),                                // e164number
-            static_cast<PresentationType>((*retQuery)[3].getUInt32()), // presentation
-            static_cast<time_t>((*retQuery)[4].getUInt64()),           // date
-            static_cast<time_t>((*retQuery)[5].getUInt64()),           // duration
-            static_cast<CallType>((*retQuery)[6].getUInt32()),         // type
-            (*retQuery)[7].getString(),                                // name
-            (*retQuery)[8].getUInt32(),                                // contactID
-            static_cast<bool>((*retQuery)[9].getUInt64()),             // isRead
-        });
-    } while (retQuery->nextRow());
+std::vector<CalllogTableRow> CalllogTable::getByAnchor(const db::PageAnchor &anchor, uint32_t limit)
+{
+    if (anchor.direction == db::PageAnchor::Direction::After) {
+        auto statement =
+            db->prepare("SELECT * from calls WHERE (date, _id) < (?, ?) ORDER BY date DESC, _id DESC LIMIT ?;",
+                        anchor.date,
+                        anchor.id,
+                        limit);
+        return getCallsRows(statement);
+    }
 
+    auto statement = db->prepare("SELECT * from calls WHERE (date, _id) > (?, ?) ORDER BY date ASC, _id ASC LIMIT ?;",
+                                 anchor.date,
+                                 anchor.id,
+                                 limit);
+    auto ret       = getCallsRows(statement);
+    std::reverse(ret.begin(), ret.end());
     return ret;
 }
 
@@ -226,3 +250,8 @@ bool CalllogTable::SetAllRead()
 {
     return db->execute("UPDATE calls SET isRead = 1;");
 }
+
+bool CalllogTable::updateDateIndex()
+{
+    return db->execute("CREATE INDEX IF NOT EXISTS calls_index_on_date ON calls (date);");
+}
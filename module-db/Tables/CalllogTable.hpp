@@ -8,6 +8,7 @@
 #include "Database/Database.hpp"
 #include "utf8/UTF8.hpp"
 #include "Common/Common.hpp"
+#include "Common/PageAnchor.hpp"
 
 enum class CallType
 {
@@ -64,6 +65,8 @@ class CalllogTable : public Table<CalllogTableRow, CalllogTableFields>
     bool update(CalllogTableRow entry) override final;
     CalllogTableRow getById(uint32_t id) override final;
     std::vector<CalllogTableRow> getLimitOffset(uint32_t offset, uint32_t limit) override final;
+    /// Page of calls adjacent to the anchor, see db::PageAnchor
+    std::vector<CalllogTableRow> getByAnchor(const db::PageAnchor &anchor, uint32_t limit);
     std::vector<CalllogTableRow> getLimitOffsetByField(uint32_t offset,
                                                        uint32_t limit,
                                                        CalllogTableFields field,
@@ -75,4 +78,7 @@ class CalllogTable : public Table<CalllogTableRow, CalllogTableFields>
     uint32_t count(EntryState state);
     uint32_t countByFieldId(const char *field, uint32_t id) override final;
     bool SetAllRead();
+
+    /// Creates the index the pages are read with if the database doesn't have it (created by older versions)
+    bool updateDateIndex();
 };
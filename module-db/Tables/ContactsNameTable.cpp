@@ -2,7 +2,10 @@
 // For licensing, see https://github.com/mudita/MuditaOS/LICENSE.md
 
 #include "ContactsNameTable.hpp"
-#include <Utils.hpp>
+#include <Common/SearchKeys.hpp>
+
+#include <algorithm>
+#include <tuple>
 
 ContactsNameTable::ContactsNameTable(Database *db) : Table(db)
 {}
@@ -21,12 +24,14 @@ bool ContactsNameTable::add(ContactsNameTableRow entry)
                        "VALUES (%lu, '%q', '%q');",
                        entry.contactID,
                        entry.namePrimary.c_str(),
-                       entry.nameAlternative.c_str());
+                       entry.nameAlternative.c_str()) &&
+           addSearchKeys(db->getLastInsertRowId(), entry.namePrimary.c_str(), entry.nameAlternative.c_str());
 }
 
 bool ContactsNameTable::removeById(uint32_t id)
 {
-    return db->execute("DELETE FROM contact_name where _id = %lu;", id);
+    return db->execute("DELETE FROM contact_name where _id = %lu;", id) &&
+           db->prepare("DELETE FROM contact_name_keys WHERE name_id = ?;", id).execute();
 }
 
 bool ContactsNameTable::update(ContactsNameTableRow entry)
@@ -36,7 +41,53 @@ bool ContactsNameTable::update(ContactsNameTableRow entry)
                        entry.contactID,
                        entry.namePrimary.c_str(),
                        entry.nameAlternative.c_str(),
-                       entry.ID);
+                       entry.ID) &&
+           db->prepare("DELETE FROM contact_name_keys WHERE name_id = ?;", entry.ID).execute() &&
+           addSearchKeys(entry.ID, entry.namePrimary.c_str(), entry.nameAlternative.c_str());
+}
+
+// Keys table is WITHOUT ROWID, so adding keys keeps the row id of the name for getLastInsertRowId
+bool ContactsNameTable::addSearchKeys(uint32_t id, const std::string &primaryName, const std::string &alternativeName)
+{
+    for (const auto &key : searchKeys(primaryName, alternativeName)) {
+        if (!db->prepare("INSERT INTO contact_name_keys (name_id, key) VALUES (?, ?);", id, key).execute()) {
+            return false;
+        }
+    }
+    return true;
+}
+
+bool ContactsNameTable::updateSearchKeys()
+{
+    if (!db->execute("CREATE TABLE IF NOT EXISTS contact_name_keys (key TEXT NOT NULL, name_id INTEGER NOT NULL, "
+                     "PRIMARY KEY (key, name_id), FOREIGN KEY (name_id) REFERENCES contact_name (_id)) "
+                     "WITHOUT ROWID;") ||
+        !db->execute("CREATE INDEX IF NOT EXISTS contact_name_keys_index_on_name ON contact_name_keys (name_id);") ||
+        !db->execute("CREATE INDEX IF NOT EXISTS contact_name_index_on_contact ON contact_name (contact_id);")) {
+        return false;
+    }
+
+    std::vector<std::tuple<std::uint32_t, std::string, std::string>> missing;
+    {
+        auto statement = db->prepare("SELECT _id, name_primary, name_alternative FROM contact_name "
+                                     "WHERE _id NOT IN (SELECT name_id FROM contact_name_keys);");
+        while (statement.step()) {
+            missing.emplace_back(statement.getUInt32(0), statement.getString(1), statement.getString(2));
+        }
+    }
+
+    for (const auto &[id, primaryName, alternativeName] : missing) {
+        if (!addSearchKeys(id, primaryName, alternativeName)) {
+            return false;
+        }
+    }
+    return true;
+}
+
+std::vector<std::string> ContactsNameTable::searchKeys(const std::string &primaryName,
+                                                       const std::string &alternativeName)
+{
+    return db::searchKeys(primaryName + " " + alternativeName);
 }
 
 ContactsNameTableRow ContactsNameTable::getById(uint32_t id)
@@ -172,35 +223,25 @@ std::vector<ContactsNameTableRow> ContactsNameTable::GetByName(const char *prima
 
 std::size_t ContactsNameTable::GetCountByName(const std::string &name)
 {
-    if (name.empty()) {
+    const auto prefixes = db::searchKeys(name);
+    if (prefixes.empty()) {
         return count();
     }
 
-    const auto names     = utils::split(name, " ");
-    const auto namePart1 = names[0];
-    const auto namePart2 = names.size() > 1 ? names[1] : "";
-
-    std::unique_ptr<QueryResult> queryRet;
-
-    if (!namePart1.empty() && !namePart2.empty()) {
-        queryRet = db->query(
-            "SELECT COUNT(*) FROM contact_name WHERE (name_primary like '%q%%' AND name_alternative like '%q%%') OR "
-            "(name_primary like '%q%%' AND name_alternative like '%q%%');",
-            namePart1.c_str(),
-            namePart2.c_str(),
-            namePart2.c_str(),
-            namePart1.c_str());
-    }
-    else {
-        queryRet = db->query(
-            "SELECT COUNT(*) FROM contact_name WHERE name_primary like '%q%%' OR name_alternative like '%q%%';",
-            namePart1.c_str(),
-            namePart1.c_str());
+    // The longest word is the most selective one to look up in the index, the others are checked on its results
+    const auto &lookup = *std::max_element(prefixes.begin(), prefixes.end(), [](const auto &lhs, const auto &rhs) {
+        return lhs.size() < rhs.size();
+    });
+    auto statement = db->prepare("SELECT name_primary, name_alternative FROM contact_name WHERE _id IN "
+                                 "(SELECT name_id FROM contact_name_keys WHERE key >= ? AND key < ?);",
+                                 lookup,
+                                 db::prefixUpperBound(lookup));
+
+    std::size_t count = 0;
+    while (statement.step()) {
+        if (db::matchesKeys(searchKeys(statement.getString(0), statement.getString(1)), prefixes)) {
+            count++;
+        }
     }
-
-    if ((queryRet == nullptr) || (queryRet->getRowCount() == 0)) {
-        return 0;
-    }
-
-    return uint32_t{(*queryRet)[0].getUInt32()};
+    return count;
 }
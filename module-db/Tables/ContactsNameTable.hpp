@@ -9,6 +9,7 @@
 #include "Record.hpp"
 #include "utf8/UTF8.hpp"
 #include <string>
+#include <vector>
 
 struct ContactsNameTableRow : public Record
 {
@@ -53,7 +54,16 @@ class ContactsNameTable : public Table<ContactsNameTableRow, ContactNameTableFie
 
     std::vector<ContactsNameTableRow> GetByName(const char *primaryName, const char *alternativeName);
 
+    /// Counts names having a word starting with each of the words of the name, found with the name keys index
     std::size_t GetCountByName(const std::string &name);
 
+    /// Indexes names which have no search keys yet (inserted by scripts or by older versions), creating the keys
+    /// table first if the database doesn't have it
+    bool updateSearchKeys();
+
+    /// Search keys of a contact name: folded words of both of its parts
+    static std::vector<std::string> searchKeys(const std::string &primaryName, const std::string &alternativeName);
+
   private:
+    bool addSearchKeys(uint32_t id, const std::string &primaryName, const std::string &alternativeName);
 };
@@ -3,6 +3,10 @@
 
 #include "ContactsNumberTable.hpp"
 
+#include <algorithm>
+#include <cctype>
+#include <utility>
+
 ContactsNumberTable::ContactsNumberTable(Database *db) : Table(db)
 {}
 
@@ -16,28 +20,34 @@ bool ContactsNumberTable::create()
 
 bool ContactsNumberTable::add(ContactsNumberTableRow entry)
 {
-    return db->execute("insert or ignore into contact_number (contact_id, number_user, number_e164, type) VALUES (%lu, "
-                       "'%q', '%q', %lu);",
+    return db->execute("insert or ignore into contact_number (contact_id, number_user, number_e164, type, "
+                       "number_suffix) VALUES (%lu, '%q', '%q', %lu, '%q');",
                        entry.contactID,
                        entry.numberUser.c_str(),
                        entry.numbere164.c_str(),
-                       entry.type);
+                       entry.type,
+                       numberSuffix(entry.numberUser).c_str()) &&
+           addNumberGrams(db->getLastInsertRowId(), entry.numberUser);
 }
 
 bool ContactsNumberTable::removeById(uint32_t id)
 {
-    return db->execute("DELETE FROM contact_number where _id = %u;", id);
+    return db->execute("DELETE FROM contact_number where _id = %u;", id) &&
+           db->prepare("DELETE FROM contact_number_grams WHERE number_id = ?;", id).execute();
 }
 
 bool ContactsNumberTable::update(ContactsNumberTableRow entry)
 {
-    return db->execute(
-        "UPDATE contact_number SET contact_id = %lu, number_user = '%q', number_e164 = '%q', type = %lu WHERE _id=%lu;",
-        entry.contactID,
-        entry.numberUser.c_str(),
-        entry.numbere164.c_str(),
-        entry.type,
-        entry.ID);
+    return db->execute("UPDATE contact_number SET contact_id = %lu, number_user = '%q', number_e164 = '%q', "
+                       "type = %lu, number_suffix = '%q' WHERE _id=%lu;",
+                       entry.contactID,
+                       entry.numberUser.c_str(),
+                       entry.numbere164.c_str(),
+                       entry.type,
+                       numberSuffix(entry.numberUser).c_str(),
+                       entry.ID) &&
+           db->prepare("DELETE FROM contact_number_grams WHERE number_id = ?;", entry.ID).execute() &&
+           addNumberGrams(entry.ID, entry.numberUser);
 }
 
 ContactsNumberTableRow ContactsNumberTable::getById(uint32_t id)
@@ -128,6 +138,134 @@ std::vector<ContactsNumberTableRow> ContactsNumberTable::getLimitOffset(const st
     return ret;
 }
 
+std::vector<ContactsNumberTableRow> ContactsNumberTable::getByNumberSuffix(const std::string &number)
+{
+    const auto suffix = numberSuffix(number);
+    if (suffix.empty()) {
+        return {};
+    }
+
+    // Numbers being an ending of the given one have suffixes which are prefixes of its suffix,
+    // numbers ending with the given one have suffixes starting with its suffix
+    auto statement = db->prepare("SELECT * FROM contact_number WHERE number_suffix IN (?, ?, ?, ?, ?, ?) OR "
+                                 "(number_suffix >= ? AND number_suffix < ?);");
+    static_assert(numberSuffixLength == 7, "Statement parameters have to cover all shorter suffixes");
+    for (std::size_t length = 1; length < numberSuffixLength; length++) {
+        if (length < suffix.size()) {
+            statement.bind(static_cast<int>(length), std::string_view{suffix}.substr(0, length));
+        }
+        else {
+            statement.bind(static_cast<int>(length), nullptr);
+        }
+    }
+    statement.bind(static_cast<int>(numberSuffixLength), suffix);
+    statement.bind(static_cast<int>(numberSuffixLength + 1), suffix + '~');
+
+    std::vector<ContactsNumberTableRow> ret;
+    while (statement.step()) {
+        ret.push_back(ContactsNumberTableRow{
+            statement.getUInt32(0),                                 // ID
+            statement.getUInt32(1),                                 // contactID
+            statement.getString(2),                                 // numberUser
+            statement.getString(3),                                 // numbere164
+            static_cast<ContactNumberType>(statement.getUInt32(4)), // type
+        });
+    }
+    return ret;
+}
+
+bool ContactsNumberTable::updateNumberSuffixes()
+{
+    const auto columns =
+        db->query("SELECT COUNT(*) FROM pragma_table_info('contact_number') WHERE name = 'number_suffix';");
+    if (columns == nullptr || columns->getRowCount() == 0) {
+        return false;
+    }
+    if ((*columns)[0].getUInt32() == 0) {
+        if (!db->execute("ALTER TABLE contact_number ADD COLUMN number_suffix TEXT;") ||
+            !db->execute("CREATE INDEX IF NOT EXISTS contact_number_index_on_suffix "
+                         "ON contact_number (number_suffix);")) {
+            return false;
+        }
+    }
+
+    std::vector<std::pair<std::uint32_t, std::string>> missing;
+    {
+        auto statement = db->prepare("SELECT _id, number_user FROM contact_number WHERE number_suffix IS NULL;");
+        while (statement.step()) {
+            missing.emplace_back(statement.getUInt32(0), numberSuffix(statement.getString(1)));
+        }
+    }
+
+    for (const auto &[id, suffix] : missing) {
+        if (!db->prepare("UPDATE contact_number SET number_suffix = ? WHERE _id = ?;", suffix, id).execute()) {
+            return false;
+        }
+    }
+    return true;
+}
+
+bool ContactsNumberTable::updateNumberGrams()
+{
+    if (!db->execute("CREATE TABLE IF NOT EXISTS contact_number_grams (gram TEXT NOT NULL, "
+                     "number_id INTEGER NOT NULL, PRIMARY KEY (gram, number_id), "
+                     "FOREIGN KEY (number_id) REFERENCES contact_number (_id)) WITHOUT ROWID;") ||
+        !db->execute("CREATE INDEX IF NOT EXISTS contact_number_grams_index_on_number "
+                     "ON contact_number_grams (number_id);")) {
+        return false;
+    }
+
+    std::vector<std::pair<std::uint32_t, std::string>> missing;
+    {
+        auto statement = db->prepare("SELECT _id, number_user FROM contact_number "
+                                     "WHERE _id NOT IN (SELECT number_id FROM contact_number_grams);");
+        while (statement.step()) {
+            missing.emplace_back(statement.getUInt32(0), statement.getString(1));
+        }
+    }
+
+    for (const auto &[id, number] : missing) {
+        if (!addNumberGrams(id, number)) {
+            return false;
+        }
+    }
+    return true;
+}
+
+// N-grams table is WITHOUT ROWID, so adding n-grams keeps the row id of the number for getLastInsertRowId
+bool ContactsNumberTable::addNumberGrams(uint32_t id, const std::string &number)
+{
+    for (const auto &gram : numberGrams(number)) {
+        if (!db->prepare("INSERT INTO contact_number_grams (number_id, gram) VALUES (?, ?);", id, gram).execute()) {
+            return false;
+        }
+    }
+    return true;
+}
+
+std::vector<std::string> ContactsNumberTable::numberGrams(const std::string &number)
+{
+    std::vector<std::string> grams;
+    for (std::size_t pos = 0; pos + numberGramLength <= number.size(); pos++) {
+        auto gram = number.substr(pos, numberGramLength);
+        if (std::find(grams.begin(), grams.end(), gram) == grams.end()) {
+            grams.push_back(std::move(gram));
+        }
+    }
+    return grams;
+}
+
+std::string ContactsNumberTable::numberSuffix(const std::string &number)
+{
+    std::string suffix;
+    for (auto it = number.rbegin(); it != number.rend() && suffix.size() < numberSuffixLength; it++) {
+        if (std::isdigit(static_cast<unsigned char>(*it))) {
+            suffix.push_back(*it);
+        }
+    }
+    return suffix;
+}
+
 std::vector<ContactsNumberTableRow> ContactsNumberTable::getLimitOffsetByField(uint32_t offset,
                                                                                uint32_t limit,
                                                                                ContactNumberTableFields field,
@@ -9,6 +9,7 @@
 #include "Table.hpp"
 #include "utf8/UTF8.hpp"
 #include <string>
+#include <vector>
 
 struct ContactsNumberTableRow : public Record
 {
@@ -63,6 +64,43 @@ class ContactsNumberTable : public Table<ContactsNumberTableRow, ContactNumberTa
      */
     std::vector<ContactsNumberTableRow> getLimitOffset(const std::string &number, uint32_t offset, uint32_t limit);
 
+    /**
+     * Retrieves contact numbers which may match the number: the ones ending with the same digits as the number
+     * or being an ending of it. Candidates are found with the index of reversed trailing digits, so only a handful
+     * of rows is read regardless of the number of contacts.
+     * @param number    The phone number to find candidates for, has to contain digits.
+     * @return Candidate contact numbers.
+     */
+    std::vector<ContactsNumberTableRow> getByNumberSuffix(const std::string &number);
+
+    /**
+     * Fills the reversed trailing digits of numbers which have none (inserted by scripts or by older versions),
+     * adding the column and its index first if the database doesn't have it.
+     */
+    bool updateNumberSuffixes();
+
+    /**
+     * Key of the suffix index: trailing digits of the number in reversed order, at most numberSuffixLength of them.
+     */
+    static std::string numberSuffix(const std::string &number);
+
+    static constexpr std::size_t numberSuffixLength = 7;
+
+    /**
+     * Fills the n-grams of numbers which have none (inserted by scripts or by older versions), creating the n-gram
+     * table first if the database doesn't have it.
+     */
+    bool updateNumberGrams();
+
+    /**
+     * Keys of the n-gram index: distinct substrings of numberGramLength characters of the number as entered by the
+     * user. A number contains a text of at least that length only if it has all the n-grams of the text, so
+     * the index narrows the search down to the numbers having one of them.
+     */
+    static std::vector<std::string> numberGrams(const std::string &number);
+
+    static constexpr std::size_t numberGramLength = 3;
+
     std::vector<ContactsNumberTableRow> getLimitOffsetByField(uint32_t offset,
                                                               uint32_t limit,
                                                               ContactNumberTableFields field,
@@ -73,4 +111,5 @@ class ContactsNumberTable : public Table<ContactsNumberTableRow, ContactNumberTa
     uint32_t countByFieldId(const char *field, uint32_t id) override final;
 
   private:
+    bool addNumberGrams(uint32_t id, const std::string &number);
 };
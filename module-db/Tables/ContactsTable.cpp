@@ -2,8 +2,12 @@
 // For licensing, see https://github.com/mudita/MuditaOS/LICENSE.md
 
 #include "ContactsTable.hpp"
+#include "ContactsNameTable.hpp"
+#include "ContactsNumberTable.hpp"
+#include <Common/SearchKeys.hpp>
 #include <log/log.hpp>
-#include <Utils.hpp>
+
+#include <algorithm>
 
 namespace ColumnName
 {
@@ -26,6 +30,39 @@ namespace statements
                                    "       AND cg.name = 'Temporary' "
                                    "   ) ";
     const auto selectWithTemp = "SELECT * FROM contacts WHERE _id= %lu";
+
+    const std::string searchFrom = " FROM contacts"
+                                   " INNER JOIN contact_name ON contact_name.contact_id == contacts._id"
+                                   " LEFT JOIN contact_match_groups ON contact_match_groups.contact_id == contacts._id"
+                                   "     AND contact_match_groups.group_id = ?";
+    const std::string searchWhere = " WHERE contacts._id NOT IN ( "
+                                    "   SELECT cmg.contact_id "
+                                    "   FROM contact_match_groups cmg, contact_groups cg "
+                                    "   WHERE cmg.group_id = cg._id "
+                                    "       AND cg.name = 'Temporary' "
+                                    "   ) ";
+    const std::string searchOrder = " ORDER BY group_id DESC"
+                                    " , (contact_name.name_alternative IS NULL OR contact_name.name_alternative ='')"
+                                    " AND (contact_name.name_primary IS NULL OR contact_name.name_primary ='') ASC"
+                                    " , UPPER(contact_name.name_alternative || contact_name.name_primary);";
+
+    /// Contacts with a name word in the key range, all the words of the text are checked on the results
+    const std::string searchByName =
+        "SELECT DISTINCT contacts._id, contact_name.name_primary, contact_name.name_alternative" + searchFrom +
+        searchWhere + " AND contact_name._id IN (SELECT name_id FROM contact_name_keys WHERE key >= ? AND key < ?)" +
+        searchOrder;
+
+    /// Contacts with a number containing the text
+    const std::string searchByNumber =
+        "SELECT DISTINCT contacts._id" + searchFrom + searchWhere +
+        " AND contacts._id IN (SELECT contact_id FROM contact_number WHERE INSTR(number_user, ?) > 0)" + searchOrder;
+
+    /// As searchByNumber, reading only the numbers having the n-gram the text starts with
+    const std::string searchByNumberGram =
+        "SELECT DISTINCT contacts._id" + searchFrom + searchWhere +
+        " AND contacts._id IN (SELECT contact_id FROM contact_number WHERE _id IN "
+        "(SELECT number_id FROM contact_number_grams WHERE gram = ?) AND INSTR(number_user, ?) > 0)" +
+        searchOrder;
 } // namespace statements
 
 ContactsTable::ContactsTable(Database *db) : Table(db)
@@ -271,6 +308,16 @@ std::vector<std::uint32_t> ContactsTable::GetIDsSortedByField(
 {
     std::vector<std::uint32_t> ids;
 
+    if (!name.empty() && (matchType == MatchType::Name || matchType == MatchType::TextNumber)) {
+        const auto &found = search(matchType, name, groupId).ids;
+        if (offset >= found.size()) {
+            return ids;
+        }
+        const auto count = limit > 0 ? std::min<std::size_t>(limit, found.size() - offset) : found.size() - offset;
+        ids.assign(found.begin() + offset, found.begin() + offset + count);
+        return ids;
+    }
+
     std::string query = "SELECT DISTINCT contacts._id FROM contacts";
 
     query += " INNER JOIN contact_name ON contact_name.contact_id == contacts._id ";
@@ -286,33 +333,8 @@ std::vector<std::uint32_t> ContactsTable::GetIDsSortedByField(
                                        "   ) ";
 
     switch (matchType) {
-    case MatchType::Name: {
-        query += exclude_temporary;
-
-        if (!name.empty()) {
-            const auto names     = utils::split(name, " ");
-            const auto namePart1 = names[0];
-            const auto namePart2 = names.size() > 1 ? names[1] : "";
-
-            if (!namePart1.empty() && !namePart2.empty()) {
-                query += " AND (( contact_name.name_primary LIKE '" + namePart1 + "%%'";
-                query += " AND contact_name.name_alternative  LIKE '" + namePart2 + "%%')";
-                query += " OR ( contact_name.name_primary LIKE '" + namePart2 + "%%'";
-                query += " AND contact_name.name_alternative  LIKE '" + namePart1 + "%%'))";
-            }
-            else {
-                query += " AND ( contact_name.name_primary LIKE '" + namePart1 + "%%'";
-                query += " OR contact_name.name_alternative  LIKE '" + namePart1 + "%%')";
-            }
-        }
-    } break;
-
+    case MatchType::Name:
     case MatchType::TextNumber: {
-        if (!name.empty()) {
-            query += " INNER JOIN contact_number ON contact_number.contact_id == contacts._id AND "
-                     "contact_number.number_user LIKE '%%" +
-                     name + "%%'";
-        }
         query += exclude_temporary;
     } break;
 
@@ -350,6 +372,75 @@ std::vector<std::uint32_t> ContactsTable::GetIDsSortedByField(
     return ids;
 }
 
+const ContactsTable::SearchResult &ContactsTable::search(MatchType matchType,
+                                                         const std::string &text,
+                                                         std::uint32_t groupId)
+{
+    const auto changes = db->getTotalChanges();
+    const auto isValid = !lastSearch.text.empty() && lastSearch.changes == changes &&
+                         lastSearch.matchType == matchType && lastSearch.groupId == groupId;
+
+    // The list asks for the count and then for the pages of the same search
+    if (isValid && lastSearch.text == text) {
+        return lastSearch;
+    }
+
+    SearchResult result{matchType, text, groupId, changes};
+
+    // A longer text typed in narrows the previous result down, no need to look at the other contacts
+    if (isValid && text.compare(0, lastSearch.text.size(), lastSearch.text) == 0) {
+        if (matchType == MatchType::Name) {
+            const auto prefixes = db::searchKeys(text);
+            for (std::size_t i = 0; i < lastSearch.ids.size(); i++) {
+                if (db::matchesKeys(lastSearch.keys[i], prefixes)) {
+                    result.ids.push_back(lastSearch.ids[i]);
+                    result.keys.push_back(std::move(lastSearch.keys[i]));
+                }
+            }
+            lastSearch = std::move(result);
+            return lastSearch;
+        }
+        if (lastSearch.ids.empty()) {
+            lastSearch.text = text;
+            return lastSearch;
+        }
+    }
+
+    if (matchType == MatchType::Name) {
+        const auto prefixes = db::searchKeys(text);
+        if (!prefixes.empty()) {
+            // The longest word is the most selective one to look up in the index
+            const auto &lookup =
+                *std::max_element(prefixes.begin(), prefixes.end(), [](const auto &lhs, const auto &rhs) {
+                    return lhs.size() < rhs.size();
+                });
+            auto statement =
+                db->prepare(statements::searchByName.c_str(), groupId, lookup, db::prefixUpperBound(lookup));
+            while (statement.step()) {
+                auto keys = ContactsNameTable::searchKeys(statement.getString(1), statement.getString(2));
+                if (db::matchesKeys(keys, prefixes)) {
+                    result.ids.push_back(statement.getUInt32(0));
+                    result.keys.push_back(std::move(keys));
+                }
+            }
+        }
+    }
+    else {
+        auto statement = text.size() >= ContactsNumberTable::numberGramLength
+                             ? db->prepare(statements::searchByNumberGram.c_str(),
+                                           groupId,
+                                           text.substr(0, ContactsNumberTable::numberGramLength),
+                                           text)
+                             : db->prepare(statements::searchByNumber.c_str(), groupId, text);
+        while (statement.step()) {
+            result.ids.push_back(statement.getUInt32(0));
+        }
+    }
+
+    lastSearch = std::move(result);
+    return lastSearch;
+}
+
 std::vector<ContactsTableRow> ContactsTable::getLimitOffset(uint32_t offset, uint32_t limit)
 {
     auto retQuery = db->query("SELECT * from contacts WHERE contacts._id NOT IN "
@@ -90,4 +90,23 @@ class ContactsTable : public Table<ContactsTableRow, ContactTableFields>
     std::string GetSortedByNameQueryString(ContactQuerySection section);
 
   private:
+    /// Sorted ids of contacts found by name or number, with search keys of the names found, so a search for
+    /// a longer text can be answered from it
+    struct SearchResult
+    {
+        MatchType matchType   = MatchType::None;
+        std::string text;
+        std::uint32_t groupId = 0;
+        std::uint32_t changes = 0; ///< database changes count the result is valid for
+        std::vector<std::uint32_t> ids;
+        std::vector<std::vector<std::string>> keys;
+    };
+
+    /// Searches contacts with names having words starting with the words of the text or with numbers containing
+    /// the text. The result of the last search is kept until the database changes: it is returned again for the
+    /// same text and, for names, filtered in memory for a text extending it, as with every key typed in the search
+    /// field.
+    const SearchResult &search(MatchType matchType, const std::string &text, std::uint32_t groupId);
+
+    SearchResult lastSearch;
 };
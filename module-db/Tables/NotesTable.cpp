@@ -2,6 +2,7 @@
 // For licensing, see https://github.com/mudita/MuditaOS/LICENSE.md
 
 #include "NotesTable.hpp"
+#include <Common/FullTextSearch.hpp>
 #include <log/log.hpp>
 #include <string>
 
@@ -123,31 +124,32 @@ std::pair<std::vector<NotesTableRow>, int> NotesTable::getByText(const std::stri
                                                                  unsigned int offset,
                                                                  unsigned int limit)
 {
+    const auto query = db::fullTextQuery(text);
 
     unsigned int count = 0;
-    auto queryRet      = db->query("SELECT COUNT(*), INSTR(snippet,'%q') pos FROM notes WHERE pos > 0;", text.c_str());
-    if (queryRet && queryRet->getRowCount() != 0) {
-        count = (*queryRet)[0].getUInt32();
+    {
+        auto statement = db->prepare("SELECT COUNT(*) FROM notes_search WHERE notes_search MATCH ?;", query);
+        if (statement.step()) {
+            count = statement.getUInt32(0);
+        }
     }
-
-    std::string queryText = "SELECT *, INSTR(snippet,'" + text + "') pos FROM notes WHERE pos > 0 LIMIT " +
-                            std::to_string(limit) + " offset " + std::to_string(offset) + " ;";
-    auto retQuery = db->query(queryText.c_str());
-
-    if (retQuery == nullptr || retQuery->getRowCount() == 0) {
+    if (count == 0) {
         return {{}, count};
     }
 
+    auto statement = db->prepare("SELECT notes.* FROM notes_search JOIN notes ON notes._id = notes_search.rowid "
+                                 "WHERE notes_search MATCH ? ORDER BY notes_search.rank LIMIT ? OFFSET ?;",
+                                 query,
+                                 limit,
+                                 offset);
     std::vector<NotesTableRow> records;
-    do {
-        NotesTableRow row{
-            (*retQuery)[0].getUInt32(), // ID
-            (*retQuery)[1].getUInt32(), // date
-            (*retQuery)[2].getString()  // snippet
-        };
-        records.push_back(std::move(row));
-    } while (retQuery->nextRow());
-
+    while (statement.step()) {
+        records.push_back(NotesTableRow{
+            statement.getUInt32(0), // ID
+            statement.getUInt32(1), // date
+            statement.getString(2)  // snippet
+        });
+    }
     return {records, count};
 }
 
@@ -168,3 +170,26 @@ std::uint32_t NotesTable::countByFieldId(const char *field, std::uint32_t id)
     }
     return (*queryRet)[0].getUInt32();
 }
+
+bool NotesTable::updateSearchIndex()
+{
+    if (db::hasFullTextTable(db, "notes_search")) {
+        return true;
+    }
+    if (!db->execute(
+            "BEGIN TRANSACTION; "
+            "CREATE VIRTUAL TABLE notes_search USING fts5(snippet, content='notes', content_rowid='_id'); "
+            "CREATE TRIGGER IF NOT EXISTS on_note_insert_search AFTER INSERT ON notes BEGIN "
+            "INSERT INTO notes_search(rowid, snippet) VALUES (new._id, new.snippet); END; "
+            "CREATE TRIGGER IF NOT EXISTS on_note_remove_search AFTER DELETE ON notes BEGIN "
+            "INSERT INTO notes_search(notes_search, rowid, snippet) VALUES ('delete', old._id, old.snippet); END; "
+            "CREATE TRIGGER IF NOT EXISTS on_note_update_search AFTER UPDATE OF snippet ON notes BEGIN "
+            "INSERT INTO notes_search(notes_search, rowid, snippet) VALUES ('delete', old._id, old.snippet); "
+            "INSERT INTO notes_search(rowid, snippet) VALUES (new._id, new.snippet); END; "
+            "INSERT INTO notes_search(notes_search) VALUES ('rebuild'); "
+            "COMMIT;")) {
+        db->execute("ROLLBACK;");
+        return false;
+    }
+    return true;
+}
@@ -48,4 +48,8 @@ class NotesTable : public Table<NotesTableRow, NotesTableFields>
     std::uint32_t count() override;
     std::uint32_t countByText();
     std::uint32_t countByFieldId(const char *field, std::uint32_t id) override;
+
+    /// Creates the full-text index of note snippets with the triggers keeping it in sync if the database doesn't
+    /// have it (created by older versions), filling it with the notes already stored
+    bool updateSearchIndex();
 };
@@ -2,8 +2,29 @@
 // For licensing, see https://github.com/mudita/MuditaOS/LICENSE.md
 
 #include "SMSTable.hpp"
+#include <Common/FullTextSearch.hpp>
 #include <log/log.hpp>
 
+namespace
+{
+    std::vector<SMSTableRow> getSmsRows(Statement &statement)
+    {
+        std::vector<SMSTableRow> ret;
+        while (statement.step()) {
+            ret.push_back(SMSTableRow{
+                statement.getUInt32(0),                       // ID
+                statement.getUInt32(1),                       // threadID
+                statement.getUInt32(2),                       // contactID
+                statement.getUInt32(3),                       // date
+                statement.getUInt32(4),                       // errorCode
+                statement.getString(5),                       // body
+                static_cast<SMSType>(statement.getUInt32(6)), // type
+            });
+        }
+        return ret;
+    }
+} // namespace
+
 SMSTable::SMSTable(Database *db) : Table(db)
 {}
 
@@ -65,21 +86,9 @@ bool SMSTable::update(SMSTableRow entry)
 
 SMSTableRow SMSTable::getById(uint32_t id)
 {
-    auto retQuery = db->query("SELECT * FROM sms WHERE _id= %u;", id);
-
-    if ((retQuery == nullptr) || (retQuery->getRowCount() == 0)) {
-        return SMSTableRow();
-    }
-
-    return SMSTableRow{
-        (*retQuery)[0].getUInt32(),                       // ID
-        (*retQuery)[1].getUInt32(),                       // threadID
-        (*retQuery)[2].getUInt32(),                       // contactID
-        (*retQuery)[3].getUInt32(),                       // date
-        (*retQuery)[4].getUInt32(),                       // errorCode
-        (*retQuery)[5].getString(),                       // body
-        static_cast<SMSType>((*retQuery)[6].getUInt32()), // type
-    };
+    auto statement = db->prepare("SELECT * FROM sms WHERE _id= ?;", id);
+    auto rows      = getSmsRows(statement);
+    return rows.empty() ? SMSTableRow() : rows.front();
 }
 
 std::vector<SMSTableRow> SMSTable::getByContactId(uint32_t contactId)
@@ -108,145 +117,63 @@ std::vector<SMSTableRow> SMSTable::getByContactId(uint32_t contactId)
 }
 std::vector<SMSTableRow> SMSTable::getByThreadId(uint32_t threadId, uint32_t offset, uint32_t limit)
 {
-    auto retQuery = db->query("SELECT * FROM sms WHERE thread_id= %u", threadId);
-
-    if (limit != 0) {
-        retQuery = db->query("SELECT * FROM sms WHERE thread_id= %u LIMIT %u OFFSET %u", threadId, limit, offset);
-    }
-
-    if ((retQuery == nullptr) || (retQuery->getRowCount() == 0)) {
-        return std::vector<SMSTableRow>();
+    if (limit == 0) {
+        auto statement = db->prepare("SELECT * FROM sms WHERE thread_id= ?;", threadId);
+        return getSmsRows(statement);
     }
 
-    std::vector<SMSTableRow> ret;
-
-    do {
-        ret.push_back(SMSTableRow{
-            (*retQuery)[0].getUInt32(),                       // ID
-            (*retQuery)[1].getUInt32(),                       // threadID
-            (*retQuery)[2].getUInt32(),                       // contactID
-            (*retQuery)[3].getUInt32(),                       // date
-            (*retQuery)[4].getUInt32(),                       // errorCode
-            (*retQuery)[5].getString(),                       // body
-            static_cast<SMSType>((*retQuery)[6].getUInt32()), // type
-        });
-    } while (retQuery->nextRow());
-
-    return ret;
+    auto statement = db->prepare("SELECT * FROM sms WHERE thread_id= ? LIMIT ? OFFSET ?;", threadId, limit, offset);
+    return getSmsRows(statement);
 }
 
 std::vector<SMSTableRow> SMSTable::getByThreadIdWithoutDraftWithEmptyInput(uint32_t threadId,
                                                                            uint32_t offset,
                                                                            uint32_t limit)
 {
-    auto retQuery = db->query("SELECT * FROM sms WHERE thread_id= %u AND type != %u UNION ALL SELECT 0 as _id, 0 as "
-                              "thread_id, 0 as contact_id, 0 as "
-                              "date, 0 as error_code, 0 as body, %u as type LIMIT %u OFFSET %u",
-                              threadId,
-                              SMSType::DRAFT,
-                              SMSType::INPUT,
-                              limit,
-                              offset);
-
-    if ((retQuery == nullptr) || (retQuery->getRowCount() == 0)) {
-        return std::vector<SMSTableRow>();
-    }
-
-    std::vector<SMSTableRow> ret;
-
-    do {
-        ret.push_back(SMSTableRow{
-            (*retQuery)[0].getUInt32(),                       // ID
-            (*retQuery)[1].getUInt32(),                       // threadID
-            (*retQuery)[2].getUInt32(),                       // contactID
-            (*retQuery)[3].getUInt32(),                       // date
-            (*retQuery)[4].getUInt32(),                       // errorCode
-            (*retQuery)[5].getString(),                       // body
-            static_cast<SMSType>((*retQuery)[6].getUInt32()), // type
-        });
-    } while (retQuery->nextRow());
-
-    return ret;
+    auto statement = db->prepare("SELECT * FROM sms WHERE thread_id= ? AND type != ? UNION ALL SELECT 0 as _id, 0 as "
+                                 "thread_id, 0 as contact_id, 0 as "
+                                 "date, 0 as error_code, 0 as body, ? as type LIMIT ? OFFSET ?;",
+                                 threadId,
+                                 static_cast<uint32_t>(SMSType::DRAFT),
+                                 static_cast<uint32_t>(SMSType::INPUT),
+                                 limit,
+                                 offset);
+    return getSmsRows(statement);
 }
 
 uint32_t SMSTable::countWithoutDraftsByThreadId(uint32_t threadId)
 {
-    auto queryRet = db->query("SELECT COUNT(*) FROM sms WHERE thread_id= %u AND type != %u;", threadId, SMSType::DRAFT);
-
-    if (queryRet == nullptr || queryRet->getRowCount() == 0) {
-        return 0;
-    }
-
-    return uint32_t{(*queryRet)[0].getUInt32()};
+    auto statement = db->prepare("SELECT COUNT(*) FROM sms WHERE thread_id= ? AND type != ?;",
+                                 threadId,
+                                 static_cast<uint32_t>(SMSType::DRAFT));
+    return statement.step() ? statement.getUInt32(0) : 0;
 }
 
 SMSTableRow SMSTable::getDraftByThreadId(uint32_t threadId)
 {
-    auto retQuery = db->query(
-        "SELECT * FROM sms WHERE thread_id= %u AND type = %u ORDER BY date DESC LIMIT 1;", threadId, SMSType::DRAFT);
-
-    if ((retQuery == nullptr) || (retQuery->getRowCount() == 0)) {
-        return SMSTableRow();
-    }
-
-    return SMSTableRow{
-        (*retQuery)[0].getUInt32(),                       // ID
-        (*retQuery)[1].getUInt32(),                       // threadID
-        (*retQuery)[2].getUInt32(),                       // contactID
-        (*retQuery)[3].getUInt32(),                       // date
-        (*retQuery)[4].getUInt32(),                       // errorCode
-        (*retQuery)[5].getString(),                       // body
-        static_cast<SMSType>((*retQuery)[6].getUInt32()), // type
-    };
+    auto statement = db->prepare("SELECT * FROM sms WHERE thread_id= ? AND type = ? ORDER BY date DESC LIMIT 1;",
+                                 threadId,
+                                 static_cast<uint32_t>(SMSType::DRAFT));
+    auto rows      = getSmsRows(statement);
+    return rows.empty() ? SMSTableRow() : rows.front();
 }
 
 std::vector<SMSTableRow> SMSTable::getByText(std::string text)
 {
-
-    auto retQuery = db->query("SELECT *, INSTR(body,'%q') pos FROM sms WHERE pos > 0;", text.c_str());
-
-    if ((retQuery == nullptr) || (retQuery->getRowCount() == 0)) {
-        return std::vector<SMSTableRow>();
-    }
-
-    std::vector<SMSTableRow> ret;
-
-    do {
-        ret.push_back(SMSTableRow{
-            (*retQuery)[0].getUInt32(),                       // ID
-            (*retQuery)[1].getUInt32(),                       // threadID
-            (*retQuery)[2].getUInt32(),                       // contactID
-            (*retQuery)[3].getUInt32(),                       // date
-            (*retQuery)[4].getUInt32(),                       // errorCode
-            (*retQuery)[5].getString(),                       // body
-            static_cast<SMSType>((*retQuery)[6].getUInt32()), // type
-        });
-    } while (retQuery->nextRow());
-
-    return ret;
+    auto statement = db->prepare("SELECT sms.* FROM sms_search JOIN sms ON sms._id = sms_search.rowid "
+                                 "WHERE sms_search MATCH ? ORDER BY sms_search.rank, sms.date DESC;",
+                                 db::fullTextQuery(text));
+    return getSmsRows(statement);
 }
 
 std::vector<SMSTableRow> SMSTable::getByText(std::string text, uint32_t threadId)
 {
-    auto retQuery =
-        db->query("SELECT *, INSTR(body,'%q') pos FROM sms WHERE pos > 0 AND thread_id=%u;", text.c_str(), threadId);
-    if ((retQuery == nullptr) || (retQuery->getRowCount() == 0)) {
-        return {};
-    }
-
-    std::vector<SMSTableRow> ret;
-    do {
-        ret.push_back(SMSTableRow{
-            (*retQuery)[0].getUInt32(),                       // ID
-            (*retQuery)[1].getUInt32(),                       // threadID
-            (*retQuery)[2].getUInt32(),                       // contactID
-            (*retQuery)[3].getUInt32(),                       // date
-            (*retQuery)[4].getUInt32(),                       // errorCode
-            (*retQuery)[5].getString(),                       // body
-            static_cast<SMSType>((*retQuery)[6].getUInt32()), // type
-        });
-    } while (retQuery->nextRow());
-    return ret;
+    auto statement =
+        db->prepare("SELECT sms.* FROM sms_search JOIN sms ON sms._id = sms_search.rowid "
+                    "WHERE sms_search MATCH ? AND sms.thread_id = ? ORDER BY sms_search.rank, sms.date DESC;",
+                    db::fullTextQuery(text),
+                    threadId);
+    return getSmsRows(statement);
 }
 
 std::vector<SMSTableRow> SMSTable::getLimitOffset(uint32_t offset, uint32_t limit)
@@ -376,3 +303,25 @@ std::pair<uint32_t, std::vector<SMSTableRow>> SMSTable::getManyByType(SMSType ty
     }
     return ret;
 }
+
+bool SMSTable::updateSearchIndex()
+{
+    if (db::hasFullTextTable(db, "sms_search")) {
+        return true;
+    }
+    if (!db->execute("BEGIN TRANSACTION; "
+                     "CREATE VIRTUAL TABLE sms_search USING fts5(body, content='sms', content_rowid='_id'); "
+                     "CREATE TRIGGER IF NOT EXISTS on_sms_insert_search AFTER INSERT ON sms BEGIN "
+                     "INSERT INTO sms_search(rowid, body) VALUES (new._id, new.body); END; "
+                     "CREATE TRIGGER IF NOT EXISTS on_sms_remove_search AFTER DELETE ON sms BEGIN "
+                     "INSERT INTO sms_search(sms_search, rowid, body) VALUES ('delete', old._id, old.body); END; "
+                     "CREATE TRIGGER IF NOT EXISTS on_sms_update_search AFTER UPDATE OF body ON sms BEGIN "
+                     "INSERT INTO sms_search(sms_search, rowid, body) VALUES ('delete', old._id, old.body); "
+                     "INSERT INTO sms_search(rowid, body) VALUES (new._id, new.body); END; "
+                     "INSERT INTO sms_search(sms_search) VALUES ('rebuild'); "
+                     "COMMIT;")) {
+        db->execute("ROLLBACK;");
+        return false;
+    }
+    return true;
+}
@@ -57,4 +57,8 @@ class SMSTable : public Table<SMSTableRow, SMSTableFields>
     SMSTableRow getDraftByThreadId(uint32_t threadId);
 
     std::pair<uint32_t, std::vector<SMSTableRow>> getManyByType(SMSType type, uint32_t offset, uint32_t limit);
+
+    /// Creates the full-text index of message bodies with the triggers keeping it in sync if the database doesn't
+    /// have it (created by older versions), filling it with the messages already stored
+    bool updateSearchIndex();
 };
@@ -2,8 +2,11 @@
 // For licensing, see https://github.com/mudita/MuditaOS/LICENSE.md
 
 #include "ThreadsTable.hpp"
+#include <Common/FullTextSearch.hpp>
 #include <log/log.hpp>
 
+#include <algorithm>
+
 ThreadsTable::ThreadsTable(Database *db) : Table(db)
 {}
 
@@ -83,17 +86,52 @@ void fillRetQuery(std::vector<ThreadsTableRow> &ret, const std::unique_ptr<Query
     } while (retQuery->nextRow());
 }
 
-std::vector<ThreadsTableRow> ThreadsTable::getLimitOffset(uint32_t offset, uint32_t limit)
+namespace
 {
+    std::vector<ThreadsTableRow> getThreadsRows(Statement &statement)
+    {
+        std::vector<ThreadsTableRow> ret;
+        while (statement.step()) {
+            ret.push_back(ThreadsTableRow{
+                statement.getUInt32(0),                       // ID
+                statement.getUInt32(1),                       // date
+                statement.getUInt32(2),                       // msgCount
+                statement.getUInt32(3),                       // unreadMsgCount
+                statement.getUInt32(4),                       // contactID
+                statement.getUInt32(5),                       // numberID
+                statement.getString(6),                       // snippet
+                static_cast<SMSType>(statement.getUInt32(7)), // type/last-dir
+            });
+        }
+        return ret;
+    }
+} // namespace
 
-    auto retQuery = db->query("SELECT * from threads ORDER BY date DESC LIMIT %lu OFFSET %lu;", limit, offset);
+std::vector<ThreadsTableRow> ThreadsTable::getLimitOffset(uint32_t offset, uint32_t limit)
+{
+    auto statement =
+        db->prepare("SELECT * from threads ORDER BY date DESC, _id DESC LIMIT ? OFFSET ?;", limit, offset);
+    return getThreadsRows(statement);
+}
 
-    if ((retQuery == nullptr) || (retQuery->getRowCount() == 0)) {
-        return std::vector<ThreadsTableRow>();
+std::vector<ThreadsTableRow> ThreadsTable::getByAnchor(const db::PageAnchor &anchor, uint32_t limit)
+{
+    if (anchor.direction == db::PageAnchor::Direction::After) {
+        auto statement = db->prepare(
+            "SELECT * from threads WHERE (date, _id) < (?, ?) ORDER BY date DESC, _id DESC LIMIT ?;",
+            anchor.date,
+            anchor.id,
+            limit);
+        return getThreadsRows(statement);
     }
 
-    std::vector<ThreadsTableRow> ret;
-    fillRetQuery(ret, retQuery);
+    auto statement = db->prepare(
+        "SELECT * from threads WHERE (date, _id) > (?, ?) ORDER BY date ASC, _id ASC LIMIT ?;",
+        anchor.date,
+        anchor.id,
+        limit);
+    auto ret = getThreadsRows(statement);
+    std::reverse(ret.begin(), ret.end());
     return ret;
 }
 
@@ -184,26 +222,33 @@ std::pair<uint32_t, std::vector<ThreadsTableRow>> ThreadsTable::getBySMSQuery(st
                                                                               uint32_t offset,
                                                                               uint32_t limit)
 {
-    auto ret       = std::pair<uint32_t, std::vector<ThreadsTableRow>>{0, {}};
-    auto count_ret = db->query("SELECT COUNT (*) from sms WHERE sms.body like \'%%%q%%\'", text.c_str());
-    ret.first      = count_ret == nullptr ? 0 : (*count_ret)[0].getUInt32();
-
-    if (ret.first != 0) {
-        auto retQuery =
-            db->query("SELECT * from sms WHERE sms.body like \'%%%q%%\' ORDER BY date DESC LIMIT %lu OFFSET %lu;",
-                      text.c_str(),
-                      limit,
-                      offset);
-
-        if ((retQuery == nullptr) || (retQuery->getRowCount() == 0)) {
-            ret.second = {};
-        }
-        else {
-            fillRetQuery(ret.second, retQuery);
+    const auto query = db::fullTextQuery(text);
+
+    auto ret = std::pair<uint32_t, std::vector<ThreadsTableRow>>{0, {}};
+    {
+        auto statement = db->prepare("SELECT COUNT(*) FROM sms_search WHERE sms_search MATCH ?;", query);
+        if (statement.step()) {
+            ret.first = statement.getUInt32(0);
         }
     }
-    else {
-        ret.second = {};
+    if (ret.first == 0) {
+        return ret;
     }
+
+    // Every found message is presented as its thread with the message as the snippet
+    auto statement = db->prepare("SELECT sms._id, sms.date, threads.msg_count, threads.read, threads.contact_id, "
+                                 "threads.number_id, sms.body, sms.type "
+                                 "FROM sms_search JOIN sms ON sms._id = sms_search.rowid "
+                                 "JOIN threads ON threads._id = sms.thread_id "
+                                 "WHERE sms_search MATCH ? ORDER BY sms_search.rank, sms.date DESC LIMIT ? OFFSET ?;",
+                                 query,
+                                 limit,
+                                 offset);
+    ret.second = getThreadsRows(statement);
     return ret;
 }
+
+bool ThreadsTable::updateDateIndex()
+{
+    return db->execute("CREATE INDEX IF NOT EXISTS threads_index_on_date ON threads (date);");
+}
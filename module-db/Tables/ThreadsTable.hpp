@@ -7,6 +7,7 @@
 #include "Record.hpp"
 #include "Database/Database.hpp"
 #include "Common/Common.hpp"
+#include "Common/PageAnchor.hpp"
 
 #include <utf8/UTF8.hpp>
 
@@ -43,6 +44,8 @@ class ThreadsTable : public Table<ThreadsTableRow, ThreadsTableFields>
     bool update(ThreadsTableRow entry) override final;
     ThreadsTableRow getById(uint32_t id) override final;
     std::vector<ThreadsTableRow> getLimitOffset(uint32_t offset, uint32_t limit) override final;
+    /// Page of threads adjacent to the anchor, see db::PageAnchor
+    std::vector<ThreadsTableRow> getByAnchor(const db::PageAnchor &anchor, uint32_t limit);
     std::vector<ThreadsTableRow> getLimitOffsetByField(uint32_t offset,
                                                        uint32_t limit,
                                                        ThreadsTableFields field,
@@ -55,4 +58,7 @@ class ThreadsTable : public Table<ThreadsTableRow, ThreadsTableFields>
 
     /// returns: { maximum_query_depth, vector {requested amount of data which match} }
     std::pair<uint32_t, std::vector<ThreadsTableRow>> getBySMSQuery(std::string text, uint32_t offset, uint32_t limit);
+
+    /// Creates the index the pages are read with if the database doesn't have it (created by older versions)
+    bool updateDateIndex();
 };
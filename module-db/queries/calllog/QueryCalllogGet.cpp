@@ -7,7 +7,8 @@
 
 using namespace db::query;
 
-CalllogGet::CalllogGet(std::size_t limit, std::size_t offset) : RecordQuery(limit, offset)
+CalllogGet::CalllogGet(std::size_t limit, std::size_t offset, std::optional<PageAnchor> anchor)
+    : RecordQuery(limit, offset), anchor{anchor}
 {}
 
 [[nodiscard]] auto CalllogGet::debugInfo() const -> std::string
@@ -15,6 +16,11 @@ CalllogGet::CalllogGet(std::size_t limit, std::size_t offset) : RecordQuery(limi
     return "CalllogGet";
 }
 
+auto CalllogGet::getAnchor() const noexcept -> const std::optional<PageAnchor> &
+{
+    return anchor;
+}
+
 CalllogGetResult::CalllogGetResult(std::vector<CalllogRecord> &&records, unsigned int dbRecordsCount)
     : RecordQueryResult(std::move(records)), dbRecordsCount{dbRecordsCount}
 {}
@@ -6,7 +6,9 @@
 #include <queries/RecordQuery.hpp>
 #include <queries/Filter.hpp>
 #include <Interface/CalllogRecord.hpp>
+#include <Common/PageAnchor.hpp>
 
+#include <optional>
 #include <string>
 
 namespace db::query
@@ -14,8 +16,14 @@ namespace db::query
     class CalllogGet : public RecordQuery
     {
       public:
-        CalllogGet(std::size_t limit, std::size_t offset);
+        CalllogGet(std::size_t limit, std::size_t offset, std::optional<PageAnchor> anchor = std::nullopt);
         [[nodiscard]] auto debugInfo() const -> std::string override;
+
+        /// When set, the page is read relative to the anchor and offset is informational only
+        [[nodiscard]] auto getAnchor() const noexcept -> const std::optional<PageAnchor> &;
+
+      private:
+        std::optional<PageAnchor> anchor;
     };
 
     class CalllogGetResult : public RecordQueryResult<CalllogRecord>
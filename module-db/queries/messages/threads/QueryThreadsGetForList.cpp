@@ -7,8 +7,8 @@
 
 namespace db::query
 {
-    ThreadsGetForList::ThreadsGetForList(unsigned int offset, unsigned int limit)
-        : Query(Query::Type::Read), offset(offset), limit(limit)
+    ThreadsGetForList::ThreadsGetForList(unsigned int offset, unsigned int limit, std::optional<PageAnchor> anchor)
+        : Query(Query::Type::Read), offset(offset), limit(limit), anchor(anchor)
     {}
     auto ThreadsGetForList::debugInfo() const -> std::string
     {
@@ -5,7 +5,9 @@
 
 #include <Interface/ThreadRecord.hpp>
 #include <Interface/ContactRecord.hpp>
+#include <Common/PageAnchor.hpp>
 #include <Common/Query.hpp>
+#include <optional>
 #include <string>
 
 namespace db::query
@@ -16,7 +18,9 @@ namespace db::query
       public:
         unsigned int offset;
         unsigned int limit;
-        ThreadsGetForList(unsigned int offset, unsigned int limit);
+        /// When set, the page is read relative to the anchor and offset is informational only
+        std::optional<PageAnchor> anchor;
+        ThreadsGetForList(unsigned int offset, unsigned int limit, std::optional<PageAnchor> anchor = std::nullopt);
 
         [[nodiscard]] auto debugInfo() const -> std::string override;
     };
@@ -81,6 +81,22 @@ TEST_CASE("Contacts Name Table tests")
     // Table should have now 3 elements
     REQUIRE(contactsdb.name.count() == 3);
 
+    // Count names with words starting with each of the words searched for
+    REQUIRE(contactsdb.name.GetCountByName("MAT") == 3);
+    REQUIRE(contactsdb.name.GetCountByName("pat mat") == 3);
+    REQUIRE(contactsdb.name.GetCountByName("pate") == 1);
+    REQUIRE(contactsdb.name.GetCountByName("ateusz") == 0);
+
+    // Search ignores diacritics of both the names and the text searched for
+    testRow1.namePrimary     = "Łucja";
+    testRow1.nameAlternative = "Żółć-Nowak";
+    REQUIRE(contactsdb.name.add(testRow1));
+    const auto diacriticsId = contactsdb.getLastInsertRowId();
+    REQUIRE(contactsdb.name.GetCountByName("lucja zol") == 1);
+    REQUIRE(contactsdb.name.GetCountByName("ŁUC NOW") == 1);
+    REQUIRE(contactsdb.name.removeById(diacriticsId));
+    REQUIRE(contactsdb.name.GetCountByName("lucja") == 0);
+
     // Remove non existing element
     REQUIRE(contactsdb.name.removeById(100));
 
@@ -8,6 +8,9 @@
 #include "Databases/ContactsDB.hpp"
 
 #include <algorithm>
+#include <iterator>
+#include <string>
+#include <vector>
 
 #include <cstdint>
 #include <cstdio>
@@ -93,5 +96,38 @@ TEST_CASE("Contacts Number Table tests")
     // Table should be empty now
     REQUIRE(contactsdb.number.count() == 0);
 
+    // Find candidates by trailing digits
+    auto addNumber = [&contactsdb](const std::string &number) {
+        ContactsNumberTableRow row{Record(DB_ID_NONE), .contactID = DB_ID_NONE, .numberUser = number};
+        REQUIRE(contactsdb.number.add(row));
+    };
+    addNumber("+48 600 100 200");
+    addNumber("600100200");
+    addNumber("100200");
+    addNumber("600100201");
+    addNumber("112");
+
+    REQUIRE(ContactsNumberTable::numberSuffix("+48 600-100-200") == "0020010");
+    REQUIRE(ContactsNumberTable::numberSuffix("112") == "211");
+    REQUIRE(ContactsNumberTable::numberSuffix("abc").empty());
+
+    auto candidates = contactsdb.number.getByNumberSuffix("+48600100200");
+    std::vector<std::string> candidateNumbers;
+    std::transform(candidates.begin(), candidates.end(), std::back_inserter(candidateNumbers), [](const auto &row) {
+        return row.numberUser;
+    });
+    std::sort(candidateNumbers.begin(), candidateNumbers.end());
+    REQUIRE(candidateNumbers == std::vector<std::string>{"+48 600 100 200", "100200", "600100200"});
+
+    REQUIRE(contactsdb.number.getByNumberSuffix("200").size() == 3);
+    REQUIRE(contactsdb.number.getByNumberSuffix("112").size() == 1);
+    REQUIRE(contactsdb.number.getByNumberSuffix("999").empty());
+
+    // Rows without suffix (e.g. inserted by scripts) get it filled
+    REQUIRE(contactsdb.execute("UPDATE contact_number SET number_suffix = NULL;"));
+    REQUIRE(contactsdb.number.getByNumberSuffix("112").empty());
+    REQUIRE(contactsdb.number.updateNumberSuffixes());
+    REQUIRE(contactsdb.number.getByNumberSuffix("112").size() == 1);
+
     Database::deinitialize();
 }
@@ -117,3 +117,83 @@ TEST_CASE("Contacts Table tests")
 
     Database::deinitialize();
 }
+
+TEST_CASE("Contacts search")
+{
+    Database::initialize();
+
+    const auto contactsPath = (std::filesystem::path{"sys/user"} / "contacts.db");
+    if (std::filesystem::exists(contactsPath)) {
+        REQUIRE(std::filesystem::remove(contactsPath));
+    }
+
+    ContactsDB contactsdb{contactsPath.c_str()};
+    REQUIRE(contactsdb.isInitialized());
+
+    auto addContact = [&contactsdb](const char *primaryName, const char *alternativeName, const char *number) {
+        REQUIRE(contactsdb.contacts.add(ContactsTableRow{}));
+        const auto contactId = contactsdb.getLastInsertRowId();
+        REQUIRE(contactsdb.name.add(ContactsNameTableRow{Record(DB_ID_NONE),
+                                                         .contactID       = contactId,
+                                                         .namePrimary     = primaryName,
+                                                         .nameAlternative = alternativeName}));
+        REQUIRE(contactsdb.number.add(ContactsNumberTableRow{
+            Record(DB_ID_NONE), .contactID = contactId, .numberUser = number, .numbere164 = number}));
+        return contactId;
+    };
+
+    const auto alek   = addContact("Alek", "Wyczesany", "600123456");
+    const auto zofia  = addContact("Zofia", "Wyczesany", "600987654");
+    const auto lukasz = addContact("Łukasz", "Arbuz", "+48500123999");
+
+    auto search = [&contactsdb](ContactsTable::MatchType matchType, const std::string &text) {
+        return contactsdb.contacts.GetIDsSortedByField(matchType, text, DB_ID_NONE);
+    };
+
+    SECTION("By name")
+    {
+        REQUIRE(search(ContactsTable::MatchType::Name, "wycz") == std::vector<std::uint32_t>{alek, zofia});
+        REQUIRE(search(ContactsTable::MatchType::Name, "wycz z") == std::vector<std::uint32_t>{zofia});
+        REQUIRE(search(ContactsTable::MatchType::Name, "lukasz").size() == 1);
+        REQUIRE(search(ContactsTable::MatchType::Name, "ŁUK arb").front() == lukasz);
+        REQUIRE(search(ContactsTable::MatchType::Name, "zesany").empty());
+    }
+
+    SECTION("Narrowing search as the text is typed in")
+    {
+        REQUIRE(search(ContactsTable::MatchType::Name, "a").size() == 2);
+        REQUIRE(search(ContactsTable::MatchType::Name, "al").size() == 1);
+        REQUIRE(search(ContactsTable::MatchType::Name, "ale").front() == alek);
+        REQUIRE(search(ContactsTable::MatchType::Name, "alex").empty());
+
+        // Pages are served from the same result
+        REQUIRE(contactsdb.contacts.GetIDsSortedByField(ContactsTable::MatchType::Name, "wy", DB_ID_NONE, 1, 1) ==
+                std::vector<std::uint32_t>{zofia});
+        REQUIRE(contactsdb.contacts.GetIDsSortedByField(ContactsTable::MatchType::Name, "wy", DB_ID_NONE, 1, 2)
+                    .empty());
+
+        // Changes of contacts are not missed
+        addContact("Alex", "Kowalski", "700100200");
+        REQUIRE(search(ContactsTable::MatchType::Name, "alex").size() == 1);
+    }
+
+    SECTION("By number")
+    {
+        REQUIRE(search(ContactsTable::MatchType::TextNumber, "60").size() == 2);
+        REQUIRE(search(ContactsTable::MatchType::TextNumber, "123") == std::vector<std::uint32_t>{lukasz, alek});
+        REQUIRE(search(ContactsTable::MatchType::TextNumber, "1234").front() == alek);
+        REQUIRE(search(ContactsTable::MatchType::TextNumber, "999").front() == lukasz);
+        REQUIRE(search(ContactsTable::MatchType::TextNumber, "1239").size() == 1);
+        REQUIRE(search(ContactsTable::MatchType::TextNumber, "12399").size() == 1);
+        REQUIRE(search(ContactsTable::MatchType::TextNumber, "777").empty());
+
+        auto number       = contactsdb.number.getByContactId(zofia).front();
+        number.numberUser = "777000111";
+        REQUIRE(contactsdb.number.update(number));
+        REQUIRE(search(ContactsTable::MatchType::TextNumber, "777") == std::vector<std::uint32_t>{zofia});
+        REQUIRE(contactsdb.number.removeById(number.ID));
+        REQUIRE(search(ContactsTable::MatchType::TextNumber, "777").empty());
+    }
+
+    Database::deinitialize();
+}
@@ -43,6 +43,32 @@ TEST_CASE("Notes Table tests")
         REQUIRE(records[0].snippet == testSnippet);
     }
 
+    SECTION("Get notes by word prefix")
+    {
+        NotesTableRow row;
+        row.snippet = "Shopping list: bread, milk";
+        table.add(row);
+
+        const auto [records, count] = table.getByText("MIL", 0, 10);
+        REQUIRE(count == 1);
+        REQUIRE(records.size() == 1);
+        REQUIRE(records[0].snippet == row.snippet);
+        REQUIRE(table.getByText("ilk", 0, 10).second == 0);
+    }
+
+    SECTION("Full text index created for older databases")
+    {
+        REQUIRE(notesDb.execute("DROP TRIGGER on_note_insert_search; DROP TRIGGER on_note_remove_search; "
+                                "DROP TRIGGER on_note_update_search; DROP TABLE notes_search;"));
+        NotesTableRow row;
+        row.snippet = "Shopping list: bread, milk";
+        table.add(row);
+
+        REQUIRE(table.updateSearchIndex());
+        REQUIRE(table.getByText("TEST", 0, 10).second == 1);
+        REQUIRE(table.getByText("MIL", 0, 10).second == 1);
+    }
+
     SECTION("Add a note")
     {
         NotesTableRow row;
@@ -127,5 +127,50 @@ TEST_CASE("SMS Table tests")
         REQUIRE(results.back().type == SMSType ::INPUT);
     }
 
+    SECTION("SMS full text search")
+    {
+        testRow1.body = "Meeting moved to Friday";
+        REQUIRE(smsdb.sms.add(testRow1));
+        testRow1.body = "See you at the meeting";
+        REQUIRE(smsdb.sms.add(testRow1));
+        testRow1.threadID = 1;
+        testRow1.body     = "Friday works for me";
+        REQUIRE(smsdb.sms.add(testRow1));
+
+        // word prefixes match regardless of case
+        REQUIRE(smsdb.sms.getByText("meet").size() == 2);
+        REQUIRE(smsdb.sms.getByText("FRI").size() == 2);
+        REQUIRE(smsdb.sms.getByText("fri", 1).size() == 1);
+        REQUIRE(smsdb.sms.getByText("meeting friday").size() == 1);
+        REQUIRE(smsdb.sms.getByText("\"").empty());
+
+        // index follows body updates and removals
+        auto found = smsdb.sms.getByText("works");
+        REQUIRE(found.size() == 1);
+        found.front().body = "Saturday then";
+        REQUIRE(smsdb.sms.update(found.front()));
+        REQUIRE(smsdb.sms.getByText("fri").size() == 1);
+        REQUIRE(smsdb.sms.getByText("satur").size() == 1);
+        REQUIRE(smsdb.sms.removeById(smsdb.sms.getByText("see").front().ID));
+        REQUIRE(smsdb.sms.getByText("meet").size() == 1);
+    }
+
+    SECTION("SMS full text index created for older databases")
+    {
+        testRow1.body = "Meeting moved to Friday";
+        REQUIRE(smsdb.sms.add(testRow1));
+        REQUIRE(smsdb.execute("DROP TRIGGER on_sms_insert_search; DROP TRIGGER on_sms_remove_search; "
+                              "DROP TRIGGER on_sms_update_search; DROP TABLE sms_search;"));
+        testRow1.body = "Friday works for me";
+        REQUIRE(smsdb.sms.add(testRow1));
+
+        REQUIRE(smsdb.sms.updateSearchIndex());
+        REQUIRE(smsdb.sms.getByText("fri").size() == 2);
+        REQUIRE(smsdb.sms.updateSearchIndex());
+        testRow1.body = "See you on Friday";
+        REQUIRE(smsdb.sms.add(testRow1));
+        REQUIRE(smsdb.sms.getByText("fri").size() == 3);
+    }
+
     Database::deinitialize();
 }
@@ -0,0 +1,100 @@
+// Copyright (c) 2017-2021, Mudita Sp. z.o.o. All rights reserved.
+// For licensing, see https://github.com/mudita/MuditaOS/LICENSE.md
+
+#include <catch2/catch.hpp>
+
+#include "common.hpp"
+
+#include "Database/Database.hpp"
+#include "Databases/SmsDB.hpp"
+
+#include <filesystem>
+#include <string>
+
+TEST_CASE("Prepared statements")
+{
+    Database::initialize();
+
+    const auto smsPath = (std::filesystem::path{"sys/user"} / "sms.db");
+    RemoveDbFiles("sms");
+
+    SmsDB smsdb{smsPath.c_str()};
+    REQUIRE(smsdb.isInitialized());
+
+    REQUIRE(smsdb.execute("CREATE TABLE IF NOT EXISTS statement_test(id INTEGER PRIMARY KEY, value INTEGER, "
+                          "ratio REAL, text TEXT);"));
+    REQUIRE(smsdb.execute("DELETE FROM statement_test;"));
+
+    constexpr auto insertSql = "INSERT INTO statement_test(value, ratio, text) VALUES(?, ?, ?);";
+    constexpr auto selectSql = "SELECT id, value, ratio, text FROM statement_test WHERE value >= ? ORDER BY id;";
+
+    SECTION("Typed parameters and columns")
+    {
+        REQUIRE(smsdb.prepare(insertSql, 4000000000U, 0.5, "first").execute());
+        REQUIRE(smsdb.prepare(insertSql, -1, 1.5, std::string{"second"}).execute());
+        REQUIRE(smsdb.prepare(insertSql, 7, 2.5, nullptr).execute());
+
+        auto statement = smsdb.prepare(selectSql, -10);
+        REQUIRE(statement);
+        REQUIRE(statement.getColumnCount() == 4);
+
+        REQUIRE(statement.step());
+        REQUIRE(statement.getUInt32(1) == 4000000000U);
+        REQUIRE(statement.getDouble(2) == Approx(0.5));
+        REQUIRE(statement.getString(3) == "first");
+
+        REQUIRE(statement.step());
+        REQUIRE(statement.getInt32(1) == -1);
+        REQUIRE(statement.getStringView(3) == "second");
+
+        REQUIRE(statement.step());
+        REQUIRE(statement.getInt64(1) == 7);
+        REQUIRE(statement.isNull(3));
+        REQUIRE(statement.getString(3).empty());
+
+        REQUIRE_FALSE(statement.step());
+    }
+
+    SECTION("Cached statement is reset when released")
+    {
+        REQUIRE(smsdb.prepare(insertSql, 1, 0.0, "a").execute());
+        REQUIRE(smsdb.prepare(insertSql, 2, 0.0, "b").execute());
+
+        {
+            auto statement = smsdb.prepare(selectSql, 0);
+            REQUIRE(statement.step());
+            REQUIRE(statement.getString(3) == "a");
+        }
+
+        auto statement = smsdb.prepare(selectSql, 2);
+        REQUIRE(statement.step());
+        REQUIRE(statement.getString(3) == "b");
+        REQUIRE_FALSE(statement.step());
+    }
+
+    SECTION("Same statement used twice at once")
+    {
+        REQUIRE(smsdb.prepare(insertSql, 1, 0.0, "a").execute());
+        REQUIRE(smsdb.prepare(insertSql, 2, 0.0, "b").execute());
+
+        auto outer = smsdb.prepare(selectSql, 0);
+        auto inner = smsdb.prepare(selectSql, 2);
+        REQUIRE(outer.step());
+        REQUIRE(inner.step());
+        REQUIRE(outer.getString(3) == "a");
+        REQUIRE(inner.getString(3) == "b");
+        REQUIRE(outer.step());
+        REQUIRE(outer.getString(3) == "b");
+        REQUIRE_FALSE(inner.step());
+    }
+
+    SECTION("Invalid statement")
+    {
+        auto statement = smsdb.prepare("SELECT * FROM not_existing_table;");
+        REQUIRE_FALSE(statement);
+        REQUIRE_FALSE(statement.step());
+        REQUIRE_FALSE(statement.execute());
+    }
+
+    Database::deinitialize();
+}
@@ -80,6 +80,23 @@ TEST_CASE("Threads Table tests")
     auto retOffsetLimitFailed = smsdb.threads.getLimitOffset(5, 4);
     REQUIRE(retOffsetLimitFailed.size() == 0);
 
+    // Get table rows relative to an already known row, same rows as with offset
+    const auto allThreads = smsdb.threads.getLimitOffset(0, 4);
+    REQUIRE(allThreads.size() == 4);
+    const auto afterAnchor = smsdb.threads.getByAnchor(
+        {allThreads[0].date, allThreads[0].ID, db::PageAnchor::Direction::After}, 2);
+    REQUIRE(afterAnchor.size() == 2);
+    REQUIRE(afterAnchor[0].ID == allThreads[1].ID);
+    REQUIRE(afterAnchor[1].ID == allThreads[2].ID);
+    const auto beforeAnchor = smsdb.threads.getByAnchor(
+        {allThreads[3].date, allThreads[3].ID, db::PageAnchor::Direction::Before}, 2);
+    REQUIRE(beforeAnchor.size() == 2);
+    REQUIRE(beforeAnchor[0].ID == allThreads[1].ID);
+    REQUIRE(beforeAnchor[1].ID == allThreads[2].ID);
+    REQUIRE(smsdb.threads
+                .getByAnchor({allThreads[3].date, allThreads[3].ID, db::PageAnchor::Direction::After}, 2)
+                .empty());
+
     // Get table rows using valid offset/limit parameters and specific field's ID
     REQUIRE(smsdb.threads.getLimitOffsetByField(0, 4, ThreadsTableFields::MsgCount, "0").size() == 4);
 
@@ -105,5 +122,49 @@ TEST_CASE("Threads Table tests")
     // Table should be empty now
     REQUIRE(smsdb.threads.count() == 0);
 
+    // Date index is created for databases which don't have it
+    REQUIRE(smsdb.execute("DROP INDEX threads_index_on_date;"));
+    REQUIRE(smsdb.threads.updateDateIndex());
+    const auto indexes = smsdb.query("SELECT COUNT(*) FROM sqlite_master WHERE name = 'threads_index_on_date';");
+    REQUIRE(indexes != nullptr);
+    REQUIRE((*indexes)[0].getUInt32() == 1);
+
     Database::deinitialize();
 }
+
+TEST_CASE("Page anchors")
+{
+    db::PageAnchors anchors;
+    REQUIRE_FALSE(anchors.find(10, 10).has_value());
+
+    std::vector<db::PageAnchor> keys;
+    for (std::uint32_t i = 0; i < 10; i++) {
+        keys.push_back({100 - i, 20 + i});
+    }
+    anchors.store(10, keys);
+
+    // Next page overlapping the stored one
+    auto anchor = anchors.find(15, 10);
+    REQUIRE(anchor.has_value());
+    REQUIRE(anchor->id == 24);
+    REQUIRE(anchor->direction == db::PageAnchor::Direction::After);
+
+    // Next page right after the stored one
+    anchor = anchors.find(20, 10);
+    REQUIRE(anchor.has_value());
+    REQUIRE(anchor->id == 29);
+
+    // Previous page ending right before the stored one
+    anchor = anchors.find(0, 10);
+    REQUIRE(anchor.has_value());
+    REQUIRE(anchor->id == 20);
+    REQUIRE(anchor->direction == db::PageAnchor::Direction::Before);
+
+    // Pages not touching the stored one
+    REQUIRE_FALSE(anchors.find(10, 10).has_value());
+    REQUIRE_FALSE(anchors.find(21, 10).has_value());
+    REQUIRE_FALSE(anchors.find(0, 5).has_value());
+
+    anchors.clear();
+    REQUIRE_FALSE(anchors.find(15, 10).has_value());
+}
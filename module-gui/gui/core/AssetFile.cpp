@@ -0,0 +1,54 @@
+// Copyright (c) 2017-2021, Mudita Sp. z.o.o. All rights reserved.
+// For licensing, see https://github.com/mudita/MuditaOS/LICENSE.md
+
+#include "AssetFile.hpp"
+
+#include <log/log.hpp>
+
+#include <cstdio>
+#include <filesystem>
+
+namespace gui::asset
+{
+    std::unique_ptr<std::uint8_t[]> read(const std::string &path, std::size_t &size)
+    {
+        size      = 0;
+        auto file = std::fopen(path.c_str(), "rb");
+        if (file == nullptr) {
+            LOG_ERROR("Unable to open file %s", path.c_str());
+            return nullptr;
+        }
+
+        std::error_code error;
+        const auto fileSize = std::filesystem::file_size(path, error);
+        if (error) {
+            std::fclose(file);
+            LOG_ERROR("Unable to get size of file %s", path.c_str());
+            return nullptr;
+        }
+
+        auto data            = std::make_unique<std::uint8_t[]>(fileSize);
+        const auto bytesRead = std::fread(data.get(), 1, fileSize, file);
+        std::fclose(file);
+        if (static_cast<std::uintmax_t>(bytesRead) != fileSize) {
+            LOG_ERROR("Failed to read all file %s", path.c_str());
+            return nullptr;
+        }
+
+        size = fileSize;
+        return data;
+    }
+
+    bool readHead(const std::string &path, std::uint8_t *buffer, std::size_t size)
+    {
+        auto file = std::fopen(path.c_str(), "rb");
+        if (file == nullptr) {
+            LOG_ERROR("Unable to open file %s", path.c_str());
+            return false;
+        }
+
+        const auto bytesRead = std::fread(buffer, 1, size, file);
+        std::fclose(file);
+        return bytesRead == size;
+    }
+} // namespace gui::asset
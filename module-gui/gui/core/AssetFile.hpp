@@ -0,0 +1,20 @@
+// Copyright (c) 2017-2021, Mudita Sp. z.o.o. All rights reserved.
+// For licensing, see https://github.com/mudita/MuditaOS/LICENSE.md
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string>
+
+namespace gui::asset
+{
+    /// reads whole file of an asset
+    /// @param size : set to number of bytes read
+    /// @return content of the file or nullptr if it couldn't be read
+    std::unique_ptr<std::uint8_t[]> read(const std::string &path, std::size_t &size);
+    /// reads the beginning of file of an asset, e.g. to get its header without loading whole asset
+    /// @return true if `size` bytes were read
+    bool readHead(const std::string &path, std::uint8_t *buffer, std::size_t size);
+} // namespace gui::asset
@@ -2,9 +2,9 @@
 // For licensing, see https://github.com/mudita/MuditaOS/LICENSE.md
 
 #include "BoundingBox.hpp"
+#include <algorithm>
 #include <limits>
 #include <sstream>
-#include <limits>
 #include <module-gui/gui/Common.hpp>
 
 namespace gui
@@ -72,6 +72,21 @@ namespace gui
         return true;
     }
 
+    BoundingBox BoundingBox::unite(const BoundingBox &box1, const BoundingBox &box2)
+    {
+        if (box1.isEmpty()) {
+            return box2;
+        }
+        if (box2.isEmpty()) {
+            return box1;
+        }
+        const Position left   = std::min(box1.x, box2.x);
+        const Position top    = std::min(box1.y, box2.y);
+        const Position right  = std::max(box1.right(), box2.right());
+        const Position bottom = std::max(box1.bottom(), box2.bottom());
+        return BoundingBox(left, top, right - left, bottom - top);
+    }
+
     void BoundingBox::clear()
     {
         x = zero_position;
@@ -111,6 +126,32 @@ namespace gui
         h = box.h > h ? box.h : h;
     }
 
+    bool BoundingBox::isEmpty() const noexcept
+    {
+        return w == zero_size || h == zero_size;
+    }
+
+    bool BoundingBox::contains(const BoundingBox &box) const noexcept
+    {
+        return box.x >= x && box.y >= y && box.right() <= right() && box.bottom() <= bottom();
+    }
+
+    bool BoundingBox::overlaps(const BoundingBox &box) const noexcept
+    {
+        return !isEmpty() && !box.isEmpty() && box.x < right() && x < box.right() && box.y < bottom() &&
+               y < box.bottom();
+    }
+
+    Position BoundingBox::right() const noexcept
+    {
+        return x + static_cast<Position>(w);
+    }
+
+    Position BoundingBox::bottom() const noexcept
+    {
+        return y + static_cast<Position>(h);
+    }
+
     bool BoundingBox::operator==(const BoundingBox &box) const
     {
         return !(x != box.x || y != box.y || w != box.w || h != box.h);
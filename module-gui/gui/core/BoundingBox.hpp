@@ -35,6 +35,8 @@ namespace gui
         virtual ~BoundingBox() = default;
 
         static bool intersect(const BoundingBox &box1, const BoundingBox &box2, BoundingBox &result);
+        /// smallest box containing both boxes, empty boxes are ignored
+        static BoundingBox unite(const BoundingBox &box1, const BoundingBox &box2);
 
         /// set x,y,w,h to zero
         void clear();
@@ -45,6 +47,16 @@ namespace gui
         std::string str() const;
         /// logical sum of bounding box by another bounding box values
         void sum(const BoundingBox &box);
+        /// true if box has no area
+        bool isEmpty() const noexcept;
+        /// true if box is entirely placed within this one
+        bool contains(const BoundingBox &box) const noexcept;
+        /// true if boxes have common part
+        bool overlaps(const BoundingBox &box) const noexcept;
+        /// first position past the box in x axis
+        Position right() const noexcept;
+        /// first position past the box in y axis
+        Position bottom() const noexcept;
         bool operator==(const BoundingBox &box) const;
         bool operator!=(const BoundingBox &box) const;
     };
@@ -8,6 +8,7 @@
  *      Author: robert
  */
 
+#include <algorithm>
 #include <ios>
 #include <cstring>
 
@@ -60,21 +61,7 @@ namespace gui
 
     void Context::insert(int16_t ix, int16_t iy, Context *context)
     {
-        // create bounding boxes for the current context and return context
-        BoundingBox currentBox = BoundingBox(0, 0, w, h);
-        BoundingBox insertBox  = BoundingBox(ix, iy, context->w, context->h);
-        BoundingBox resultBox;
-
-        // if boxes overlap copy part defined by result from current context to the new context.
-        if (BoundingBox::intersect(currentBox, insertBox, resultBox)) {
-            Length sourceOffset = (resultBox.y - iy) * context->w + (resultBox.x - ix);
-            Length destOffset   = (resultBox.y) * w + (resultBox.x);
-            for (Length h = 0; h < resultBox.h; h++) {
-                memcpy(data + destOffset, context->data + sourceOffset, resultBox.w);
-                sourceOffset += context->w;
-                destOffset += w;
-            }
-        }
+        copyRect(*context, Point(0, 0), Point(ix, iy), context->w, context->h);
     }
 
     void Context::insertArea(
@@ -103,6 +90,77 @@ namespace gui
         }
     }
 
+    void Context::copyArea(const Context &source, const BoundingBox &area)
+    {
+        if (source.w != w || source.h != h) {
+            return;
+        }
+        copyRect(source, Point(area.x, area.y), Point(area.x, area.y), area.w, area.h);
+    }
+
+    void Context::copyRect(const Context &source, Point sourcePosition, Point position, Length width, Length height)
+    {
+        if (data == nullptr || source.data == nullptr) {
+            return;
+        }
+
+        const auto skipX = std::max({0, -position.x, -sourcePosition.x});
+        const auto skipY = std::max({0, -position.y, -sourcePosition.y});
+        const auto endX  = std::min({static_cast<Position>(width),
+                                    static_cast<Position>(w) - position.x,
+                                    static_cast<Position>(source.w) - sourcePosition.x});
+        const auto endY  = std::min({static_cast<Position>(height),
+                                    static_cast<Position>(h) - position.y,
+                                    static_cast<Position>(source.h) - sourcePosition.y});
+        if (skipX >= endX || skipY >= endY) {
+            return;
+        }
+
+        // Rows moved down within the same context have to be copied starting from the bottom one.
+        const auto bottomUp = &source == this && position.y > sourcePosition.y;
+        for (auto i = skipY; i < endY; ++i) {
+            const auto row = bottomUp ? endY - 1 - (i - skipY) : i;
+            memmove(data + (position.y + row) * w + position.x + skipX,
+                    source.data + (sourcePosition.y + row) * source.w + sourcePosition.x + skipX,
+                    endX - skipX);
+        }
+    }
+
+    void Context::fillSpan(Point start, Length length, uint8_t colour)
+    {
+        if (data == nullptr || start.y < 0 || start.y >= static_cast<Position>(h)) {
+            return;
+        }
+        const auto begin = std::max(start.x, 0);
+        const auto end   = std::min(start.x + static_cast<Position>(length), static_cast<Position>(w));
+        if (begin < end) {
+            memset(data + start.y * w + begin, colour, end - begin);
+        }
+    }
+
+    void Context::fillRect(Point position, Length width, Length height, uint8_t colour)
+    {
+        if (data == nullptr) {
+            return;
+        }
+        const auto left   = std::max(position.x, 0);
+        const auto top    = std::max(position.y, 0);
+        const auto right  = std::min(position.x + static_cast<Position>(width), static_cast<Position>(w));
+        const auto bottom = std::min(position.y + static_cast<Position>(height), static_cast<Position>(h));
+        if (left >= right || top >= bottom) {
+            return;
+        }
+
+        if (left == 0 && right == static_cast<Position>(w)) {
+            memset(data + top * w, colour, (bottom - top) * w);
+            return;
+        }
+        auto row = data + top * w + left;
+        for (auto y = top; y < bottom; ++y, row += w) {
+            memset(row, colour, right - left);
+        }
+    }
+
     void Context::fill(uint8_t colour)
     {
         if (data) {
@@ -112,6 +170,11 @@ namespace gui
         //	memset( data, colour, size );
     }
 
+    void Context::fill(const BoundingBox &area, uint8_t colour)
+    {
+        fillRect(Point(area.x, area.y), area.w, area.h, colour);
+    }
+
     std::ostream &operator<<(std::ostream &out, const Context &c)
     {
         out << "x:" << c.x << "y:" << c.y << "w:" << c.w << "h:" << c.h << std::endl;
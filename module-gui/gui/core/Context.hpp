@@ -17,6 +17,7 @@
 
 namespace gui
 {
+    class BoundingBox;
 
     class Context
     {
@@ -44,10 +45,31 @@ namespace gui
          */
         void insertArea(
             int16_t ix, int16_t iy, int16_t iareaX, int16_t iareaY, int16_t iareaW, int16_t iareaH, Context *context);
+        /**
+         * @brief Copies selected area from provided context of the same size into the same place of current one.
+         */
+        void copyArea(const Context &source, const BoundingBox &area);
+        /**
+         * @brief Copies rectangle of provided context (which may be the current one) into the current context. The
+         * rectangle is clipped to both contexts once and copied row by row.
+         */
+        void copyRect(const Context &source, Point sourcePosition, Point position, Length width, Length height);
+        /**
+         * @brief Fills horizontal span of pixels starting at provided point. The span is clipped to the context.
+         */
+        void fillSpan(Point start, Length length, uint8_t colour);
+        /**
+         * @brief Fills rectangle with specified colour, one row at a time. The rectangle is clipped to the context.
+         */
+        void fillRect(Point position, Length width, Length height, uint8_t colour);
         /**
          * @brief Fills whole context with specified colour;
          */
         void fill(uint8_t colour);
+        /**
+         * @brief Fills selected area of context with specified colour;
+         */
+        void fill(const BoundingBox &area, uint8_t colour);
         /**
          * @brief returns pointer to context's data;
          */
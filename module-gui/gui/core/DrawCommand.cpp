@@ -13,6 +13,7 @@
 #include "renderers/ArcRenderer.hpp"
 #include "renderers/CircleRenderer.hpp"
 #include "renderers/RectangleRenderer.hpp"
+#include "renderers/GlyphRenderer.hpp"
 #include <renderers/PixelRenderer.hpp>
 // text rendering
 #include "FontManager.hpp"
@@ -23,12 +24,6 @@
 #include <cmath>
 #include <cassert>
 
-#if DEBUG_FONT == 1
-#define log_warn_glyph(...) LOG_WARN(__VA_ARGS__)
-#else
-#define log_warn_glyph(...)
-#endif
-
 namespace gui
 {
     void Clear::draw(Context *ctx) const
@@ -107,33 +102,13 @@ namespace gui
 
     void DrawText::drawChar(Context *ctx, const Point glyphOrigin, FontGlyph *glyph) const
     {
-        auto *glyphPtr = glyph->data - glyphOrigin.x;
-        assert(glyph->data);
-
-        Point position           = glyphOrigin;
-        const Position glyphMaxY = glyphOrigin.y - glyph->yoffset + glyph->height;
-        const Position glyphMaxX = glyphOrigin.x + glyph->width;
-
-        for (position.y = glyphOrigin.y - glyph->yoffset; position.y < glyphMaxY; ++position.y) {
-            for (position.x = glyphOrigin.x; position.x < glyphMaxX; ++position.x) {
-                if (!ctx->addressInData(position)) {
-                    log_warn_glyph(
-                        "drawing out of: {x=%d,y=%d} vs {w=%d,h=%d}", position.x, position.y, ctx->getW(), ctx->getH());
-                    return;
-                }
-
-                if (*(glyphPtr + position.x) == ColorFullBlack.intensity) {
-                    renderer::PixelRenderer::draw(ctx, position, color);
-                }
-            }
-            glyphPtr += glyph->width;
-        }
+        renderer::GlyphRenderer::draw(ctx, {glyphOrigin.x, glyphOrigin.y - glyph->yoffset}, *glyph, color);
     }
 
     void DrawText::draw(Context *ctx) const
     {
         // check if there are any characters to draw in the string provided with message.
-        if (str.length() == 0) {
+        if (str.empty()) {
             return;
         }
 
@@ -159,8 +134,14 @@ namespace gui
         uint32_t idLast = 0, idCurrent = 0;
         Point position = textOrigin;
 
-        for (uint32_t i = 0; i < str.length(); ++i) {
-            idCurrent        = str[i]; // id stands for glued together utf-16 with no order bytes (0xFF 0xFE)
+        uint32_t charLength = 0;
+        for (auto character = str.data(); character < str.data() + str.size(); character += charLength) {
+            // id stands for glued together utf-16 with no order bytes (0xFF 0xFE)
+            charLength = 0;
+            idCurrent  = UTF8::decode(character, charLength);
+            if (charLength == 0) {
+                break;
+            }
             FontGlyph *glyph = font->getGlyph(idCurrent);
 
             // do not start drawing outside of draw context.
@@ -175,7 +156,7 @@ namespace gui
             }
 
             int32_t kernValue = 0;
-            if (i > 0) {
+            if (character != str.data()) {
                 kernValue = font->getKerning(idLast, idCurrent);
             }
 
@@ -261,7 +242,7 @@ namespace gui
     void DrawImage::draw(Context *ctx) const
     {
         // retrieve pixmap from the pixmap manager
-        ImageMap *imageMap = ImageManager::getInstance().getImageMap(imageID);
+        ImageMap *imageMap = ImageManager::getInstance().getImageMapToDraw(imageID);
 
         // if image is not found return;
         if (imageMap == nullptr) {
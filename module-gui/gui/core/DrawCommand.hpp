@@ -4,11 +4,13 @@
 #pragma once
 
 #include <string>
+#include <string_view>
 #include <cstdint>
 #include <Math.hpp>
 #include <utf8/UTF8.hpp>
 #include <gui/Common.hpp>
 
+#include "BoundingBox.hpp"
 #include "Color.hpp"
 #include "Context.hpp"
 #include <FontGlyph.hpp>
@@ -20,7 +22,8 @@
 namespace gui
 {
     /**
-     * @brief Draw command interface.
+     * @brief Common part of draw commands.
+     * @note Commands are stored by value in DrawCommandList, each command provides its own draw(Context *) method.
      */
     class DrawCommand
     {
@@ -29,15 +32,14 @@ namespace gui
         int16_t areaY{0};
         Length areaW{0};
         Length areaH{0};
-
-        virtual ~DrawCommand() = default;
-
-        virtual void draw(Context *ctx) const = 0;
+        /// part of the window (in window coordinates) which can be affected by the command
+        BoundingBox drawArea;
     };
 
     class Clear : public DrawCommand
     {
-        void draw(Context *ctx) const override;
+      public:
+        void draw(Context *ctx) const;
     };
 
     /**
@@ -52,7 +54,7 @@ namespace gui
         uint8_t penWidth{1};
 
       public:
-        void draw(Context *ctx) const override;
+        void draw(Context *ctx) const;
     };
 
     /**
@@ -83,7 +85,7 @@ namespace gui
         Color borderColor{ColorFullBlack};
 
       public:
-        void draw(Context *ctx) const override;
+        void draw(Context *ctx) const;
     };
 
     /**
@@ -108,7 +110,7 @@ namespace gui
             : start{_start}, sweep{_sweep}, width{_width}, borderColor{_color}, center{_center}, radius{_radius}
         {}
 
-        void draw(Context *ctx) const override;
+        void draw(Context *ctx) const;
     };
 
     /**
@@ -130,7 +132,7 @@ namespace gui
               fillColor{_fillColor}
         {}
 
-        void draw(Context *ctx) const override;
+        void draw(Context *ctx) const;
     };
 
     /**
@@ -147,11 +149,12 @@ namespace gui
         Point textOrigin{0, 0};
         Length textHeight{0};
 
-        UTF8 str{};
+        /// utf8 text stored in DrawCommandList::storeText
+        std::string_view str{};
         uint8_t fontID{0};
         Color color{ColorFullBlack};
 
-        void draw(Context *ctx) const override;
+        void draw(Context *ctx) const;
 
       private:
         void drawChar(Context *ctx, const Point glyphOrigin, FontGlyph *glyph) const;
@@ -168,7 +171,7 @@ namespace gui
         // ID of the image
         uint16_t imageID{0};
 
-        void draw(Context *ctx) const override;
+        void draw(Context *ctx) const;
 
       private:
         void drawPixMap(Context *ctx, PixMap *pixMap) const;
@@ -0,0 +1,174 @@
+// Copyright (c) 2017-2021, Mudita Sp. z.o.o. All rights reserved.
+// For licensing, see https://github.com/mudita/MuditaOS/LICENSE.md
+
+#include "DrawCommandList.hpp"
+
+#include <mutex.hpp>
+
+#include <algorithm>
+#include <cstring>
+
+namespace gui
+{
+    namespace
+    {
+        constexpr std::size_t TextBlockSize       = 512;
+        constexpr std::size_t MaxRecycledStorages = 2;
+
+        cpp_freertos::MutexStandard recycledStoragesMutex;
+    } // namespace
+
+    DrawCommand &getCommand(DrawCommandRecord &record) noexcept
+    {
+        return std::visit([](DrawCommand &command) -> DrawCommand & { return command; }, record);
+    }
+
+    const DrawCommand &getCommand(const DrawCommandRecord &record) noexcept
+    {
+        return std::visit([](const DrawCommand &command) -> const DrawCommand & { return command; }, record);
+    }
+
+    void draw(const DrawCommandRecord &record, Context *ctx)
+    {
+        std::visit([ctx](const auto &command) { command.draw(ctx); }, record);
+    }
+
+    std::vector<std::unique_ptr<DrawCommandList::Storage>> DrawCommandList::recycledStorages;
+    DrawCommandList::Records DrawCommandList::noRecords;
+
+    DrawCommandList::DrawCommandList() = default;
+
+    DrawCommandList::~DrawCommandList()
+    {
+        if (storage != nullptr) {
+            recycleStorage(std::move(storage));
+        }
+    }
+
+    DrawCommandList::DrawCommandList(DrawCommandList &&other) noexcept : storage{std::move(other.storage)}
+    {}
+
+    DrawCommandList &DrawCommandList::operator=(DrawCommandList &&other) noexcept
+    {
+        if (this != &other) {
+            std::swap(storage, other.storage);
+            other.clear();
+        }
+        return *this;
+    }
+
+    std::string_view DrawCommandList::storeText(std::string_view text)
+    {
+        auto &current     = getStorage();
+        auto &blocks      = current.textBlocks;
+        const auto needed = text.size() + 1; // null-terminated, so that utf8 decoding stops at the end
+        while (current.textBlock < blocks.size() && blocks[current.textBlock].size - current.textUsed < needed) {
+            ++current.textBlock;
+            current.textUsed = 0;
+        }
+        if (current.textBlock == blocks.size()) {
+            const auto size = std::max(TextBlockSize, needed);
+            blocks.push_back({std::make_unique<char[]>(size), size});
+        }
+
+        auto destination = blocks[current.textBlock].data.get() + current.textUsed;
+        std::memcpy(destination, text.data(), text.size());
+        destination[text.size()] = '\0';
+        current.textUsed += needed;
+        return {destination, text.size()};
+    }
+
+    void DrawCommandList::append(const DrawCommandList &source, std::size_t first, std::size_t last)
+    {
+        if (first >= last) {
+            return;
+        }
+        auto &records = getStorage().records;
+        records.reserve(records.size() + (last - first));
+        for (auto i = first; i < last; ++i) {
+            auto &record = records.emplace_back(source.storage->records[i]);
+            if (auto text = std::get_if<DrawText>(&record); text != nullptr) {
+                text->str = storeText(text->str);
+            }
+        }
+    }
+
+    bool DrawCommandList::empty() const noexcept
+    {
+        return storage == nullptr || storage->records.empty();
+    }
+
+    std::size_t DrawCommandList::size() const noexcept
+    {
+        return storage != nullptr ? storage->records.size() : 0;
+    }
+
+    DrawCommandRecord &DrawCommandList::operator[](std::size_t index) noexcept
+    {
+        return storage->records[index];
+    }
+
+    DrawCommandList::Records::iterator DrawCommandList::begin() noexcept
+    {
+        return storage != nullptr ? storage->records.begin() : noRecords.begin();
+    }
+
+    DrawCommandList::Records::iterator DrawCommandList::end() noexcept
+    {
+        return storage != nullptr ? storage->records.end() : noRecords.end();
+    }
+
+    DrawCommandList::Records::const_iterator DrawCommandList::begin() const noexcept
+    {
+        return storage != nullptr ? storage->records.cbegin() : noRecords.cbegin();
+    }
+
+    DrawCommandList::Records::const_iterator DrawCommandList::end() const noexcept
+    {
+        return storage != nullptr ? storage->records.cend() : noRecords.cend();
+    }
+
+    void DrawCommandList::clear() noexcept
+    {
+        if (storage != nullptr) {
+            storage->clear();
+        }
+    }
+
+    DrawCommandList::Storage &DrawCommandList::getStorage()
+    {
+        if (storage == nullptr) {
+            storage = acquireStorage();
+        }
+        return *storage;
+    }
+
+    void DrawCommandList::Storage::clear() noexcept
+    {
+        records.clear();
+        textBlock = 0;
+        textUsed  = 0;
+    }
+
+    std::unique_ptr<DrawCommandList::Storage> DrawCommandList::acquireStorage()
+    {
+        {
+            cpp_freertos::LockGuard lock{recycledStoragesMutex};
+            if (!recycledStorages.empty()) {
+                auto storage = std::move(recycledStorages.back());
+                recycledStorages.pop_back();
+                return storage;
+            }
+        }
+        return std::make_unique<Storage>();
+    }
+
+    void DrawCommandList::recycleStorage(std::unique_ptr<Storage> &&storage)
+    {
+        storage->clear();
+        cpp_freertos::LockGuard lock{recycledStoragesMutex};
+        if (recycledStorages.size() < MaxRecycledStorages) {
+            recycledStorages.push_back(std::move(storage));
+        }
+    }
+} // namespace gui
@@ -0,0 +1,90 @@
+// Copyright (c) 2017-2021, Mudita Sp. z.o.o. All rights reserved.
+// For licensing, see https://github.com/mudita/MuditaOS/LICENSE.md
+
+#pragma once
+
+#include "DrawCommand.hpp"
+
+#include <cstddef>
+#include <memory>
+#include <string_view>
+#include <variant>
+#include <vector>
+
+namespace gui
+{
+    /// Flat record of any draw command, see DrawCommandList
+    using DrawCommandRecord = std::variant<Clear, DrawLine, DrawRectangle, DrawArc, DrawCircle, DrawText, DrawImage>;
+
+    /// gets common part of the command stored in the record
+    [[nodiscard]] DrawCommand &getCommand(DrawCommandRecord &record) noexcept;
+    [[nodiscard]] const DrawCommand &getCommand(const DrawCommandRecord &record) noexcept;
+    /// draws command stored in the record
+    void draw(const DrawCommandRecord &record, Context *ctx);
+
+    /**
+     * @brief Draw commands of a single frame stored in one contiguous buffer of tagged records, with texts of the
+     * commands kept in an arena owned by the list.
+     * @note Buffers are taken when the first command is added and are recycled by the next list when this one is
+     * destroyed, so that building a frame doesn't allocate once the buffers are big enough.
+     */
+    class DrawCommandList
+    {
+      public:
+        using Records = std::vector<DrawCommandRecord>;
+
+        DrawCommandList();
+        ~DrawCommandList();
+        DrawCommandList(DrawCommandList &&other) noexcept;
+        DrawCommandList &operator=(DrawCommandList &&other) noexcept;
+        DrawCommandList(const DrawCommandList &) = delete;
+        DrawCommandList &operator=(const DrawCommandList &) = delete;
+
+        /// creates command at the end of the list
+        template <typename T, typename... Args> T &emplace(Args &&... args)
+        {
+            return std::get<T>(getStorage().records.emplace_back(std::in_place_type<T>, std::forward<Args>(args)...));
+        }
+        /// copies the text to the arena of the list, the copy is valid as long as the list is not cleared
+        [[nodiscard]] std::string_view storeText(std::string_view text);
+        /// copies commands [first, last) of the other list to the end of the list, along with their texts
+        void append(const DrawCommandList &source, std::size_t first, std::size_t last);
+
+        [[nodiscard]] bool empty() const noexcept;
+        [[nodiscard]] std::size_t size() const noexcept;
+        [[nodiscard]] DrawCommandRecord &operator[](std::size_t index) noexcept;
+        [[nodiscard]] Records::iterator begin() noexcept;
+        [[nodiscard]] Records::iterator end() noexcept;
+        [[nodiscard]] Records::const_iterator begin() const noexcept;
+        [[nodiscard]] Records::const_iterator end() const noexcept;
+        void clear() noexcept;
+
+      private:
+        /// buffers of the list, reused by the next list when this one is destroyed
+        struct Storage
+        {
+            struct TextBlock
+            {
+                std::unique_ptr<char[]> data;
+                std::size_t size;
+            };
+
+            Records records;
+            std::vector<TextBlock> textBlocks;
+            std::size_t textBlock = 0;
+            std::size_t textUsed  = 0;
+
+            void clear() noexcept;
+        };
+
+        static std::unique_ptr<Storage> acquireStorage();
+        static void recycleStorage(std::unique_ptr<Storage> &&storage);
+        Storage &getStorage();
+
+        static std::vector<std::unique_ptr<Storage>> recycledStorages;
+        /// iterated by lists without storage
+        static Records noRecords;
+
+        std::unique_ptr<Storage> storage;
+    };
+} // namespace gui
@@ -2,18 +2,13 @@
 // For licensing, see https://github.com/mudita/MuditaOS/LICENSE.md
 
 #include "FontGlyph.hpp"
+#include "Color.hpp"
 #include <cstring>
 
 typedef uint32_t ucode32;
 
 namespace gui
 {
-    FontGlyph::~FontGlyph()
-    {
-        if (data != nullptr)
-            delete[] data;
-    }
-
     FontGlyph::FontGlyph(const FontGlyph *from)
     {
         this->id           = from->id;
@@ -52,18 +47,18 @@ namespace gui
         return gui::Status::GUI_SUCCESS;
     }
 
-    gui::Status FontGlyph::loadImage(uint8_t *data, uint32_t offset)
+    gui::Status FontGlyph::loadImage(const uint8_t *image, uint8_t *bitmap)
     {
-
-        // image data of the glyph
-        this->data = new uint8_t[width * height];
-
-        memcpy(this->data, data + offset, width * height);
-
-        // TODO convert image to the vector of vectors where every last vector contains pairs of
-        // TODO offset - from column 0, length - number of pixels that should be drawn.
-        // TODO First vector contains row and pointer to the vector with pairs
-
+        const auto stride = getBitmapStride();
+        std::memset(bitmap, 0, getBitmapSize());
+        for (uint32_t row = 0; row < height; ++row) {
+            for (uint32_t column = 0; column < width; ++column) {
+                if (image[row * width + column] == ColorFullBlack.intensity) {
+                    bitmap[row * stride + column / 8] |= 1U << (column % 8);
+                }
+            }
+        }
+        this->data = bitmap;
         return gui::Status::GUI_SUCCESS;
     }
 } // namespace gui
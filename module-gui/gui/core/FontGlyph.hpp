@@ -15,9 +15,20 @@ namespace gui
       public:
         FontGlyph() = default;
         FontGlyph(const FontGlyph *);
-        virtual ~FontGlyph();
+        virtual ~FontGlyph() = default;
         gui::Status load(uint8_t *data, uint32_t &offset);
-        gui::Status loadImage(uint8_t *data, uint32_t offset);
+        /// packs 8bpp image of the glyph into the 1bpp bitmap, see data
+        gui::Status loadImage(const uint8_t *image, uint8_t *bitmap);
+        /// number of bytes occupied by a single row of the bitmap
+        [[nodiscard]] uint32_t getBitmapStride() const noexcept
+        {
+            return (width + 7U) / 8U;
+        }
+        /// number of bytes occupied by the whole bitmap
+        [[nodiscard]] uint32_t getBitmapSize() const noexcept
+        {
+            return getBitmapStride() * height;
+        }
         // character id
         ucode32 id = 0;
         // offset in glyph data field
@@ -32,7 +43,8 @@ namespace gui
         int16_t yoffset = 0;
         // how much the current position should be advanced after drawing the character
         uint16_t xadvance = 0;
-        // image data of the glyph
-        uint8_t *data = nullptr;
+        // bitmap of the glyph owned by the font: 1 bit per pixel, set bit means the pixel is drawn,
+        // the least significant bit is the leftmost pixel, every row starts at a new byte
+        const uint8_t *data = nullptr;
     };
 } // namespace gui
@@ -2,10 +2,11 @@
 // For licensing, see https://github.com/mudita/MuditaOS/LICENSE.md
 
 #include "FontManager.hpp"
-#include "Common.hpp"   // for Status, Status::GUI_SUCCESS
-#include "FontInfo.hpp" // for FontInfo
-#include "RawFont.hpp"  // for RawFont
-#include <log/log.hpp>  // for LOG_ERROR, LOG_INFO, LOG_WARN
+#include "AssetFile.hpp" // for readHead
+#include "Common.hpp"    // for Status, Status::GUI_SUCCESS
+#include "FontInfo.hpp"  // for FontInfo
+#include "RawFont.hpp"   // for RawFont
+#include <log/log.hpp>   // for LOG_ERROR, LOG_INFO, LOG_WARN
 #include <Utils.hpp>
 #include <filesystem>
 #include <cstdio>
@@ -43,46 +44,22 @@ namespace gui
 
     RawFont *FontManager::loadFont(std::string filename)
     {
-
-        auto file = std::fopen(filename.c_str(), "rb");
-        if (file == nullptr) {
-            return nullptr;
-        }
-
-        auto fileSize = std::filesystem::file_size(filename);
-        std::rewind(file);
-
-        char *fontData = new char[fileSize];
-        if (fontData == nullptr) {
-            std::fclose(file);
-            LOG_ERROR(" Failed to allocate temporary font buffer");
-            return nullptr;
-        }
-
-        // read data to buffer
-        auto bytesRead = std::fread(fontData, 1, fileSize, file);
-
-        // close file
-        std::fclose(file);
-        if (static_cast<uintmax_t>(bytesRead) != fileSize) {
-            LOG_ERROR("Failed to read all file");
-            delete[] fontData;
+        // only information about the font is read here, glyphs are read when the font is used for the first time
+        uint8_t header[RawFont::headerSize];
+        if (!asset::readHead(filename, header, sizeof(header))) {
+            LOG_ERROR("Failed to read header of font %s", filename.c_str());
             return nullptr;
         }
 
         // allocate memory for new font
         RawFont *font = new RawFont();
-        if (font->load(reinterpret_cast<uint8_t *>(fontData)) != gui::Status::GUI_SUCCESS) {
+        if (font->loadHeader(header, std::move(filename)) != gui::Status::GUI_SUCCESS) {
             delete font;
-            delete[] fontData;
             return nullptr;
         }
-        else {
-            // set id and push it to vector
-            font->id = fonts.size();
-            fonts.push_back(font);
-        }
-        delete[] fontData;
+        // set id and push it to vector
+        font->id = fonts.size();
+        fonts.push_back(font);
         return font;
     }
 
@@ -17,6 +17,7 @@ namespace gui
 
     /// system font provider
     /// loads fonts from discs and build RawFonts to use
+    /// @note only information about fonts is read on init, glyphs of each font are read when it is used first time
     class FontManager
     {
       private:
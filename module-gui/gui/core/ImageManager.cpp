@@ -5,16 +5,23 @@
 #include "ImageMap.hpp"
 #include "VecMap.hpp"
 #include "PixMap.hpp"
-#include "DrawCommand.hpp"
+#include "AssetFile.hpp"
+#include "DrawCommandList.hpp"
 #include "Renderer.hpp"
 #include <log/log.hpp>
 #include <set>
 #include <string>
 #include <filesystem>
 #include <list>
+#include <optional>
 
 namespace gui
 {
+    namespace
+    {
+        /// limit of size of data of images loaded from files, data of the image being drawn is never freed
+        constexpr std::size_t maxLoadedDataSize = 256 * 1024;
+    } // namespace
 
     ImageManager::ImageManager()
     {
@@ -46,6 +53,8 @@ namespace gui
             delete imageMap;
         }
         imageMaps.clear();
+        imageFiles.clear();
+        loadedDataSize = 0;
     }
 
     std::vector<std::string> splitpath(const std::string &str, const std::set<char> delimiters)
@@ -73,91 +82,84 @@ namespace gui
 
     ImageMap *ImageManager::loadPixMap(std::string filename)
     {
+        return addImageMap(new PixMap(), std::move(filename));
+    }
 
-        auto file = std::fopen(filename.c_str(), "rb");
-        if (file == nullptr) {
-            return nullptr;
-        }
+    ImageMap *ImageManager::loadVecMap(std::string filename)
+    {
+        return addImageMap(new VecMap(), std::move(filename));
+    }
 
-        auto fileSize = std::filesystem::file_size(filename);
+    ImageMap *ImageManager::addImageMap(ImageMap *imageMap, std::string filename)
+    {
+        // set id and push it to vector, the image is read from the file when it is used for the first time
+        imageMap->setID(imageMaps.size());
+        std::set<char> delims{'/'};
+        std::vector<std::string> path = splitpath(filename, delims);
+        std::string name              = path[path.size() - 1];
+        name                          = name.substr(0, name.length() - 4);
+        imageMap->setName(name);
+
+        imageMaps.push_back(imageMap);
+        imageFiles.push_back({std::move(filename)});
+        return imageMap;
+    }
 
-        char *data = new char[fileSize];
-        if (data == nullptr) {
-            std::fclose(file);
-            LOG_ERROR(" Failed to allocate temporary font buffer");
-            return nullptr;
+    bool ImageManager::loadImageHeader(std::uint32_t id)
+    {
+        auto &file = imageFiles[id];
+        if (file.headerLoaded) {
+            return true;
         }
 
-        // read data to buffer
-        std::fread(data, 1, fileSize, file);
-
-        // close file
-        std::fclose(file);
-
-        // allocate memory for new font
-        PixMap *pixMap = new PixMap();
-        if (pixMap->load(reinterpret_cast<uint8_t *>(data), fileSize) != gui::Status::GUI_SUCCESS) {
-            delete pixMap;
-            delete[] data;
-            return nullptr;
+        uint8_t header[ImageMap::maxHeaderSize];
+        if (!asset::readHead(file.path, header, sizeof(header))) {
+            LOG_ERROR("Unable to read header of image: %s", file.path.c_str());
+            return false;
         }
-        else {
-            // set id and push it to vector
-            pixMap->setID(imageMaps.size());
-            std::set<char> delims{'/'};
-            std::vector<std::string> path = splitpath(filename, delims);
-            std::string filename          = path[path.size() - 1];
-            filename                      = filename.substr(0, filename.length() - 4);
-
-            pixMap->setName(filename);
-            imageMaps.push_back(pixMap);
-        }
-        delete[] data;
-        return pixMap;
+        imageMaps[id]->loadHeader(header);
+        file.headerLoaded = true;
+        return true;
     }
 
-    ImageMap *ImageManager::loadVecMap(std::string filename)
+    bool ImageManager::loadImageData(std::uint32_t id)
     {
-
-        auto file = std::fopen(filename.c_str(), "rb");
-        if (!file) {
-            LOG_ERROR(" Unable to open file %s", filename.c_str());
-            return nullptr;
+        auto imageMap = imageMaps[id];
+        auto &file    = imageFiles[id];
+        if (imageMap->isLoaded() || file.path.empty()) {
+            return imageMap->isLoaded();
         }
 
-        auto fileSize = std::filesystem::file_size(filename);
-
-        char *data = new char[fileSize];
-        if (data == nullptr) {
-            std::fclose(file);
-            LOG_ERROR(" Failed to allocate temporary font buffer");
-            return nullptr;
+        std::size_t size = 0;
+        auto data        = asset::read(file.path, size);
+        if (data == nullptr || size < ImageMap::maxHeaderSize ||
+            imageMap->load(data.get(), size) != gui::Status::GUI_SUCCESS) {
+            LOG_ERROR("Unable to load image: %s", file.path.c_str());
+            return false;
         }
+        file.headerLoaded = true;
+        loadedDataSize += imageMap->getDataSize();
+        return true;
+    }
 
-        // read data to buffer
-        std::fread(data, 1, fileSize, file);
-
-        // close file
-        std::fclose(file);
-
-        VecMap *vecMap = new VecMap();
-        if (vecMap->load(reinterpret_cast<uint8_t *>(data), fileSize) != gui::Status::GUI_SUCCESS) {
-            delete vecMap;
-            delete[] data;
-            return nullptr;
-        }
-        else {
-            // set id and push it to vector
-            vecMap->setID(imageMaps.size());
-            std::set<char> delims{'/'};
-            std::vector<std::string> path = splitpath(filename, delims);
-            std::string filename          = path[path.size() - 1];
-            filename                      = filename.substr(0, filename.length() - 4);
-            vecMap->setName(filename);
-            imageMaps.push_back(vecMap);
+    void ImageManager::unloadImages(std::uint32_t keptId)
+    {
+        while (loadedDataSize > maxLoadedDataSize) {
+            std::optional<std::uint32_t> leastRecentlyUsed;
+            for (std::uint32_t id = 0; id < imageMaps.size(); ++id) {
+                if (id == keptId || imageFiles[id].path.empty() || !imageMaps[id]->isLoaded()) {
+                    continue;
+                }
+                if (!leastRecentlyUsed || imageFiles[id].lastUse < imageFiles[*leastRecentlyUsed].lastUse) {
+                    leastRecentlyUsed = id;
+                }
+            }
+            if (!leastRecentlyUsed) {
+                return;
+            }
+            loadedDataSize -= imageMaps[*leastRecentlyUsed]->getDataSize();
+            imageMaps[*leastRecentlyUsed]->unload();
         }
-        delete[] data;
-        return vecMap;
     }
 
     void ImageManager::addFallbackImage()
@@ -169,6 +171,7 @@ namespace gui
         fallbackImage->setID(fallbackImageId);
         fallbackImage->setName(fallbackImageName);
         imageMaps.push_back(fallbackImage);
+        imageFiles.push_back({"", true});
     }
 
     ImageMap *ImageManager::createFallbackImage()
@@ -176,26 +179,23 @@ namespace gui
         // Creation of square with crossed lines as fallback image
         constexpr auto squareWidth = 15;
 
-        std::list<std::unique_ptr<gui::DrawCommand>> commands;
-        auto rectangle    = std::make_unique<DrawRectangle>();
-        rectangle->origin = {0, 0};
-        rectangle->width  = squareWidth;
-        rectangle->height = squareWidth;
-        rectangle->areaX  = 0;
-        rectangle->areaY  = 0;
-        rectangle->areaW  = squareWidth;
-        rectangle->areaH  = squareWidth;
-        commands.emplace_back(std::move(rectangle));
-
-        auto line1   = std::make_unique<DrawLine>();
-        line1->start = {0, 0};
-        line1->end   = {squareWidth, squareWidth};
-        commands.emplace_back(std::move(line1));
-
-        auto line2   = std::make_unique<DrawLine>();
-        line2->start = {squareWidth - 1, 0};
-        line2->end   = {0, squareWidth - 1};
-        commands.emplace_back(std::move(line2));
+        DrawCommandList commands;
+        auto &rectangle  = commands.emplace<DrawRectangle>();
+        rectangle.origin = {0, 0};
+        rectangle.width  = squareWidth;
+        rectangle.height = squareWidth;
+        rectangle.areaX  = 0;
+        rectangle.areaY  = 0;
+        rectangle.areaW  = squareWidth;
+        rectangle.areaH  = squareWidth;
+
+        auto &line1 = commands.emplace<DrawLine>();
+        line1.start = {0, 0};
+        line1.end   = {squareWidth, squareWidth};
+
+        auto &line2 = commands.emplace<DrawLine>();
+        line2.start = {squareWidth - 1, 0};
+        line2.end   = {0, squareWidth - 1};
 
         auto renderContext = std::make_unique<Context>(squareWidth, squareWidth);
         Renderer().render(renderContext.get(), commands);
@@ -249,6 +249,26 @@ namespace gui
 #endif
             return imageMaps[fallbackImageId];
         }
+
+        cpp_freertos::LockGuard lock{imagesMutex};
+        if (!loadImageHeader(id)) {
+            return imageMaps[fallbackImageId];
+        }
+        return imageMaps[id];
+    }
+
+    ImageMap *ImageManager::getImageMapToDraw(uint32_t id)
+    {
+        if (id >= imageMaps.size()) {
+            return imageMaps[fallbackImageId];
+        }
+
+        cpp_freertos::LockGuard lock{imagesMutex};
+        if (!loadImageData(id)) {
+            return imageMaps[fallbackImageId];
+        }
+        imageFiles[id].lastUse = ++useCounter;
+        unloadImages(id);
         return imageMaps[id];
     }
     uint32_t ImageManager::getImageMapID(const std::string &name, ImageTypeSpecifier specifier)
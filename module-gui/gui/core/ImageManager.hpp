@@ -3,13 +3,18 @@
 #pragma once
 
 #include "ImageMap.hpp"
+#include <mutex.hpp>
 #include <vector>
 #include <string>
+#include <cstddef>
 #include <cstdint>
 #include <map>
 
 namespace gui
 {
+    /// Provides images from the images folder of assets
+    /// @note images are read from disc when they are used for the first time, data of the least recently drawn images
+    /// is freed once data of all the loaded images exceeds the limit
     class ImageManager
     {
       private:
@@ -22,6 +27,28 @@ namespace gui
         ImageMap *createFallbackImage();
         std::uint32_t fallbackImageId{0};
 
+        /// file of the image and its usage
+        struct ImageFile
+        {
+            /// path of the file, empty if image wasn't loaded from file
+            std::string path;
+            bool headerLoaded     = false;
+            std::uint32_t lastUse = 0;
+        };
+        /// files of the images, indexed by the image id
+        std::vector<ImageFile> imageFiles;
+        /// counter of uses of images, to determine the least recently used one
+        std::uint32_t useCounter = 0;
+        /// total size of data of images loaded from files
+        std::size_t loadedDataSize = 0;
+        cpp_freertos::MutexStandard imagesMutex;
+
+        ImageMap *addImageMap(ImageMap *imageMap, std::string filename);
+        bool loadImageHeader(std::uint32_t id);
+        bool loadImageData(std::uint32_t id);
+        /// frees data of the least recently drawn images until data of loaded images fits the limit
+        void unloadImages(std::uint32_t keptId);
+
       protected:
         std::string mapFolder;
         std::vector<ImageMap *> imageMaps;
@@ -44,7 +71,11 @@ namespace gui
 
         virtual ~ImageManager();
 
+        /// gets image, data of which may be not loaded
         ImageMap *getImageMap(uint32_t id);
+        /// gets image with its data loaded, data of other images may be freed
+        /// @note has to be used only by renderer, as data of other images gets invalid
+        ImageMap *getImageMapToDraw(uint32_t id);
         uint32_t getImageMapID(const std::string &name, ImageTypeSpecifier specifier = ImageTypeSpecifier::None);
         void clear();
     };
@@ -3,6 +3,8 @@
 
 #include "ImageMap.hpp"
 
+#include <cstring>
+
 namespace gui
 {
 
@@ -13,9 +15,28 @@ namespace gui
     {}
 
     ImageMap::~ImageMap()
+    {
+        unload();
+    }
+
+    uint32_t ImageMap::loadHeader(uint8_t *data)
+    {
+        uint32_t offset = 0;
+
+        // read width and height of the image
+        memcpy(&width, data + offset, sizeof(uint16_t));
+        offset += sizeof(uint16_t);
+        memcpy(&height, data + offset, sizeof(uint16_t));
+        offset += sizeof(uint16_t);
+
+        return offset;
+    }
+
+    void ImageMap::unload()
     {
         if (data)
             delete[] data;
-        data = nullptr;
+        data     = nullptr;
+        dataSize = 0;
     }
 } /* namespace gui */
@@ -31,8 +31,10 @@ namespace gui
         uint16_t width;
         // number of rows in the image
         uint16_t height;
-        // data of the image
+        // data of the image, nullptr if it is not loaded
         uint8_t *data = nullptr;
+        // size of the data of the image
+        uint32_t dataSize = 0;
         // file name
         std::string name;
         // type of the image
@@ -59,6 +61,14 @@ namespace gui
         {
             return data;
         };
+        uint32_t getDataSize()
+        {
+            return dataSize;
+        };
+        bool isLoaded()
+        {
+            return data != nullptr;
+        };
         std::string getName()
         {
             return name;
@@ -81,6 +91,13 @@ namespace gui
         {
             return gui::Status::GUI_SUCCESS;
         };
+        // maximum size of header of the image file
+        static constexpr uint32_t maxHeaderSize = 5;
+        // reads size of the image (and other properties of the image stored in the header of its file)
+        // returns size of the header
+        virtual uint32_t loadHeader(uint8_t *data);
+        // frees data of the image, it can be loaded again with load()
+        void unload();
     };
 
 } /* namespace gui */
@@ -26,6 +26,7 @@ namespace gui
     {
 
         this->data = new uint8_t[width * height];
+        dataSize   = width * height;
         type       = Type::PIXMAP;
 
         // no data provided - allocat buffer and clear it with white color
@@ -41,18 +42,14 @@ namespace gui
 
     gui::Status PixMap::load(uint8_t *data, uint32_t size)
     {
+        const auto offset = loadHeader(data);
 
-        uint32_t offset = 0;
-
-        // read width and height of the image
-        memcpy(&width, data + offset, sizeof(uint16_t));
-        offset += sizeof(uint16_t);
-        memcpy(&height, data + offset, sizeof(uint16_t));
-        offset += sizeof(uint16_t);
-
+        unload();
         this->data = new uint8_t[width * height];
-        if (this->data)
+        if (this->data) {
             memcpy(this->data, data + offset, width * height);
+            dataSize = width * height;
+        }
 
         return gui::Status::GUI_SUCCESS;
     }
@@ -2,19 +2,29 @@
 // For licensing, see https://github.com/mudita/MuditaOS/LICENSE.md
 
 #include "RawFont.hpp"
+#include "AssetFile.hpp"     // for read
 #include "Common.hpp"        // for Status, Status::GUI_SUCCESS, Status::GU...
 #include "Context.hpp"       // for Context
-#include "DrawCommand.hpp"   // for DrawRectangle, DrawCommand (ptr only)
+#include "DrawCommandList.hpp" // for DrawRectangle, DrawCommandList
 #include "FontKerning.hpp"   // for FontKerning
 #include "Renderer.hpp"      // for Renderer
 #include "TextConstants.hpp" // for newline
 #include <log/log.hpp>       // for LOG_ERROR
 #include "utf8/UTF8.hpp"     // for UTF8
+#include <algorithm>         // for lower_bound, stable_sort, unique
 #include <cstring>           // for memcpy
+#include <iterator>          // for distance, prev
+#include <tuple>             // for tie
 #include <utility>           // for pair
 
 namespace gui
 {
+    namespace
+    {
+        /// glyphs with ids lower than that, i.e. latin, greek and cyrillic, are found by direct indexing
+        constexpr uint32_t directGlyphsLimit = 0x0500;
+        constexpr uint16_t noGlyph           = std::numeric_limits<uint16_t>::max();
+    } // namespace
 
     RawFont::~RawFont()
     {
@@ -24,6 +34,47 @@ namespace gui
     }
 
     gui::Status RawFont::load(uint8_t *data)
+    {
+        if (parseHeader(data) != gui::Status::GUI_SUCCESS) {
+            return gui::Status::GUI_FAILURE;
+        }
+        loadGlyphs(data);
+        glyphsLoaded = true;
+        return gui::Status::GUI_SUCCESS;
+    }
+
+    gui::Status RawFont::loadHeader(uint8_t *data, std::string file)
+    {
+        if (parseHeader(data) != gui::Status::GUI_SUCCESS) {
+            return gui::Status::GUI_FAILURE;
+        }
+        this->file = std::move(file);
+        return gui::Status::GUI_SUCCESS;
+    }
+
+    void RawFont::ensureGlyphsLoaded() const
+    {
+        if (glyphsLoaded.load(std::memory_order_acquire)) {
+            return;
+        }
+
+        cpp_freertos::LockGuard lock{glyphsMutex};
+        if (glyphsLoaded.load(std::memory_order_relaxed)) {
+            return;
+        }
+        std::size_t size = 0;
+        auto data        = asset::read(file, size);
+        if (data != nullptr && size >= headerSize) {
+            loadGlyphs(data.get());
+        }
+        else {
+            LOG_ERROR("Unable to load glyphs of font %s", info.face.c_str());
+            createGlyphUnsupported();
+        }
+        glyphsLoaded.store(true, std::memory_order_release);
+    }
+
+    gui::Status RawFont::parseHeader(uint8_t *data)
     {
         uint32_t offset = 0;
 
@@ -48,45 +99,66 @@ namespace gui
         // id of the font assigned by the font manager
         id = 1;
 
-        // load glyphs
+        return gui::Status::GUI_SUCCESS;
+    }
+
+    void RawFont::loadGlyphs(uint8_t *data) const
+    {
+        // load glyphs, sorted by id so that they can be searched in
         uint32_t glyphOffset = glyph_data_offset;
-        for (unsigned int i = 0; i < glyph_count; i++) {
-            auto glyph = std::make_unique<FontGlyph>();
-            glyph->load(data, glyphOffset);
-            glyph->loadImage(data, glyph->glyph_offset);
-            glyphs.insert(std::pair<uint32_t, std::unique_ptr<FontGlyph>>(glyph->id, std::move(glyph)));
+        glyphs.resize(glyph_count);
+        for (auto &glyph : glyphs) {
+            glyph.load(data, glyphOffset);
+        }
+        std::stable_sort(glyphs.begin(), glyphs.end(), [](const FontGlyph &lhs, const FontGlyph &rhs) {
+            return lhs.id < rhs.id;
+        });
+        glyphs.erase(std::unique(glyphs.begin(),
+                                 glyphs.end(),
+                                 [](const FontGlyph &lhs, const FontGlyph &rhs) { return lhs.id == rhs.id; }),
+                     glyphs.end());
+
+        // the most common characters are found by direct indexing
+        const auto directGlyphsEnd = std::lower_bound(
+            glyphs.begin(), glyphs.end(), directGlyphsLimit, [](const FontGlyph &glyph, uint32_t id) {
+                return glyph.id < id;
+            });
+        if (directGlyphsEnd != glyphs.begin()) {
+            directGlyphs.assign(std::prev(directGlyphsEnd)->id + 1, noGlyph);
+            for (auto glyph = glyphs.begin(); glyph != directGlyphsEnd; ++glyph) {
+                directGlyphs[glyph->id] = static_cast<uint16_t>(std::distance(glyphs.begin(), glyph));
+            }
         }
 
-        // load kerning
-        // first map contains index of the character and the map that holds values for kerning between
-        // first and second character character. In second map key is the value of the second character
-        // and value is the kerning between first and second element.
-        uint32_t kernOffset = kern_data_offset;
-        for (unsigned int i = 0; i < kern_count; i++) {
-            auto kern = std::make_unique<FontKerning>();
-            kern->load(data, kernOffset);
-
-            // find map using first element of kerning as a key
-            auto it = kerning.find(kern->first);
-
-            // element wasn't found
-            if (it == kerning.end()) {
-                std::map<uint32_t, std::unique_ptr<FontKerning>> kernMap;
-                auto kern_first = kern->first;
-                kernMap.emplace(std::make_pair(kern->second, std::move(kern)));
+        // pack images of all glyphs into a single 1bpp atlas
+        uint32_t atlasSize = 0;
+        for (const auto &glyph : glyphs) {
+            atlasSize += glyph.getBitmapSize();
+        }
+        glyphAtlas           = std::make_unique<uint8_t[]>(atlasSize);
+        uint32_t atlasOffset = 0;
+        for (auto &glyph : glyphs) {
+            glyph.loadImage(data + glyph.glyph_offset, glyphAtlas.get() + atlasOffset);
+            atlasOffset += glyph.getBitmapSize();
+        }
 
-                // insert element to the first map
-                kerning.emplace(std::make_pair(kern_first, std::move(kernMap)));
-            }
-            else {
-                auto &kernMap = it->second;
-                kernMap.emplace(std::make_pair(kern->second, std::move(kern)));
-            }
+        // load kerning, sorted by pair of characters so that it can be searched in
+        uint32_t kernOffset = kern_data_offset;
+        kerning.resize(kern_count);
+        for (auto &kern : kerning) {
+            kern.load(data, kernOffset);
         }
+        std::stable_sort(kerning.begin(), kerning.end(), [](const FontKerning &lhs, const FontKerning &rhs) {
+            return std::tie(lhs.first, lhs.second) < std::tie(rhs.first, rhs.second);
+        });
+        kerning.erase(std::unique(kerning.begin(),
+                                  kerning.end(),
+                                  [](const FontKerning &lhs, const FontKerning &rhs) {
+                                      return lhs.first == rhs.first && lhs.second == rhs.second;
+                                  }),
+                      kerning.end());
 
         createGlyphUnsupported();
-
-        return gui::Status::GUI_SUCCESS;
     }
 
     int32_t RawFont::getKerning(uint32_t id1, uint32_t id2) const
@@ -94,22 +166,15 @@ namespace gui
         if (id2 == none_char_id) {
             return 0;
         }
-        // search for a map with kerning for given character (id1)
-        auto it1 = kerning.find(id1);
-
-        // if there is no map with kerning for id1 return 0;
-        if (it1 == kerning.end())
-            return 0;
-
-        auto &kernMap = it1->second;
+        ensureGlyphsLoaded();
 
-        // otherwise search for id2 in kernMap and return value or 0 if it's not found
-        auto it2 = kernMap.find(id2);
-        if (it2 == kernMap.end()) {
+        const auto kern = std::lower_bound(
+            kerning.begin(), kerning.end(), std::make_pair(id1, id2), [](const FontKerning &kern, const auto &pair) {
+                return std::tie(kern.first, kern.second) < std::tie(pair.first, pair.second);
+            });
+        if (kern == kerning.end() || kern->first != id1 || kern->second != id2) {
             return 0;
         }
-
-        const std::unique_ptr<FontKerning> &kern = it2->second;
         return kern->amount;
     }
 
@@ -134,6 +199,7 @@ namespace gui
 
     FontGlyph *RawFont::getGlyph(uint32_t glyph_id) const
     {
+        ensureGlyphsLoaded();
         auto glyph = this->findGlyph(glyph_id);
         if (glyph != nullptr) {
             return glyph;
@@ -147,9 +213,20 @@ namespace gui
 
     FontGlyph *RawFont::findGlyph(uint32_t glyph_id) const
     {
-        auto glyph_found = glyphs.find(glyph_id);
-        if (glyph_found != glyphs.end()) {
-            return glyph_found->second.get();
+        ensureGlyphsLoaded();
+        return lookupGlyph(glyph_id);
+    }
+
+    FontGlyph *RawFont::lookupGlyph(uint32_t glyph_id) const
+    {
+        if (glyph_id < directGlyphs.size()) {
+            const auto index = directGlyphs[glyph_id];
+            return index != noGlyph ? &glyphs[index] : nullptr;
+        }
+        const auto glyph = std::lower_bound(
+            glyphs.begin(), glyphs.end(), glyph_id, [](const FontGlyph &glyph, uint32_t id) { return glyph.id < id; });
+        if (glyph != glyphs.end() && glyph->id == glyph_id) {
+            return &*glyph;
         }
         return nullptr;
     }
@@ -261,7 +338,7 @@ namespace gui
         }
     }
 
-    void RawFont::createGlyphUnsupported()
+    void RawFont::createGlyphUnsupported() const
     {
         unsupported                                    = std::make_unique<FontGlyph>();
         const float pt_to_px                           = 0.75;
@@ -275,9 +352,7 @@ namespace gui
         // for the rectangle
         char baseChar = 'h'; // arbitrary choice. h as a representative character to get an idea of glyph size. if not
                              // found, then use magic numbers above
-        auto baseCharFound = this->glyphs.find(baseChar);
-        if (baseCharFound != this->glyphs.end()) {
-            FontGlyph *baseGlyph = baseCharFound->second.get();
+        if (FontGlyph *baseGlyph = lookupGlyph(baseChar); baseGlyph != nullptr) {
             unsupported->width   = baseGlyph->width;
             unsupported->height  = baseGlyph->height;
             unsupported->xoffset = (baseGlyph->xadvance - baseGlyph->width) / 2;
@@ -289,24 +364,22 @@ namespace gui
         unsupported->xadvance =
             unsupported->width + (2 * unsupported->xoffset); // use xoffset as margins on the left/right of the glyph
         // populate with a bitmap (glyph)
-        auto commandRect      = std::make_unique<DrawRectangle>();
-        commandRect->origin   = {0, 0};
-        commandRect->width    = unsupported->width;
-        commandRect->height   = unsupported->height;
-        commandRect->areaX    = 0;
-        commandRect->areaY    = 0;
-        commandRect->areaW    = unsupported->width;
-        commandRect->areaH    = unsupported->height;
-        commandRect->penWidth = unsupported->xoffset;
+        DrawCommandList commands;
+        auto &commandRect    = commands.emplace<DrawRectangle>();
+        commandRect.origin   = {0, 0};
+        commandRect.width    = unsupported->width;
+        commandRect.height   = unsupported->height;
+        commandRect.areaX    = 0;
+        commandRect.areaY    = 0;
+        commandRect.areaW    = unsupported->width;
+        commandRect.areaH    = unsupported->height;
+        commandRect.penWidth = unsupported->xoffset;
 
         auto renderCtx = std::make_unique<Context>(unsupported->width, unsupported->height);
-        std::list<std::unique_ptr<gui::DrawCommand>> commands;
-        commands.emplace_back(std::move(commandRect));
         Renderer().render(renderCtx.get(), commands);
 
-        auto size         = unsupported->width * unsupported->height;
-        unsupported->data = new uint8_t[size];
-        std::memcpy(unsupported->data, renderCtx->getData(), size);
+        unsupportedBitmap = std::make_unique<uint8_t[]>(unsupported->getBitmapSize());
+        unsupported->loadImage(renderCtx->getData(), unsupportedBitmap.get());
     }
 
     void RawFont::setFallbackFont(RawFont *fallback)
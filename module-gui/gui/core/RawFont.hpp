@@ -7,11 +7,13 @@
 #include "Ellipsis.hpp"
 #include "FontInfo.hpp"
 #include "utf8/UTF8.hpp"
+#include <mutex.hpp>
+#include <atomic>
 #include <cstdint>
 #include <limits>
-#include <map>
 #include <memory>
 #include <string>
+#include <vector>
 #include "FontGlyph.hpp"   // for FontGlyph
 #include "FontKerning.hpp" // for FontKerning
 
@@ -26,7 +28,15 @@ namespace gui
       public:
         virtual ~RawFont();
 
+        /// size of the font information at the beginning of the font file, see loadHeader
+        static constexpr uint32_t headerSize = 104;
+
+        /// loads whole font from the data of the font file
         gui::Status load(uint8_t *data);
+        /// loads only information about the font, glyphs and kerning are read from the font file on first use
+        /// @param data : first `headerSize` bytes of the font file
+        /// @param file : path to the font file
+        gui::Status loadHeader(uint8_t *data, std::string file);
 
         static const uint32_t none_char_id = std::numeric_limits<const uint32_t>().max();
         // structure holding detailed information about font
@@ -101,12 +111,32 @@ namespace gui
         void setFallbackFont(RawFont *font);
 
       private:
-        std::map<uint32_t, std::unique_ptr<FontGlyph>> glyphs;
-        std::map<uint32_t, std::map<uint32_t, std::unique_ptr<FontKerning>>> kerning;
+        /// path to the font file the glyphs are read from, empty if font was loaded from memory
+        std::string file;
+        /// glyphs, kerning and the unsupported glyph are loaded on first use, hence `mutable`
+        mutable std::atomic<bool> glyphsLoaded{false};
+        mutable cpp_freertos::MutexStandard glyphsMutex;
+
+        /// glyphs sorted by id
+        mutable std::vector<FontGlyph> glyphs;
+        /// indices of glyphs in `glyphs` by id, for ids lower than directGlyphsLimit
+        mutable std::vector<uint16_t> directGlyphs;
+        /// bitmaps of all the glyphs of the font, see FontGlyph::data
+        mutable std::unique_ptr<uint8_t[]> glyphAtlas;
+        /// kerning pairs sorted by the first and then by the second character
+        mutable std::vector<FontKerning> kerning;
         /// if the fallback font is set it is used in case of a glyph being unsupported in the primary font
         RawFont *fallback_font = nullptr;
         /// the glyph used when requested glyph is unsupported in the font (and the fallback font if one is set)
-        std::unique_ptr<FontGlyph> unsupported = nullptr;
+        mutable std::unique_ptr<FontGlyph> unsupported = nullptr;
+        mutable std::unique_ptr<uint8_t[]> unsupportedBitmap;
+
+        /// reads information about the font and offsets of its parts
+        gui::Status parseHeader(uint8_t *data);
+        /// loads glyphs and kerning from the data of the font file
+        void loadGlyphs(uint8_t *data) const;
+        /// reads glyphs from the font file if it wasn't done yet
+        void ensureGlyphsLoaded() const;
 
         /// set ellipsis on text in first parameter
         /// @note our UTF8 doesn't provide way to replace single character
@@ -116,11 +146,14 @@ namespace gui
         /**
          * @brief creates the glyph to be used in case of a requested glyph could not be found in a font
          */
-        void createGlyphUnsupported();
+        void createGlyphUnsupported() const;
 
         /// return glyph for selected code
         /// if code is not found - nullptr is returned
         FontGlyph *findGlyph(uint32_t id) const;
+        /// return glyph for selected code without loading glyphs
+        /// if code is not found - nullptr is returned
+        FontGlyph *lookupGlyph(uint32_t id) const;
         /// return glyph for selected code
         /// if code is not found - nullptr is returned
         FontGlyph *findGlyphFallback(uint32_t id) const;
@@ -10,24 +10,74 @@
 
 namespace gui
 {
+    namespace
+    {
+        bool isClear(const DrawCommandRecord &command)
+        {
+            return std::holds_alternative<Clear>(command);
+        }
+
+        /// Each command overlapping the area is redrawn as a whole, so the area has to be extended until it covers
+        /// all of them, otherwise commands drawn later but not redrawn would be overwritten.
+        BoundingBox extendToOverlappingCommands(const DrawCommandList &commands, BoundingBox area)
+        {
+            bool extended = true;
+            while (extended) {
+                extended = false;
+                for (const auto &record : commands) {
+                    if (isClear(record)) {
+                        continue;
+                    }
+                    const auto &cmd = getCommand(record);
+                    if (cmd.drawArea.overlaps(area) && !area.contains(cmd.drawArea)) {
+                        area     = BoundingBox::unite(area, cmd.drawArea);
+                        extended = true;
+                    }
+                }
+            }
+            return area;
+        }
+    } // namespace
+
     void Renderer::changeColorScheme(const std::unique_ptr<ColorScheme> &scheme)
     {
         renderer::PixelRenderer::updateColorScheme(scheme);
     }
 
-    void Renderer::render(Context *ctx, std::list<std::unique_ptr<DrawCommand>> &commands)
+    void Renderer::render(Context *ctx, const DrawCommandList &commands)
     {
         if (ctx == nullptr) {
             return;
         }
 
-        for (auto &cmd : commands) {
-            if (cmd == nullptr) {
-                continue;
-            }
+        for (const auto &record : commands) {
+            draw(record, ctx);
+        }
+    }
+
+    BoundingBox Renderer::render(Context *ctx, const DrawCommandList &commands, const BoundingBox &dirtyArea)
+    {
+        const BoundingBox contextArea{0, 0, ctx != nullptr ? ctx->getW() : 0U, ctx != nullptr ? ctx->getH() : 0U};
+        BoundingBox area;
+        if (!BoundingBox::intersect(contextArea, dirtyArea, area)) {
+            return {};
+        }
+        BoundingBox::intersect(contextArea, extendToOverlappingCommands(commands, area), area);
 
-            cmd->draw(ctx);
+        if (area == contextArea) {
+            render(ctx, commands);
+            return area;
+        }
+
+        for (const auto &record : commands) {
+            if (isClear(record)) {
+                ctx->fill(area, renderer::PixelRenderer::getColor(gui::ColorFullWhite.intensity));
+            }
+            else if (getCommand(record).drawArea.overlaps(area)) {
+                draw(record, ctx);
+            }
         }
+        return area;
     }
 
 } /* namespace gui */
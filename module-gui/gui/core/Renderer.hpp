@@ -3,11 +3,10 @@
 
 #pragma once
 
-#include <list>
-
 #include <Math.hpp>
 
 #include "DrawCommand.hpp"
+#include "DrawCommandList.hpp"
 #include "Context.hpp"
 #include "DrawCommandForward.hpp"
 
@@ -36,7 +35,10 @@ namespace gui
       public:
         virtual ~Renderer() = default;
 
-        void render(Context *ctx, std::list<std::unique_ptr<DrawCommand>> &commands);
+        void render(Context *ctx, const DrawCommandList &commands);
+        /// Renders only commands affecting dirtyArea on top of the frame already present in the context.
+        /// @return area which was actually re-rasterized: dirty area extended by all overlapping commands
+        BoundingBox render(Context *ctx, const DrawCommandList &commands, const BoundingBox &dirtyArea);
         void changeColorScheme(const std::unique_ptr<ColorScheme> &scheme);
     };
 
@@ -21,6 +21,7 @@ namespace gui
 
         // add empty vectors for all rows
         this->data = new uint8_t[height];
+        dataSize   = height;
         type       = Type::VECMAP;
 
         // no data provided - allocat buffer and clear it with white color
@@ -30,22 +31,25 @@ namespace gui
         }
     }
 
-    gui::Status VecMap::load(uint8_t *data, uint32_t size)
+    uint32_t VecMap::loadHeader(uint8_t *data)
     {
-
-        uint32_t offset = 0;
-
-        // read width and height of the image
-        memcpy(&width, data + offset, sizeof(uint16_t));
-        offset += sizeof(uint16_t);
-        memcpy(&height, data + offset, sizeof(uint16_t));
-        offset += sizeof(uint16_t);
+        auto offset = ImageMap::loadHeader(data);
         memcpy(&alphaColor, data + offset, sizeof(uint8_t));
         offset += sizeof(uint8_t);
 
-        this->data = new uint8_t[size - 2 * sizeof(uint16_t) - sizeof(uint8_t)];
-        if (this->data)
-            memcpy(this->data, data + offset, size - 2 * sizeof(uint16_t) - sizeof(uint8_t));
+        return offset;
+    }
+
+    gui::Status VecMap::load(uint8_t *data, uint32_t size)
+    {
+        const auto offset = loadHeader(data);
+
+        unload();
+        this->data = new uint8_t[size - offset];
+        if (this->data) {
+            memcpy(this->data, data + offset, size - offset);
+            dataSize = size - offset;
+        }
 
         return gui::Status::GUI_SUCCESS;
     }
@@ -19,6 +19,7 @@ namespace gui
         VecMap();
         VecMap(uint16_t w, uint16_t h, uint8_t *data);
         gui::Status load(uint8_t *data, uint32_t size = 0) override;
+        uint32_t loadHeader(uint8_t *data) override;
 
         uint8_t getAlphaColor()
         {
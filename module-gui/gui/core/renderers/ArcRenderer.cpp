@@ -4,6 +4,10 @@
 #include "ArcRenderer.hpp"
 #include "PixelRenderer.hpp"
 
+#include "Context.hpp"
+
+#include <optional>
+
 namespace gui::renderer
 {
     constexpr Length RadiusPrecisionLimit = 5;
@@ -52,6 +56,7 @@ namespace gui::renderer
             step = 0.001;
         }
 
+        const auto colour = PixelRenderer::getColor(color.intensity);
         double cosine, sine;
         for (double radians = start; radians <= end; radians += step) {
             cosine = std::cos(radians);
@@ -60,7 +65,7 @@ namespace gui::renderer
                 const auto r = radius - i;
                 const auto x = trigonometry::AdjacentSide::fromCosine(cosine, r);
                 const auto y = trigonometry::OppositeSide::fromSine(sine, r);
-                PixelRenderer::draw(ctx, Point(center.x + x, center.y + y), color);
+                ctx->fillSpan(Point(center.x + x, center.y + y), 1, colour);
             }
         }
     }
@@ -83,11 +88,17 @@ namespace gui::renderer
             step = 0.001;
         }
 
-        long int x, y;
+        const auto colour = PixelRenderer::getColor(color.intensity);
+        std::optional<Point> lastPoint;
         for (double radians = start; radians <= end; radians += step) {
-            x = trigonometry::AdjacentSide::fromAngle(radians, radius);
-            y = trigonometry::OppositeSide::fromAngle(radians, radius);
-            PixelRenderer::draw(ctx, Point(center.x + x, center.y + y), color);
+            const Point point(center.x + trigonometry::AdjacentSide::fromAngle(radians, radius),
+                              center.y + trigonometry::OppositeSide::fromAngle(radians, radius));
+            // Small steps hit the same pixel many times in a row.
+            if (lastPoint.has_value() && lastPoint->x == point.x && lastPoint->y == point.y) {
+                continue;
+            }
+            ctx->fillSpan(point, 1, colour);
+            lastPoint = point;
         }
     }
 } // namespace gui::renderer
@@ -6,6 +6,11 @@
 #include "ArcRenderer.hpp"
 #include "PixelRenderer.hpp"
 
+#include "Context.hpp"
+
+#include <algorithm>
+#include <cmath>
+
 namespace gui::renderer
 {
     auto CircleRenderer::DrawableStyle::from(const DrawCircle &command) -> DrawableStyle
@@ -26,14 +31,16 @@ namespace gui::renderer
     void CircleRenderer::draw(
         Context *ctx, Point center, Length radius, Color borderColor, Length borderWidth, Color fillColor)
     {
-        // First, fill the desired area.
-        const auto r  = static_cast<int>(radius);
-        const auto rr = r * r;
-        for (auto x = -r; x < r; ++x) {
-            const auto height = static_cast<int>(std::sqrt(rr - (x * x)));
-            for (auto y = -height; y < height; ++y) {
-                PixelRenderer::draw(ctx, Point(center.x + x, center.y + y), fillColor);
-            }
+        // First, fill the desired area, one row at a time.
+        const auto r      = static_cast<int>(radius);
+        const auto rr     = r * r;
+        const auto colour = PixelRenderer::getColor(fillColor.intensity);
+        for (auto y = -r; y < r; ++y) {
+            const auto distance  = std::max(y + 1, -y);
+            const auto halfWidth = static_cast<int>(std::sqrt(rr - (distance * distance)));
+            const auto left      = -halfWidth;
+            const auto right     = std::min(halfWidth, r - 1);
+            ctx->fillSpan(Point(center.x + left, center.y + y), right - left + 1, colour);
         }
 
         // Next, draw a border on top.
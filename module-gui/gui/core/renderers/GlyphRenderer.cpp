@@ -0,0 +1,103 @@
+// Copyright (c) 2017-2021, Mudita Sp. z.o.o. All rights reserved.
+// For licensing, see https://github.com/mudita/MuditaOS/LICENSE.md
+
+#include "GlyphRenderer.hpp"
+#include "PixelRenderer.hpp"
+
+#include "Context.hpp"
+#include "FontGlyph.hpp"
+
+#include <algorithm>
+#include <array>
+#include <cstring>
+
+namespace gui::renderer
+{
+    namespace
+    {
+        static_assert(__BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__, "Pixel masks assume little-endian byte order");
+
+        using PixelsBlock                  = std::uint64_t;
+        constexpr auto PixelsInBlock       = sizeof(PixelsBlock);
+        constexpr PixelsBlock ByteSpreader = 0x0101010101010101ULL;
+
+        /// Maps 8 bits of the glyph's bitmap onto a mask of 8 pixels of the context.
+        constexpr auto makePixelMasks() noexcept
+        {
+            std::array<PixelsBlock, 256> masks{};
+            for (std::size_t bits = 0; bits < masks.size(); ++bits) {
+                for (std::size_t pixel = 0; pixel < PixelsInBlock; ++pixel) {
+                    if ((bits & (1U << pixel)) != 0) {
+                        masks[bits] |= PixelsBlock{0xFF} << (pixel * 8);
+                    }
+                }
+            }
+            return masks;
+        }
+        constexpr auto pixelMasks = makePixelMasks();
+
+        /// Reads 8 bits of the bitmap's row starting from the given column.
+        inline auto readBits(const std::uint8_t *row, std::uint32_t stride, std::uint32_t column) noexcept
+            -> std::uint8_t
+        {
+            const auto byte    = column / 8;
+            const auto shift   = column % 8;
+            std::uint32_t bits = row[byte] >> shift;
+            if (shift != 0 && byte + 1 < stride) {
+                bits |= row[byte + 1] << (8 - shift);
+            }
+            return static_cast<std::uint8_t>(bits);
+        }
+
+        void drawRow(std::uint8_t *pixels,
+                     const std::uint8_t *row,
+                     std::uint32_t stride,
+                     std::uint32_t column,
+                     std::uint32_t endColumn,
+                     PixelsBlock colour) noexcept
+        {
+            for (; column + PixelsInBlock <= endColumn; column += PixelsInBlock, pixels += PixelsInBlock) {
+                const auto bits = readBits(row, stride, column);
+                if (bits == 0) {
+                    continue;
+                }
+                const auto mask = pixelMasks[bits];
+                PixelsBlock block;
+                std::memcpy(&block, pixels, sizeof(block));
+                block = (block & ~mask) | (colour & mask);
+                std::memcpy(pixels, &block, sizeof(block));
+            }
+            if (column < endColumn) {
+                const auto bits = readBits(row, stride, column);
+                for (std::uint32_t pixel = 0; pixel < endColumn - column; ++pixel) {
+                    if ((bits & (1U << pixel)) != 0) {
+                        pixels[pixel] = static_cast<std::uint8_t>(colour);
+                    }
+                }
+            }
+        }
+    } // namespace
+
+    void GlyphRenderer::draw(Context *ctx, Point topLeft, const FontGlyph &glyph, Color color)
+    {
+        if (glyph.data == nullptr) {
+            return;
+        }
+
+        const auto firstColumn = std::max<Position>(0, -topLeft.x);
+        const auto firstRow    = std::max<Position>(0, -topLeft.y);
+        const auto endColumn   = std::min<Position>(glyph.width, static_cast<Position>(ctx->getW()) - topLeft.x);
+        const auto endRow      = std::min<Position>(glyph.height, static_cast<Position>(ctx->getH()) - topLeft.y);
+        if (firstColumn >= endColumn || firstRow >= endRow) {
+            return;
+        }
+
+        const auto colour = ByteSpreader * PixelRenderer::getColor(color.intensity);
+        const auto stride = glyph.getBitmapStride();
+        auto pixels       = ctx->getData() + (topLeft.y + firstRow) * ctx->getW() + topLeft.x + firstColumn;
+        auto row          = glyph.data + firstRow * stride;
+        for (auto y = firstRow; y < endRow; ++y, pixels += ctx->getW(), row += stride) {
+            drawRow(pixels, row, stride, firstColumn, endColumn, colour);
+        }
+    }
+} // namespace gui::renderer
@@ -0,0 +1,28 @@
+// Copyright (c) 2017-2021, Mudita Sp. z.o.o. All rights reserved.
+// For licensing, see https://github.com/mudita/MuditaOS/LICENSE.md
+
+#pragma once
+
+#include "Color.hpp"
+#include "Common.hpp"
+
+namespace gui
+{
+    class Context;
+    class FontGlyph;
+} // namespace gui
+
+namespace gui::renderer
+{
+    class GlyphRenderer
+    {
+      public:
+        GlyphRenderer() = delete;
+
+        /**
+         * @brief Draws bitmap of the glyph with its top left corner placed at the given point.
+         * The glyph is clipped to the context once and written row by row, eight pixels at a time.
+         */
+        static void draw(Context *ctx, Point topLeft, const FontGlyph &glyph, Color color);
+    };
+} // namespace gui::renderer
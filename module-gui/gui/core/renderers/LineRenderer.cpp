@@ -7,6 +7,7 @@
 #include "Context.hpp"
 
 #include <cmath>
+#include <utility>
 
 namespace gui::renderer
 {
@@ -25,6 +26,15 @@ namespace gui::renderer
                 return penWidth * M_SQRT2;
             }
         }
+
+        /// Returns the first pixel and the number of pixels covered by the line of given signed length.
+        constexpr auto toSpan(Position start, Length length) noexcept -> std::pair<Position, Length>
+        {
+            if (const auto signedLength = static_cast<Position>(length); signedLength < 0) {
+                return {start + signedLength + 1, static_cast<Length>(-signedLength)};
+            }
+            return {start, length};
+        }
     } // namespace
 
     auto LineRenderer::DrawableStyle::from(const DrawLine &command) -> DrawableStyle
@@ -68,10 +78,10 @@ namespace gui::renderer
             return;
         }
 
-        for (Length i = 0; i < style.penWidth; ++i) {
-            const auto offset = (style.direction == LineExpansionDirection::Down) ? i : -i - 1;
-            draw(ctx, Point(start.x, start.y + offset), Point(start.x + width, start.y + offset), style.color);
-        }
+        const auto [x, length] = toSpan(start.x, width);
+        const auto penWidth    = static_cast<Position>(style.penWidth);
+        const auto y           = (style.direction == LineExpansionDirection::Down) ? start.y : start.y - penWidth;
+        ctx->fillRect(Point(x, y), length, style.penWidth, PixelRenderer::getColor(style.color.intensity));
     }
 
     void LineRenderer::drawVertical(Context *ctx, Point start, Length height, const DrawableStyle &style)
@@ -83,10 +93,10 @@ namespace gui::renderer
             return;
         }
 
-        for (Length i = 0; i < style.penWidth; ++i) {
-            const auto offset = (style.direction == LineExpansionDirection::Right) ? i : -i - 1;
-            draw(ctx, Point(start.x + offset, start.y), Point(start.x + offset, start.y + height), style.color);
-        }
+        const auto [y, length] = toSpan(start.y, height);
+        const auto penWidth    = static_cast<Position>(style.penWidth);
+        const auto x           = (style.direction == LineExpansionDirection::Right) ? start.x : start.x - penWidth;
+        ctx->fillRect(Point(x, y), style.penWidth, length, PixelRenderer::getColor(style.color.intensity));
     }
 
     void LineRenderer::draw45deg(Context *ctx, Point start, Length length, const DrawableStyle &style, bool toRight)
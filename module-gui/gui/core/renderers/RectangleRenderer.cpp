@@ -9,23 +9,10 @@
 
 #include "Context.hpp"
 
-#include <queue>
+#include <vector>
 
 namespace gui::renderer
 {
-    namespace
-    {
-        std::uint8_t getPixelColor(Context *ctx, const Point &point, std::uint8_t defaultColor)
-        {
-            const auto contextWidth = ctx->getW();
-            const auto position     = point.y * contextWidth + point.x;
-            if (!ctx->addressInData(ctx->getData() + position)) {
-                return defaultColor;
-            }
-            return *(ctx->getData() + position);
-        }
-    } // namespace
-
     auto RectangleRenderer::DrawableStyle::from(const DrawRectangle &command) -> DrawableStyle
     {
         return DrawableStyle{command.penWidth,
@@ -50,12 +37,10 @@ namespace gui::renderer
 
     void RectangleRenderer::fillFlatRectangle(Context *ctx, Point position, Length width, Length height, Color color)
     {
-        for (unsigned int y = 1; y <= height; ++y) {
-            LineRenderer::drawHorizontal(ctx,
-                                         Point(position.x, position.y + y),
-                                         width,
-                                         LineRenderer::DrawableStyle{1, color, LineExpansionDirection::Up});
+        if (color.alpha == Color::FullTransparent) {
+            return;
         }
+        ctx->fillRect(position, width, height, PixelRenderer::getColor(color.intensity));
     }
 
     void RectangleRenderer::drawSides(
@@ -177,23 +162,46 @@ namespace gui::renderer
 
     void RectangleRenderer::fill(Context *ctx, Point startPosition, Color borderColor, Color fillColor)
     {
-        std::queue<Point> q;
-        q.push(startPosition);
-
-        while (!q.empty()) {
-            const auto currPoint = q.front();
-            q.pop();
-            if (const auto color = getPixelColor(ctx, currPoint, PixelRenderer::getColor(borderColor.intensity));
-                color == PixelRenderer::getColor(borderColor.intensity) ||
-                color == PixelRenderer::getColor(fillColor.intensity)) {
+        const auto border = PixelRenderer::getColor(borderColor.intensity);
+        const auto colour = PixelRenderer::getColor(fillColor.intensity);
+        const auto width  = static_cast<Position>(ctx->getW());
+        const auto height = static_cast<Position>(ctx->getH());
+        const auto pixels = ctx->getData();
+        auto isFillable   = [=](Position x, Position y) {
+            const auto pixel = pixels[y * width + x];
+            return pixel != border && pixel != colour;
+        };
+
+        // Scanline flood fill: each seed is expanded into the longest span and filled at once. The rows above and
+        // below the span are searched for the beginnings of next spans.
+        std::vector<Point> seeds{startPosition};
+        while (!seeds.empty()) {
+            const auto seed = seeds.back();
+            seeds.pop_back();
+            if (seed.x < 0 || seed.y < 0 || seed.x >= width || seed.y >= height || !isFillable(seed.x, seed.y)) {
                 continue;
             }
 
-            PixelRenderer::draw(ctx, currPoint, fillColor);
-            q.push(Point{currPoint.x + 1, currPoint.y});
-            q.push(Point{currPoint.x - 1, currPoint.y});
-            q.push(Point{currPoint.x, currPoint.y + 1});
-            q.push(Point{currPoint.x, currPoint.y - 1});
+            auto left = seed.x;
+            while (left > 0 && isFillable(left - 1, seed.y)) {
+                --left;
+            }
+            auto right = seed.x + 1;
+            while (right < width && isFillable(right, seed.y)) {
+                ++right;
+            }
+            ctx->fillSpan(Point(left, seed.y), right - left, colour);
+
+            for (const auto y : {seed.y - 1, seed.y + 1}) {
+                if (y < 0 || y >= height) {
+                    continue;
+                }
+                for (auto x = left; x < right; ++x) {
+                    if (isFillable(x, y) && (x == left || !isFillable(x - 1, y))) {
+                        seeds.emplace_back(x, y);
+                    }
+                }
+            }
         }
     }
 
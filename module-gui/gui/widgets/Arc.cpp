@@ -3,7 +3,7 @@
 
 #include <log/log.hpp>
 #include "Arc.hpp"
-#include "DrawCommand.hpp"
+#include "DrawCommandList.hpp"
 
 namespace gui
 {
@@ -87,11 +87,13 @@ namespace gui
     void Arc::setCenter(Point point) noexcept
     {
         center = point;
+        markDirty();
     }
 
     void Arc::setSweepAngle(trigonometry::Degrees angle) noexcept
     {
         sweep = angle;
+        markDirty();
     }
 
     trigonometry::Degrees Arc::getSweepAngle() const noexcept
@@ -104,14 +106,12 @@ namespace gui
         return start;
     }
 
-    void Arc::buildDrawListImplementation(std::list<Command> &commands)
+    void Arc::buildDrawListImplementation(DrawCommandList &commands)
     {
-        auto arc   = std::make_unique<DrawArc>(center, radius, start, sweep, focus ? focusPenWidth : penWidth, color);
-        arc->areaX = widgetArea.x;
-        arc->areaY = widgetArea.y;
-        arc->areaW = widgetArea.w;
-        arc->areaH = widgetArea.h;
-
-        commands.emplace_back(std::move(arc));
+        auto &arc = commands.emplace<DrawArc>(center, radius, start, sweep, focus ? focusPenWidth : penWidth, color);
+        arc.areaX = widgetArea.x;
+        arc.areaY = widgetArea.y;
+        arc.areaW = widgetArea.w;
+        arc.areaH = widgetArea.h;
     }
 } // namespace gui
@@ -47,7 +47,7 @@ namespace gui
         trigonometry::Degrees getSweepAngle() const noexcept;
         trigonometry::Degrees getStartAngle() const noexcept;
 
-        void buildDrawListImplementation(std::list<Command> &commands) override;
+        void buildDrawListImplementation(DrawCommandList &commands) override;
 
       protected:
         Arc(Item *parent,
@@ -107,7 +107,7 @@ namespace gui
 
     void BoxLayout::setVisible(bool value, bool previous)
     {
-        visible = value; // maybe use parent setVisible(...)? would be better but which one?
+        Item::setVisible(value);
         if (value == true) {
             resizeItems();         // move items in box in proper places
             setNavigation();       // set navigation through kids -> TODO handle out of last/first to parent
@@ -182,7 +182,7 @@ namespace gui
     {
         if (it->visible) {
             outOfDrawAreaItems.push_back(it);
-            it->visible = false;
+            it->Item::setVisible(false);
         }
     }
 
@@ -40,7 +40,7 @@ namespace gui
 
         Circle(Item *parent, const Circle::ShapeParams &params);
 
-        void buildDrawListImplementation(std::list<Command> &commands) override;
+        void buildDrawListImplementation(DrawCommandList &commands) override;
 
       private:
         Circle(Item *parent,
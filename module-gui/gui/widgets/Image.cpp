@@ -2,7 +2,7 @@
 // For licensing, see https://github.com/mudita/MuditaOS/LICENSE.md
 
 #include "Image.hpp"
-#include "DrawCommand.hpp"
+#include "DrawCommandList.hpp"
 #include "BoundingBox.hpp"
 #include "ImageManager.hpp"
 
@@ -47,6 +47,7 @@ namespace gui
         }
 
         imageMap = map;
+        markDirty();
         auto w   = imageMap->getWidth();
         auto h   = imageMap->getHeight();
         setMinimumWidth(w);
@@ -65,24 +66,22 @@ namespace gui
         set(id);
     }
 
-    void Image::buildDrawListImplementation(std::list<Command> &commands)
+    void Image::buildDrawListImplementation(DrawCommandList &commands)
     {
         if (imageMap == nullptr) {
             LOG_ERROR("Unable to draw the image: ImageMap does not exist.");
             return;
         }
 
-        auto img = std::make_unique<DrawImage>();
+        auto &img = commands.emplace<DrawImage>();
         // image
-        img->origin = {drawArea.x, drawArea.y};
+        img.origin = {drawArea.x, drawArea.y};
         // cmd part
-        img->areaX   = img->origin.x;
-        img->areaY   = img->origin.y;
-        img->areaW   = drawArea.w;
-        img->areaH   = drawArea.h;
-        img->imageID = this->imageMap->getID();
-
-        commands.emplace_back(std::move(img));
+        img.areaX   = img.origin.x;
+        img.areaY   = img.origin.y;
+        img.areaW   = drawArea.w;
+        img.areaH   = drawArea.h;
+        img.imageID = this->imageMap->getID();
     }
 
     void Image::accept(GuiVisitor &visitor)
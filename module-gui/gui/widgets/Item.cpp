@@ -8,7 +8,8 @@
 #include <algorithm>       // for find
 #include <list>            // for list<>::iterator, list, operator!=, _List...
 #include <memory>
-#include <DrawCommand.hpp>
+#include <utility>
+#include <DrawCommandList.hpp>
 namespace gui
 {
 
@@ -79,6 +80,7 @@ namespace gui
         }
         item->parent = this;
         children.push_back(item);
+        item->markChanged();
 
         item->updateDrawArea();
     }
@@ -94,7 +96,9 @@ namespace gui
         auto fi = std::find(children.begin(), children.end(), item);
         if (fi != children.end()) {
             children.erase(fi);
-            item->parent = nullptr;
+            item->parent     = nullptr;
+            item->cachedList = nullptr;
+            markDirty();
             return true;
         }
         return false;
@@ -102,40 +106,114 @@ namespace gui
 
     void Item::setVisible(bool value)
     {
-        visible = value;
+        if (visible != value) {
+            visible = value;
+            markChanged();
+        }
     }
 
-    std::list<Command> Item::buildDrawList()
+    void Item::markDirty() noexcept
     {
-        if (not visible) {
-            return {};
-        }
-        auto commands = std::list<Command>();
-        if (preBuildDrawListHook != nullptr) {
-            preBuildDrawListHook(commands);
+        dirty = true;
+        markChanged();
+    }
+
+    void Item::markChanged() noexcept
+    {
+        for (auto item = this; item != nullptr; item = item->parent) {
+            ++item->generation;
         }
-        buildDrawListImplementation(commands);
-        buildChildrenDrawList(commands);
-        if (postBuildDrawListHook != nullptr) {
-            postBuildDrawListHook(commands);
+    }
+
+    BoundingBox Item::takeDirtyArea()
+    {
+        return std::exchange(dirtyArea, BoundingBox{});
+    }
+
+    void Item::collectDirtyArea()
+    {
+        const auto currentArea = visible ? drawArea : BoundingBox{};
+        if (dirty || currentArea != lastDrawArea) {
+            auto root = this;
+            while (root->parent != nullptr) {
+                root = root->parent;
+            }
+            root->dirtyArea = BoundingBox::unite(root->dirtyArea, BoundingBox::unite(lastDrawArea, currentArea));
         }
+        dirty        = false;
+        lastDrawArea = currentArea;
+    }
+
+    DrawCommandList Item::buildDrawList()
+    {
+        DrawCommandList commands;
+        appendDrawList(commands, {&retainedDrawList, true, 0, 0});
+        // list built is retained as it is, the one handed out is its copy made in buffers of the previous one
+        std::swap(retainedDrawList, commands);
+        commands.clear();
+        commands.append(retainedDrawList, 0, retainedDrawList.size());
         return commands;
     }
 
-    void Item::buildChildrenDrawList(std::list<Command> &commands)
+    void Item::appendDrawList(DrawCommandList &commands, const PreviousDrawList &previous)
     {
-        for (auto widget : children) {
-            auto drawCommands = widget->buildDrawList();
-            if (!drawCommands.empty()) {
-                commands.splice(commands.end(), drawCommands);
+        const auto first = commands.size();
+        // commands of the item are in previous list only if parent's commands are and were built for the same list
+        const auto previousFound = previous.found && cachedList == previous.list;
+        const auto previousFirst = previous.parentFirst + cachedOffset;
+        cachedList               = previous.list;
+        cachedOffset             = first - previous.newParentFirst;
+
+        if (previousFound && cacheable && cachedGeneration == generation &&
+            previousFirst + cachedSize <= previous.list->size()) {
+            // nothing changed in whole subtree, so there is no dirty area to collect either
+            commands.append(*previous.list, previousFirst, previousFirst + cachedSize);
+            return;
+        }
+
+        cacheable = preBuildDrawListHook == nullptr && postBuildDrawListHook == nullptr;
+        if (not visible) {
+            collectDirtyArea();
+        }
+        else {
+            if (preBuildDrawListHook != nullptr) {
+                preBuildDrawListHook(commands);
+            }
+            collectDirtyArea();
+            const auto ownFirst = commands.size();
+            buildDrawListImplementation(commands);
+            for (auto i = ownFirst; i < commands.size(); ++i) {
+                getCommand(commands[i]).drawArea = drawArea;
+            }
+            // children weren't built last time if item was hidden
+            buildChildrenDrawList(commands, {previous.list, previousFound && cachedVisible, previousFirst, first});
+            if (postBuildDrawListHook != nullptr) {
+                postBuildDrawListHook(commands);
+                for (auto i = commands.size(); i > ownFirst && getCommand(commands[i - 1]).drawArea.isEmpty(); --i) {
+                    getCommand(commands[i - 1]).drawArea = drawArea;
+                }
             }
         }
+        cachedGeneration = generation;
+        cachedVisible    = visible;
+        cachedSize       = commands.size() - first;
+    }
+
+    void Item::buildChildrenDrawList(DrawCommandList &commands, const PreviousDrawList &previous)
+    {
+        for (auto widget : children) {
+            widget->appendDrawList(commands, previous);
+            cacheable = cacheable && widget->cacheable;
+        }
     }
 
     void Item::setArea(BoundingBox area)
     {
         BoundingBox oldArea = widgetArea;
-        widgetArea          = area;
+        if (area != oldArea) {
+            markChanged();
+        }
+        widgetArea = area;
         widgetMaximumArea.sum(widgetArea);
         contentChanged = false;
         updateDrawArea();
@@ -392,7 +470,10 @@ namespace gui
     void Item::setBoundingBox(const BoundingBox &new_box)
     {
         BoundingBox oldArea = widgetArea;
-        widgetArea          = new_box;
+        if (new_box != oldArea) {
+            markChanged();
+        }
+        widgetArea = new_box;
         updateDrawArea();
         onDimensionChanged(oldArea, widgetArea);
     }
@@ -400,6 +481,7 @@ namespace gui
     void Item::setRadius(int value)
     {
         radius = std::abs(value);
+        markDirty();
     }
 
     void Item::updateDrawArea()
@@ -423,7 +505,10 @@ namespace gui
             parentItem = parentItem->parent;
         }
 
-        drawArea = result;
+        if (result != drawArea) {
+            drawArea = result;
+            markChanged();
+        }
 
         for (gui::Item *it : children)
             it->updateDrawArea();
@@ -474,6 +559,7 @@ namespace gui
     {
         if (state != focus) {
             focus = state;
+            markDirty();
             onFocus(state);
             if (focusChangedCallback)
                 focusChangedCallback(*this);
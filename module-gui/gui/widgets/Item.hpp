@@ -14,7 +14,7 @@
 #include <list>                 // for list
 #include <memory>               // for unique_ptr
 #include <utility>              // for move
-#include <core/DrawCommandForward.hpp>
+#include <core/DrawCommandList.hpp>
 #include <module-gui/gui/widgets/visitor/GuiVisitor.hpp>
 #include <Timers/Timer.hpp>
 
@@ -107,6 +107,8 @@ namespace gui
         /// @note if false -> than it shouldn't be used with onInput, navigation etc.
         bool activeItem = true;
         /// flag that defines whether widget is visible (this is - should be rendered)
+        /// @note use setVisible() or call markDirty() after changing it directly, otherwise cached draw commands of
+        /// the parent would be reused
         bool visible;
         /// policy for changing vertical size if Item is placed inside layout.
         LayoutVerticalPolicy verticalPolicy;
@@ -294,25 +296,38 @@ namespace gui
         virtual void setSize(Length w, Length h);
         void setSize(Length val, Axis axis);
         virtual void setBoundingBox(const BoundingBox &new_box);
+        /// mark item as changed so that its area would be redrawn and its draw commands rebuilt on next render
+        /// @note has to be called on every change affecting draw commands of the item, as draw commands of unchanged
+        /// items are reused from previous draw list
+        /// @note changes of position, size and visibility are detected by item itself, there is no need to call it
+        /// for them
+        void markDirty() noexcept;
+        /// gets area (in window coordinates) which changed since the previous call, gathered while building draw list
+        /// @note gathered only in top-most item in hierarchy
+        BoundingBox takeDirtyArea();
+
         /// entry function to create commands to execute in renderer to draw on screen
-        /// @note we should consider lazy evaluation prior to drawing on screen, rather than on each resize of elements
+        /// @note commands of subtrees which didn't change since previous call are copied from previous list instead
+        /// of being built again, subtrees containing items with build hooks are always built
         /// @return list of commands for renderer to draw elements on screen
-        virtual std::list<Command> buildDrawList() final;
+        virtual DrawCommandList buildDrawList() final;
         /// Implementation of DrawList per Item to be drawn on screen
         /// This is called from buildDrawList before children elements are added
         /// should be = 0;
         /// @param : commands list of commands for renderer to draw elements on screen
-        virtual void buildDrawListImplementation(std::list<Command> &commands)
+        virtual void buildDrawListImplementation(DrawCommandList &commands)
         {}
 
         /// pre hook function, if set it is executed before building draw command
         /// at Item::buildDrawListImplementation()
+        /// @note hooks have to be set before draw list is built for the first time, as items without hooks reuse
+        /// their draw commands
         /// @param `commandlist` : commands list of commands for renderer to draw elements on screen
-        std::function<void(std::list<Command> &)> preBuildDrawListHook = nullptr;
+        std::function<void(DrawCommandList &)> preBuildDrawListHook = nullptr;
         /// post hook function, if set it is executed after building draw command
         /// at Item::buildDrawListImplementation()
         /// @param `commandlist` : commands list of commands for renderer to draw elements on screen
-        std::function<void(std::list<Command> &)> postBuildDrawListHook = nullptr;
+        std::function<void(DrawCommandList &)> postBuildDrawListHook = nullptr;
         /// sets radius for item edges
         /// @note this should be moved to Rect
         virtual void setRadius(int value);
@@ -400,16 +415,56 @@ namespace gui
         virtual void accept(GuiVisitor &visitor);
 
       protected:
+        /// draw list built last time, with position of commands of the parent in it and in the list being built
+        struct PreviousDrawList
+        {
+            const DrawCommandList *list;
+            /// flag informing that commands of the parent are in the list
+            bool found;
+            std::size_t parentFirst;
+            std::size_t newParentFirst;
+        };
+
         /// On change of position or size this method will recalculate visible part of the widget
         /// considering widgets hierarchy and calculate absolute position of drawing primitives.
         virtual void updateDrawArea();
         /// builds draw commands for all of item's children
         /// @param `commandlist` : commands list of commands for renderer to draw elements on screen
-        virtual void buildChildrenDrawList(std::list<Command> &commands) final;
+        /// @param `previous` : draw list built last time, commands of unchanged children are copied from it
+        virtual void buildChildrenDrawList(DrawCommandList &commands, const PreviousDrawList &previous) final;
         /// Pointer to navigation object. It is added when object is set for one of the directions
         gui::Navigation *navigationDirections = nullptr;
 
       private:
+        /// appends draw commands of the item and its children to the list, copying them from previous list if the
+        /// item and its children didn't change since it was built
+        void appendDrawList(DrawCommandList &commands, const PreviousDrawList &previous);
+        /// marks item and all its parents as changed, so that their cached draw commands are not reused
+        void markChanged() noexcept;
+        /// reports area of item to top-most item if it changed since draw list was built last time
+        void collectDirtyArea();
+
+        /// flag informing that item changed since draw list was built last time
+        bool dirty = true;
+        /// counter of changes of the item and its children
+        std::uint32_t generation = 1;
+        /// value of `generation` when draw commands of the item were cached
+        std::uint32_t cachedGeneration = 0;
+        /// flag informing that neither item nor any of its children has build hooks, so its commands can be reused
+        bool cacheable = false;
+        /// flag informing that item was visible when its draw commands were cached
+        bool cachedVisible = false;
+        /// list in which draw commands of the item and its children were cached
+        const DrawCommandList *cachedList = nullptr;
+        /// position of cached commands relative to the first command of the parent, and their number
+        std::size_t cachedOffset = 0;
+        std::size_t cachedSize   = 0;
+        /// draw list built last time, stored in top-most item only
+        DrawCommandList retainedDrawList;
+        /// area (in window coordinates) occupied by item when draw list was built last time
+        BoundingBox lastDrawArea;
+        /// area (in window coordinates) changed in whole hierarchy, stored in top-most item only
+        BoundingBox dirtyArea;
         /// list of attached timers to item.
         std::list<sys::Timer *> timers;
     };
@@ -4,7 +4,7 @@
 #include <log/log.hpp>
 #include "utf8/UTF8.hpp"
 
-#include "../core/DrawCommand.hpp"
+#include "../core/DrawCommandList.hpp"
 
 #include "Label.hpp"
 #include <Style.hpp>
@@ -48,6 +48,7 @@ namespace gui
             LOG_ERROR("No font loaded!");
             return;
         }
+        markDirty();
         charDrawableCount = font->getCharCountInSpace(text, availableSpace);
         textArea.w        = font->getPixelWidth(text.substr(0, charDrawableCount));
         textDisplayed     = text;
@@ -217,27 +218,26 @@ namespace gui
         calculateDisplayText();
     }
 
-    void Label::buildDrawListImplementation(std::list<Command> &commands)
+    void Label::buildDrawListImplementation(DrawCommandList &commands)
     {
         Rect::buildDrawListImplementation(commands);
         if (font != nullptr) {
-            auto cmd    = std::make_unique<DrawText>();
-            cmd->str    = textDisplayed;
-            cmd->fontID = font->id;
-            cmd->color  = textColor;
-
-            cmd->origin     = {drawArea.x, drawArea.y};
-            cmd->width      = drawArea.w;
-            cmd->height     = drawArea.h;
-            cmd->textOrigin = {textArea.x, textArea.y};
-            cmd->textHeight = textArea.h;
-
-            cmd->areaX = widgetArea.x;
-            cmd->areaY = widgetArea.y;
-            cmd->areaW = widgetArea.w;
-            cmd->areaH = widgetArea.h;
-
-            commands.emplace_back(std::move(cmd));
+            const auto text = commands.storeText(textDisplayed.c_str());
+            auto &cmd       = commands.emplace<DrawText>();
+            cmd.str         = text;
+            cmd.fontID      = font->id;
+            cmd.color       = textColor;
+
+            cmd.origin     = {drawArea.x, drawArea.y};
+            cmd.width      = drawArea.w;
+            cmd.height     = drawArea.h;
+            cmd.textOrigin = {textArea.x, textArea.y};
+            cmd.textHeight = textArea.h;
+
+            cmd.areaX = widgetArea.x;
+            cmd.areaY = widgetArea.y;
+            cmd.areaW = widgetArea.w;
+            cmd.areaH = widgetArea.h;
         }
     }
 
@@ -269,6 +269,7 @@ namespace gui
     void Label::setTextColor(Color color)
     {
         textColor = color;
+        markDirty();
     }
 
     uint32_t Label::getTextNeedSpace(const UTF8 &_text) const noexcept
@@ -125,7 +125,7 @@ namespace gui
         void setFont(RawFont *font);
         RawFont *getFont() const noexcept;
         // virtual methods
-        void buildDrawListImplementation(std::list<Command> &commands) override;
+        void buildDrawListImplementation(DrawCommandList &commands) override;
         uint32_t getTextNeedSpace(const UTF8 &text = "") const noexcept;
         /// line: height
         uint32_t getTextHeight() const noexcept;
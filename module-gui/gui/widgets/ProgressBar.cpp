@@ -33,11 +33,13 @@ namespace gui
         if (currentValue > maxValue) {
             currentValue = maxValue;
         }
+        markDirty();
     }
 
     bool ProgressBar::setValue(unsigned int value) noexcept
     {
         currentValue = std::clamp(value, 0U, maxValue);
+        markDirty();
         return currentValue == value;
     }
 
@@ -52,7 +54,7 @@ namespace gui
         return maxValue;
     }
 
-    void ProgressBar::buildDrawListImplementation(std::list<Command> &commands)
+    void ProgressBar::buildDrawListImplementation(DrawCommandList &commands)
     {
         uint32_t progressSize = maxValue == 0U ? 0 : (currentValue * widgetArea.w) / maxValue;
         drawArea.w            = progressSize;
@@ -108,11 +110,13 @@ namespace gui
         if (currentValue > maxValue) {
             currentValue = maxValue;
         }
+        markDirty();
     }
 
     bool CircularProgressBar::setValue(unsigned int value) noexcept
     {
         currentValue = std::clamp(value, 0U, maxValue);
+        markDirty();
         return value == currentValue;
     }
 
@@ -135,7 +139,7 @@ namespace gui
         return static_cast<float>(currentValue) / maxValue;
     }
 
-    void CircularProgressBar::buildDrawListImplementation(std::list<Command> &commands)
+    void CircularProgressBar::buildDrawListImplementation(DrawCommandList &commands)
     {
         using namespace trigonometry;
 
@@ -9,7 +9,7 @@
  */
 
 #include "../core/BoundingBox.hpp"
-#include "../core/DrawCommand.hpp"
+#include "../core/DrawCommandList.hpp"
 
 #include "Rect.hpp"
 #include "Style.hpp"
@@ -42,33 +42,40 @@ namespace gui
     void Rect::setBorderColor(const Color &color)
     {
         borderColor = color;
+        markDirty();
     }
     void Rect::setPenWidth(uint8_t width)
     {
         penWidth = width;
+        markDirty();
     }
     void Rect::setPenFocusWidth(uint8_t width)
     {
         penFocusWidth = width;
+        markDirty();
     }
 
     void Rect::setEdges(RectangleEdge edges)
     {
         this->edges = edges;
+        markDirty();
     }
     void Rect::setCorners(RectangleRoundedCorner corners)
     {
         this->corners = corners;
+        markDirty();
     }
 
     void Rect::setFlat(RectangleFlatEdge flats)
     {
         flatEdges = flats;
+        markDirty();
     }
 
     void Rect::setFilled(bool val)
     {
         filled = val;
+        markDirty();
     }
 
     void Rect::setYaps(RectangleYap yaps)
@@ -86,42 +93,42 @@ namespace gui
         else {
             padding.right = 0;
         }
+        markDirty();
     }
 
     void Rect::setYapSize(unsigned short value)
     {
         yapSize = value;
+        markDirty();
     }
 
-    void Rect::buildDrawListImplementation(std::list<Command> &commands)
+    void Rect::buildDrawListImplementation(DrawCommandList &commands)
     {
-        auto rect = std::make_unique<DrawRectangle>();
-
-        rect->origin    = {drawArea.x, drawArea.y};
-        rect->width     = drawArea.w;
-        rect->height    = drawArea.h;
-        rect->areaX     = widgetArea.x;
-        rect->areaY     = widgetArea.y;
-        rect->areaW     = widgetArea.w;
-        rect->areaH     = widgetArea.h;
-        rect->corners   = corners;
-        rect->flatEdges = this->flatEdges;
-        rect->edges     = edges;
-        rect->yaps      = yaps;
-        rect->yapSize   = yapSize;
-        rect->radius    = radius;
+        auto &rect = commands.emplace<DrawRectangle>();
+
+        rect.origin    = {drawArea.x, drawArea.y};
+        rect.width     = drawArea.w;
+        rect.height    = drawArea.h;
+        rect.areaX     = widgetArea.x;
+        rect.areaY     = widgetArea.y;
+        rect.areaW     = widgetArea.w;
+        rect.areaH     = widgetArea.h;
+        rect.corners   = corners;
+        rect.flatEdges = this->flatEdges;
+        rect.edges     = edges;
+        rect.yaps      = yaps;
+        rect.yapSize   = yapSize;
+        rect.radius    = radius;
         if (focus) {
-            rect->penWidth = penFocusWidth;
+            rect.penWidth = penFocusWidth;
         }
         else {
-            rect->penWidth = penWidth;
+            rect.penWidth = penWidth;
         }
 
-        rect->filled      = filled;
-        rect->borderColor = borderColor;
-        rect->fillColor   = fillColor;
-
-        commands.emplace_back(std::move(rect));
+        rect.filled      = filled;
+        rect.borderColor = borderColor;
+        rect.fillColor   = fillColor;
     }
 
     void Rect::accept(GuiVisitor &visitor)
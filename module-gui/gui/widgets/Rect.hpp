@@ -50,7 +50,7 @@ namespace gui
         virtual void setYaps(RectangleYap yaps);
         virtual void setYapSize(unsigned short value);
         void setFilled(bool val);
-        void buildDrawListImplementation(std::list<Command> &commands) override;
+        void buildDrawListImplementation(DrawCommandList &commands) override;
 
         void accept(GuiVisitor &visitor) override;
     };
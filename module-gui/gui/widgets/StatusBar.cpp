@@ -115,7 +115,7 @@ namespace gui::status_bar
         setAlignment(Alignment(Alignment::Horizontal::Center));
         updateDrawArea();
 
-        preBuildDrawListHook = [this](std::list<Command> &) { updateTime(); };
+        preBuildDrawListHook = [this](DrawCommandList &) { updateTime(); };
     }
 
     void StatusBar::prepareWidget()
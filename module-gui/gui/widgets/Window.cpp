@@ -11,7 +11,7 @@
 // gui
 #include "../Common.hpp"
 #include "../core/BoundingBox.hpp"
-#include "../core/DrawCommand.hpp"
+#include "../core/DrawCommandList.hpp"
 #include "Window.hpp"
 #include <InputEvent.hpp>
 
@@ -39,10 +39,9 @@ namespace gui
         return false;
     }
 
-    void Window::buildDrawListImplementation(std::list<Command> &commands)
+    void Window::buildDrawListImplementation(DrawCommandList &commands)
     {
-        auto clearCommand = std::make_unique<Clear>();
-        commands.emplace_back(std::move(clearCommand));
+        commands.emplace<Clear>();
     }
 
     bool Window::onInput(const InputEvent &inputEvent)
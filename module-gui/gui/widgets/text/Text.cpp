@@ -54,7 +54,7 @@ namespace gui
         setBorderColor(gui::ColorFullBlack);
         setEdges(RectangleEdge::All);
 
-        preBuildDrawListHook = [this](std::list<Command> &commands) { preBuildDrawListHookImplementation(commands); };
+        preBuildDrawListHook = [this](DrawCommandList &commands) { preBuildDrawListHookImplementation(commands); };
     }
 
     Text::Text() : Text(nullptr, 0, 0, 0, 0)
@@ -409,7 +409,7 @@ namespace gui
         }
     }
 
-    void Text::preBuildDrawListHookImplementation(std::list<Command> &commands)
+    void Text::preBuildDrawListHookImplementation(DrawCommandList &commands)
     {
         // we can't build elements to show just before showing.
         // why? because we need to know if these elements fit in
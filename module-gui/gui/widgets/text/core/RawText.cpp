@@ -2,7 +2,7 @@
 // For licensing, see https://github.com/mudita/MuditaOS/LICENSE.md
 
 #include "RawText.hpp"
-#include <DrawCommand.hpp>
+#include <DrawCommandList.hpp>
 #include <TextConstants.hpp>
 
 namespace gui
@@ -27,27 +27,26 @@ namespace gui
         return textToDraw;
     }
 
-    void RawText::buildDrawListImplementation(std::list<Command> &commands)
+    void RawText::buildDrawListImplementation(DrawCommandList &commands)
     {
         if (font) {
-            auto cmd = std::make_unique<DrawText>();
-
-            cmd->str    = stripNewlineToDraw();
-            cmd->fontID = font->id;
-            cmd->color  = color;
-
-            cmd->origin     = {drawArea.x, drawArea.y};
-            cmd->width      = drawArea.w;
-            cmd->height     = drawArea.h;
-            cmd->textOrigin = {0, static_cast<Position>(this->font->info.base)};
-            cmd->textHeight = widgetArea.h;
-
-            cmd->areaX = widgetArea.x;
-            cmd->areaY = widgetArea.y;
-            cmd->areaW = widgetArea.w;
-            cmd->areaH = widgetArea.h;
-
-            commands.emplace_back(std::move(cmd));
+            const auto text = commands.storeText(stripNewlineToDraw().c_str());
+            auto &cmd       = commands.emplace<DrawText>();
+
+            cmd.str    = text;
+            cmd.fontID = font->id;
+            cmd.color  = color;
+
+            cmd.origin     = {drawArea.x, drawArea.y};
+            cmd.width      = drawArea.w;
+            cmd.height     = drawArea.h;
+            cmd.textOrigin = {0, static_cast<Position>(this->font->info.base)};
+            cmd.textHeight = widgetArea.h;
+
+            cmd.areaX = widgetArea.x;
+            cmd.areaY = widgetArea.y;
+            cmd.areaW = widgetArea.w;
+            cmd.areaH = widgetArea.h;
         }
     }
 
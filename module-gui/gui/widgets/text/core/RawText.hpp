@@ -37,6 +37,6 @@ namespace gui
             return font;
         }
 
-        void buildDrawListImplementation(std::list<Command> &commands) override;
+        void buildDrawListImplementation(DrawCommandList &commands) override;
     };
 } // namespace gui
@@ -8,6 +8,8 @@
 #include <module-gui/gui/core/Context.hpp>
 #include <log/log.hpp>
 
+#include <algorithm>
+
 TEST_CASE("test context size and position")
 {
     auto ctx = new gui::Context(30, 30);
@@ -83,3 +85,65 @@ TEST_CASE("insertContextTest")
         delete insCtx;
     }
 }
+
+TEST_CASE("Context span primitives")
+{
+    constexpr std::uint16_t width  = 10;
+    constexpr std::uint16_t height = 6;
+    gui::Context ctx{width, height};
+    ctx.fill(0);
+
+    auto pixel = [&ctx](gui::Position x, gui::Position y) { return ctx.getData()[y * ctx.getW() + x]; };
+    auto count = [&ctx](std::uint8_t colour) {
+        return std::count(ctx.getData(), ctx.getData() + ctx.getW() * ctx.getH(), colour);
+    };
+
+    SECTION("Fill span clipped to the context")
+    {
+        ctx.fillSpan({-3, 2}, 6, 7);
+        ctx.fillSpan({8, 3}, 6, 7);
+        ctx.fillSpan({0, height}, 6, 7);
+        ctx.fillSpan({0, -1}, 6, 7);
+        REQUIRE(count(7) == 5);
+        REQUIRE(pixel(0, 2) == 7);
+        REQUIRE(pixel(2, 2) == 7);
+        REQUIRE(pixel(3, 2) == 0);
+        REQUIRE(pixel(8, 3) == 7);
+        REQUIRE(pixel(9, 3) == 7);
+    }
+
+    SECTION("Fill rectangle clipped to the context")
+    {
+        ctx.fillRect({-2, -2}, 5, 4, 3);
+        REQUIRE(count(3) == 6);
+        REQUIRE(pixel(2, 1) == 3);
+        REQUIRE(pixel(3, 1) == 0);
+        REQUIRE(pixel(2, 2) == 0);
+
+        ctx.fillRect({0, 4}, width, 10, 5);
+        REQUIRE(count(5) == 2 * width);
+    }
+
+    SECTION("Copy rectangle between contexts")
+    {
+        gui::Context source{4, 4};
+        source.fill(9);
+        ctx.copyRect(source, {1, 1}, {-1, 4}, 4, 4);
+        REQUIRE(count(9) == 4);
+        REQUIRE(pixel(0, 4) == 9);
+        REQUIRE(pixel(1, 5) == 9);
+        REQUIRE(pixel(2, 5) == 0);
+    }
+
+    SECTION("Copy rectangle within the same context")
+    {
+        for (gui::Position y = 0; y < height; ++y) {
+            ctx.fillSpan({0, y}, width, y);
+        }
+        ctx.copyRect(ctx, {0, 0}, {0, 1}, width, height);
+        REQUIRE(pixel(5, 0) == 0);
+        for (gui::Position y = 1; y < height; ++y) {
+            REQUIRE(pixel(5, y) == y - 1);
+        }
+    }
+}
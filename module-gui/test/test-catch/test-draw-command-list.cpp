@@ -0,0 +1,64 @@
+// Copyright (c) 2017-2021, Mudita Sp. z.o.o. All rights reserved.
+// For licensing, see https://github.com/mudita/MuditaOS/LICENSE.md
+
+#include <catch2/catch.hpp>
+
+#include <module-gui/gui/core/DrawCommandList.hpp>
+
+#include <string>
+#include <vector>
+
+TEST_CASE("Draw command list")
+{
+    gui::DrawCommandList commands;
+    REQUIRE(commands.empty());
+    REQUIRE(commands.begin() == commands.end());
+
+    SECTION("Commands are stored in order")
+    {
+        commands.emplace<gui::Clear>();
+        auto &rect = commands.emplace<gui::DrawRectangle>();
+        rect.width = 10;
+        commands.emplace<gui::DrawCircle>(gui::Point{1, 1}, 5, 1, gui::ColorFullBlack);
+
+        REQUIRE(commands.size() == 3);
+        REQUIRE(std::holds_alternative<gui::Clear>(commands[0]));
+        REQUIRE(std::get<gui::DrawRectangle>(commands[1]).width == 10);
+        REQUIRE(std::get<gui::DrawCircle>(commands[2]).radius == 5);
+
+        gui::getCommand(commands[1]).areaW = 20;
+        REQUIRE(std::get<gui::DrawRectangle>(commands[1]).areaW == 20);
+    }
+
+    SECTION("Stored texts outlive growth of the arena")
+    {
+        std::vector<std::string_view> texts;
+        for (auto i = 0; i < 100; ++i) {
+            texts.push_back(commands.storeText(std::string(i % 30 + 1, 'a' + i % 26)));
+        }
+        texts.push_back(commands.storeText(std::string(2000, 'z')));
+
+        for (auto i = 0; i < 100; ++i) {
+            REQUIRE(texts[i] == std::string(i % 30 + 1, 'a' + i % 26));
+            REQUIRE(texts[i].data()[texts[i].size()] == '\0');
+        }
+        REQUIRE(texts.back() == std::string(2000, 'z'));
+    }
+
+    SECTION("Moved list keeps the commands")
+    {
+        auto &text = commands.emplace<gui::DrawText>();
+        text.str   = commands.storeText("text");
+
+        gui::DrawCommandList moved{std::move(commands)};
+        REQUIRE(moved.size() == 1);
+        REQUIRE(std::get<gui::DrawText>(moved[0]).str == "text");
+    }
+
+    SECTION("Cleared list is empty")
+    {
+        commands.emplace<gui::Clear>();
+        commands.clear();
+        REQUIRE(commands.empty());
+    }
+}
@@ -0,0 +1,192 @@
+// Copyright (c) 2017-2021, Mudita Sp. z.o.o. All rights reserved.
+// For licensing, see https://github.com/mudita/MuditaOS/LICENSE.md
+
+#include <catch2/catch.hpp>
+
+#include <module-gui/gui/core/Context.hpp>
+#include <module-gui/gui/core/FontGlyph.hpp>
+#include <module-gui/gui/core/RawFont.hpp>
+#include <module-gui/gui/core/renderers/GlyphRenderer.hpp>
+
+#include <algorithm>
+#include <cstring>
+#include <memory>
+#include <vector>
+
+namespace
+{
+    constexpr std::uint8_t Background = 0x0F;
+    constexpr std::uint8_t Foreground = 0x00;
+
+    /// Glyph with a checkerboard-like pattern wide enough to be drawn in more than one block of pixels
+    struct TestGlyph
+    {
+        gui::FontGlyph glyph;
+        std::vector<std::uint8_t> image;
+        std::unique_ptr<std::uint8_t[]> bitmap;
+
+        TestGlyph(std::uint16_t width, std::uint16_t height)
+        {
+            glyph.width  = width;
+            glyph.height = height;
+            for (std::uint32_t y = 0; y < height; ++y) {
+                for (std::uint32_t x = 0; x < width; ++x) {
+                    image.push_back((x + 2 * y) % 3 == 0 ? Foreground : Background);
+                }
+            }
+            bitmap = std::make_unique<std::uint8_t[]>(glyph.getBitmapSize());
+            glyph.loadImage(image.data(), bitmap.get());
+        }
+    };
+
+    /// Draws the glyph pixel by pixel
+    auto drawReference(const TestGlyph &test, gui::Point topLeft, std::uint32_t width, std::uint32_t height)
+    {
+        std::vector<std::uint8_t> pixels(width * height, Background);
+        for (std::int32_t y = 0; y < test.glyph.height; ++y) {
+            for (std::int32_t x = 0; x < test.glyph.width; ++x) {
+                const auto px = topLeft.x + x;
+                const auto py = topLeft.y + y;
+                if (px < 0 || py < 0 || px >= static_cast<std::int32_t>(width) ||
+                    py >= static_cast<std::int32_t>(height)) {
+                    continue;
+                }
+                if (test.image[y * test.glyph.width + x] == Foreground) {
+                    pixels[py * width + px] = Foreground;
+                }
+            }
+        }
+        return pixels;
+    }
+
+    /// Builds font file with 1x1 glyphs of given ids and advances, and given kerning pairs
+    class TestFontFile
+    {
+      public:
+        struct Glyph
+        {
+            std::uint32_t id;
+            std::uint16_t xadvance;
+        };
+        struct Kerning
+        {
+            std::uint32_t first;
+            std::uint32_t second;
+            std::int16_t amount;
+        };
+
+        TestFontFile(const std::vector<Glyph> &glyphs, const std::vector<Kerning> &kerning)
+        {
+            constexpr std::uint32_t infoSize    = 84;
+            constexpr std::uint32_t glyphSize   = 18;
+            constexpr std::uint32_t kerningSize = 10;
+            const std::uint32_t glyphsOffset    = gui::RawFont::headerSize;
+            const std::uint32_t kerningOffset   = glyphsOffset + glyphs.size() * glyphSize;
+            const std::uint32_t imagesOffset    = kerningOffset + kerning.size() * kerningSize;
+
+            data.resize(infoSize);
+            std::strcpy(reinterpret_cast<char *>(data.data()), "test");
+            append<std::uint16_t>(64, 20); // size of the font, offset of the size in the font info
+            append<std::uint32_t>(glyphs.size());
+            append<std::uint32_t>(glyphsOffset);
+            append<std::uint32_t>(kerning.size());
+            append<std::uint32_t>(kerningOffset);
+            append<std::uint32_t>(imagesOffset);
+            for (const auto &glyph : glyphs) {
+                append<std::uint32_t>(glyph.id);
+                append<std::uint32_t>(imagesOffset);
+                append<std::uint16_t>(1);
+                append<std::uint16_t>(1);
+                append<std::int16_t>(0);
+                append<std::int16_t>(0);
+                append<std::uint16_t>(glyph.xadvance);
+            }
+            for (const auto &kern : kerning) {
+                append<std::uint32_t>(kern.first);
+                append<std::uint32_t>(kern.second);
+                append<std::int16_t>(kern.amount);
+            }
+            data.push_back(Foreground);
+        }
+
+        std::vector<std::uint8_t> data;
+
+      private:
+        template <typename T> void append(T value)
+        {
+            append<T>(data.size(), value);
+        }
+        template <typename T> void append(std::size_t offset, T value)
+        {
+            data.resize(std::max(data.size(), offset + sizeof(T)));
+            std::memcpy(data.data() + offset, &value, sizeof(T));
+        }
+    };
+} // namespace
+
+TEST_CASE("Glyph bitmap layout")
+{
+    TestGlyph test{11, 2};
+    REQUIRE(test.glyph.getBitmapStride() == 2);
+    REQUIRE(test.glyph.getBitmapSize() == 4);
+    REQUIRE(test.glyph.data == test.bitmap.get());
+    REQUIRE(test.bitmap[0] == 0b01001001);
+    REQUIRE(test.bitmap[1] == 0b00000010);
+}
+
+TEST_CASE("Glyph renderer")
+{
+    constexpr std::uint16_t ContextWidth  = 40;
+    constexpr std::uint16_t ContextHeight = 20;
+    TestGlyph test{21, 9};
+    gui::Context ctx{ContextWidth, ContextHeight};
+    ctx.fill(Background);
+
+    auto topLeft = GENERATE(gui::Point{0, 0},
+                            gui::Point{3, 5},
+                            gui::Point{-5, 2},
+                            gui::Point{-9, -4},
+                            gui::Point{30, 15},
+                            gui::Point{ContextWidth - 21, ContextHeight - 9},
+                            gui::Point{ContextWidth, 0},
+                            gui::Point{0, -9});
+
+    gui::renderer::GlyphRenderer::draw(&ctx, topLeft, test.glyph, gui::ColorFullBlack);
+
+    const auto expected = drawReference(test, topLeft, ContextWidth, ContextHeight);
+    const std::vector<std::uint8_t> actual(ctx.getData(), ctx.getData() + ContextWidth * ContextHeight);
+    REQUIRE(actual == expected);
+}
+
+TEST_CASE("Font glyphs and kerning lookup")
+{
+    TestFontFile file{{{'b', 11}, {'a', 10}, {0x4E2D, 30}, {'a', 99}, {0x0451, 12}},
+                      {{'a', 'b', -2}, {0x4E2D, 'a', 3}, {'a', 'b', 5}, {'b', 'a', 1}}};
+    gui::RawFont font;
+    REQUIRE(font.load(file.data.data()) == gui::Status::GUI_SUCCESS);
+    REQUIRE(font.info.face == "test");
+
+    SECTION("Glyphs")
+    {
+        REQUIRE(font.getGlyph('a')->xadvance == 10);
+        REQUIRE(font.getGlyph('b')->xadvance == 11);
+        REQUIRE(font.getGlyph(0x0451)->xadvance == 12);
+        REQUIRE(font.getGlyph(0x4E2D)->xadvance == 30);
+        REQUIRE(font.getGlyph('a')->data[0] == 1);
+
+        const auto unsupported = font.getGlyph('c');
+        REQUIRE(unsupported != nullptr);
+        REQUIRE(unsupported == font.getGlyph(0x10000));
+        REQUIRE(unsupported != font.getGlyph('a'));
+    }
+
+    SECTION("Kerning")
+    {
+        REQUIRE(font.getKerning('a', 'b') == -2);
+        REQUIRE(font.getKerning('b', 'a') == 1);
+        REQUIRE(font.getKerning(0x4E2D, 'a') == 3);
+        REQUIRE(font.getKerning('a', 'a') == 0);
+        REQUIRE(font.getKerning('c', 'a') == 0);
+        REQUIRE(font.getKerning('a', gui::RawFont::none_char_id) == 0);
+    }
+}
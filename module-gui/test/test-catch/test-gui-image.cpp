@@ -4,9 +4,13 @@
 #include <catch2/catch.hpp>
 #define CATCH_CONFIG_MAIN // This tells Catch to provide a main() - only do this in one cpp file
 
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
 #include <list>
+#include <vector>
 
-#include <module-gui/gui/core/DrawCommand.hpp>
+#include <module-gui/gui/core/DrawCommandList.hpp>
 #include <module-gui/gui/core/ImageManager.hpp>
 #include <module-gui/gui/widgets/Image.hpp>
 
@@ -15,7 +19,7 @@ TEST_CASE("Constructing with empty image name")
     constexpr auto imageName = "";
     gui::Image image{nullptr, imageName};
 
-    std::list<gui::Command> commands;
+    gui::DrawCommandList commands;
     image.buildDrawListImplementation(commands);
     REQUIRE(commands.empty());
 }
@@ -26,7 +30,7 @@ TEST_CASE("Setting an empty image name")
     gui::Image image{};
     image.set(imageName);
 
-    std::list<gui::Command> commands;
+    gui::DrawCommandList commands;
     image.buildDrawListImplementation(commands);
     REQUIRE(commands.empty());
 }
@@ -37,7 +41,7 @@ TEST_CASE("Setting an incorrect image name")
     gui::Image image{};
     image.set(imageName);
 
-    std::list<gui::Command> commands;
+    gui::DrawCommandList commands;
     image.buildDrawListImplementation(commands);
     REQUIRE(!commands.empty());
 }
@@ -48,7 +52,76 @@ TEST_CASE("Setting an incorrect image id")
     gui::Image image{};
     image.set(imageId);
 
-    std::list<gui::Command> commands;
+    gui::DrawCommandList commands;
     image.buildDrawListImplementation(commands);
     REQUIRE(!commands.empty());
 }
+
+namespace
+{
+    class TestImageManager : public gui::ImageManager
+    {
+      public:
+        using gui::ImageManager::loadImageMaps;
+    };
+
+    void writePixMap(const std::filesystem::path &path, std::uint16_t width, std::uint16_t height, std::uint8_t colour)
+    {
+        std::ofstream file{path, std::ios::binary};
+        file.write(reinterpret_cast<const char *>(&width), sizeof(width));
+        file.write(reinterpret_cast<const char *>(&height), sizeof(height));
+        const std::vector<char> pixels(width * height, static_cast<char>(colour));
+        file.write(pixels.data(), pixels.size());
+    }
+} // namespace
+
+TEST_CASE("Images are loaded on demand")
+{
+    constexpr std::uint16_t width  = 480;
+    constexpr std::uint16_t height = 200;
+
+    const auto assets = std::filesystem::temp_directory_path() / "image-manager-test";
+    std::filesystem::create_directories(assets / "images");
+    writePixMap(assets / "images" / "first.mpi", width, height, 1);
+    writePixMap(assets / "images" / "second.mpi", width, height, 2);
+    writePixMap(assets / "images" / "third.mpi", width, height, 3);
+
+    TestImageManager manager;
+    manager.loadImageMaps(assets.string());
+    const auto first  = manager.getImageMapID("first");
+    const auto second = manager.getImageMapID("second");
+    const auto third  = manager.getImageMapID("third");
+
+    SECTION("Only header is read for widgets")
+    {
+        auto image = manager.getImageMap(first);
+        REQUIRE(image->getWidth() == width);
+        REQUIRE(image->getHeight() == height);
+        REQUIRE_FALSE(image->isLoaded());
+    }
+
+    SECTION("Data is read for drawing")
+    {
+        auto image = manager.getImageMapToDraw(second);
+        REQUIRE(image->getName() == "second");
+        REQUIRE(image->isLoaded());
+        REQUIRE(image->getData()[0] == 2);
+    }
+
+    SECTION("Data of least recently drawn image is freed")
+    {
+        manager.getImageMapToDraw(first);
+        manager.getImageMapToDraw(second);
+        manager.getImageMapToDraw(first);
+        manager.getImageMapToDraw(third);
+        REQUIRE(manager.getImageMap(first)->isLoaded());
+        REQUIRE_FALSE(manager.getImageMap(second)->isLoaded());
+        REQUIRE(manager.getImageMap(third)->isLoaded());
+
+        auto image = manager.getImageMapToDraw(second);
+        REQUIRE(image->isLoaded());
+        REQUIRE(image->getData()[width * height - 1] == 2);
+    }
+
+    std::filesystem::remove_all(assets);
+}
@@ -6,6 +6,7 @@
 #include "mock/InitializedFontManager.hpp"
 #define CATCH_CONFIG_MAIN // This tells Catch to provide a main() - only do this in one cpp file
 
+#include <algorithm>
 #include <memory>
 #include <functional>
 #include <iostream>
@@ -15,6 +16,7 @@
 #include <sys/stat.h>
 #include <sys/types.h>
 #include <fcntl.h>
+#include <variant>
 #include <catch2/catch.hpp>
 
 #include <log/log.hpp>
@@ -25,6 +27,7 @@
 #include <module-gui/gui/widgets/Label.hpp>
 #include <module-gui/gui/widgets/BoxLayout.hpp>
 #include <module-gui/gui/widgets/Image.hpp>
+#include <module-gui/gui/widgets/Rect.hpp>
 
 #include <mock/TestWindow.hpp>
 
@@ -45,6 +48,174 @@ TEST_CASE("Test BoundingBox intersect")
             true);
 }
 
+TEST_CASE("Test BoundingBox unite")
+{
+    REQUIRE(gui::BoundingBox::unite(gui::BoundingBox(0, 0, 10, 10), gui::BoundingBox(20, 5, 10, 10)) ==
+            gui::BoundingBox(0, 0, 30, 15));
+    REQUIRE(gui::BoundingBox::unite(gui::BoundingBox(-5, -5, 10, 10), gui::BoundingBox(0, 0, 0, 0)) ==
+            gui::BoundingBox(-5, -5, 10, 10));
+    REQUIRE(gui::BoundingBox(0, 0, 30, 30).contains(gui::BoundingBox(10, 10, 20, 20)));
+    REQUIRE_FALSE(gui::BoundingBox(0, 0, 30, 30).contains(gui::BoundingBox(10, 10, 21, 20)));
+    REQUIRE(gui::BoundingBox(0, 0, 15, 15).overlaps(gui::BoundingBox(14, 0, 15, 15)));
+    REQUIRE_FALSE(gui::BoundingBox(0, 0, 15, 15).overlaps(gui::BoundingBox(15, 0, 15, 15)));
+}
+
+TEST_CASE("Dirty area of window")
+{
+    auto win = std::make_unique<gui::TestWindow>("MAIN");
+    win->setSize(480, 600);
+    auto rect = new gui::Rect(win.get(), 20, 80, 100, 50);
+
+    SECTION("Whole window is dirty on first build")
+    {
+        win->buildDrawList();
+        REQUIRE(win->takeDirtyArea() == gui::BoundingBox(0, 0, 480, 600));
+        REQUIRE(win->takeDirtyArea() == gui::BoundingBox());
+    }
+
+    SECTION("Nothing is dirty if nothing changed")
+    {
+        win->buildDrawList();
+        win->takeDirtyArea();
+        win->buildDrawList();
+        REQUIRE(win->takeDirtyArea() == gui::BoundingBox());
+    }
+
+    SECTION("Changed item is dirty")
+    {
+        win->buildDrawList();
+        win->takeDirtyArea();
+        rect->setPenWidth(3);
+        win->buildDrawList();
+        REQUIRE(win->takeDirtyArea() == gui::BoundingBox(20, 80, 100, 50));
+    }
+
+    SECTION("Both old and new area of moved item are dirty")
+    {
+        win->buildDrawList();
+        win->takeDirtyArea();
+        rect->setPosition(220, 80);
+        win->buildDrawList();
+        REQUIRE(win->takeDirtyArea() == gui::BoundingBox(20, 80, 300, 50));
+    }
+
+    SECTION("Hidden item is dirty")
+    {
+        win->buildDrawList();
+        win->takeDirtyArea();
+        rect->setVisible(false);
+        win->buildDrawList();
+        REQUIRE(win->takeDirtyArea() == gui::BoundingBox(20, 80, 100, 50));
+    }
+}
+
+namespace
+{
+    class CountingItem : public gui::Rect
+    {
+      public:
+        CountingItem(gui::Item *parent, gui::Position x, gui::Position y, gui::Length w, gui::Length h)
+            : gui::Rect(parent, x, y, w, h)
+        {}
+
+        void buildDrawListImplementation(gui::DrawCommandList &commands) override
+        {
+            ++builds;
+            gui::Rect::buildDrawListImplementation(commands);
+            commands.emplace<gui::DrawText>().str = commands.storeText("text");
+        }
+
+        unsigned int builds = 0;
+    };
+
+    std::size_t textsCount(const gui::DrawCommandList &commands)
+    {
+        return std::count_if(commands.begin(), commands.end(), [](const gui::DrawCommandRecord &record) {
+            const auto text = std::get_if<gui::DrawText>(&record);
+            return text != nullptr && text->str == "text";
+        });
+    }
+} // namespace
+
+TEST_CASE("Draw commands of unchanged items are reused")
+{
+    auto win = std::make_unique<gui::TestWindow>("MAIN");
+    win->setSize(480, 600);
+    auto box    = new CountingItem(win.get(), 0, 0, 200, 200);
+    auto first  = new CountingItem(box, 10, 10, 50, 50);
+    auto second = new CountingItem(box, 70, 10, 50, 50);
+    auto other  = new CountingItem(win.get(), 300, 0, 100, 100);
+
+    const auto initial = win->buildDrawList();
+    REQUIRE(textsCount(initial) == 4);
+    win->takeDirtyArea();
+
+    SECTION("Nothing is built again if nothing changed")
+    {
+        const auto commands = win->buildDrawList();
+        REQUIRE(commands.size() == initial.size());
+        REQUIRE(textsCount(commands) == 4);
+        REQUIRE(box->builds == 1);
+        REQUIRE(first->builds == 1);
+        REQUIRE(second->builds == 1);
+        REQUIRE(other->builds == 1);
+    }
+
+    SECTION("Changed item and its parents are built again")
+    {
+        first->setPenWidth(3);
+        const auto commands = win->buildDrawList();
+        REQUIRE(commands.size() == initial.size());
+        REQUIRE(textsCount(commands) == 4);
+        REQUIRE(box->builds == 2);
+        REQUIRE(first->builds == 2);
+        REQUIRE(second->builds == 1);
+        REQUIRE(other->builds == 1);
+        REQUIRE(win->takeDirtyArea() == gui::BoundingBox(10, 10, 50, 50));
+
+        second->setPenWidth(3);
+        win->buildDrawList();
+        other->setPenWidth(3);
+        const auto next = win->buildDrawList();
+        REQUIRE(textsCount(next) == 4);
+        REQUIRE(first->builds == 2);
+        REQUIRE(second->builds == 2);
+        REQUIRE(other->builds == 2);
+    }
+
+    SECTION("Hidden subtree is built again when shown")
+    {
+        box->setVisible(false);
+        REQUIRE(textsCount(win->buildDrawList()) == 1);
+        box->setVisible(true);
+        const auto commands = win->buildDrawList();
+        REQUIRE(commands.size() == initial.size());
+        REQUIRE(textsCount(commands) == 4);
+        REQUIRE(first->builds == 2);
+    }
+
+    SECTION("Moved item is built again")
+    {
+        other->setPosition(250, 0);
+        win->buildDrawList();
+        REQUIRE(other->builds == 2);
+        REQUIRE(first->builds == 1);
+    }
+
+    SECTION("Items with hooks are always built")
+    {
+        auto hooked                  = new CountingItem(box, 130, 10, 50, 50);
+        unsigned int hookCalls       = 0;
+        hooked->preBuildDrawListHook = [&hookCalls](gui::DrawCommandList &) { ++hookCalls; };
+        win->buildDrawList();
+        const auto commands = win->buildDrawList();
+        REQUIRE(textsCount(commands) == 5);
+        REQUIRE(hookCalls == 2);
+        REQUIRE(hooked->builds == 2);
+        REQUIRE(first->builds == 1);
+    }
+}
+
 /// note that fontmanager is `global` so loading it now will make it available in next steps
 /// which is why it makes next steps work on possibly empty element (fontmanager)
 /// tbh - there should allways be fallback to some memory stored font in our FontManager
@@ -4,7 +4,10 @@
 #pragma once
 
 #include <purefs/blkdev/disk.hpp>
+#include <condition_variable>
+#include <deque>
 #include <mutex>
+#include <thread>
 #include <vector>
 
 namespace purefs::blkdev
@@ -16,14 +19,16 @@ namespace purefs::blkdev
 
       public:
         explicit disk_image(std::string_view image_filename, std::size_t sector_size = 512, hwpart_t num_parts = 8);
-        virtual ~disk_image()
-        {}
+        virtual ~disk_image();
 
       private:
         auto probe(unsigned flags) -> int override;
         auto cleanup() -> int override;
         auto write(const void *buf, sector_t lba, std::size_t count, hwpart_t hwpart) -> int override;
         auto read(void *buf, sector_t lba, std::size_t count, hwpart_t hwpart) -> int override;
+        auto readv(const std::vector<io_vec> &vecs, hwpart_t hwpart) -> int override;
+        auto writev(const std::vector<io_vec> &vecs, hwpart_t hwpart) -> int override;
+        auto submit(io_request req) -> int override;
         auto sync() -> int override;
         auto status() const -> media_status override;
         auto get_info(info_type what, hwpart_t hwpart) const -> scount_t override;
@@ -32,6 +37,10 @@ namespace purefs::blkdev
         auto pm_read(pm_state &current_state) -> int override;
         auto range_valid(sector_t lba, std::size_t count, hwpart_t hwpart) const -> bool;
         auto open_and_truncate(hwpart_t hwpart) -> int;
+        auto read_sectors(void *buf, sector_t lba, std::size_t count, hwpart_t hwpart) -> int;
+        auto write_sectors(const void *buf, sector_t lba, std::size_t count, hwpart_t hwpart) -> int;
+        auto io_worker() -> void;
+        auto stop_io_worker() -> void;
 
       private:
         pm_state pmState{pm_state::active};
@@ -42,5 +51,10 @@ namespace purefs::blkdev
         const std::size_t m_syspart_sectors;
         const hwpart_t m_sysparts;
         mutable std::recursive_mutex m_mtx;
+        std::thread m_io_thread;
+        std::deque<io_request> m_io_queue;
+        std::mutex m_io_mtx;
+        std::condition_variable m_io_cv;
+        bool m_io_stop{};
     };
 } // namespace purefs::blkdev
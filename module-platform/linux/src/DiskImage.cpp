@@ -23,6 +23,11 @@ namespace purefs::blkdev
         m_sectors[0] = 0;
     }
 
+    disk_image::~disk_image()
+    {
+        stop_io_worker();
+    }
+
     auto disk_image::probe(unsigned int flags) -> int
     {
         std::lock_guard<std::recursive_mutex> m_lock(m_mtx);
@@ -40,6 +45,7 @@ namespace purefs::blkdev
 
     auto disk_image::cleanup() -> int
     {
+        stop_io_worker();
         std::lock_guard<std::recursive_mutex> m_lock(m_mtx);
         int ret{};
         for (auto &fd : m_filedes)
@@ -63,20 +69,27 @@ namespace purefs::blkdev
         if (err) {
             return err;
         }
-        auto offs = ::lseek64(m_filedes[hwpart], off64_t(lba) * off64_t(m_sector_size), SEEK_SET);
-        if (offs < 0) {
-            return offs;
+        return write_sectors(buf, lba, count, hwpart);
+    }
+
+    auto disk_image::writev(const std::vector<io_vec> &vecs, hwpart_t hwpart) -> int
+    {
+        std::lock_guard<std::recursive_mutex> m_lock(m_mtx);
+        for (const auto &vec : vecs) {
+            if (!range_valid(vec.lba, vec.count, hwpart)) {
+                return -ERANGE;
+            }
         }
-        auto to_write = count * m_sector_size;
-        auto buf_b    = reinterpret_cast<const uint8_t *>(buf);
-        do {
-            auto ret = ::write(m_filedes[hwpart], buf_b, to_write);
-            if (ret < 0) {
-                return -errno;
+        int err = open_and_truncate(hwpart);
+        if (err) {
+            return err;
+        }
+        for (const auto &vec : vecs) {
+            err = write_sectors(vec.buf, vec.lba, vec.count, hwpart);
+            if (err) {
+                return err;
             }
-            to_write -= ret;
-            buf_b += ret;
-        } while (to_write > 0);
+        }
         return 0;
     }
 
@@ -97,23 +110,76 @@ namespace purefs::blkdev
         if (err) {
             return err;
         }
-        auto offs = ::lseek64(m_filedes[hwpart], off64_t(lba) * off64_t(m_sector_size), SEEK_SET);
-        if (offs < 0) {
-            return offs;
+        return read_sectors(buf, lba, count, hwpart);
+    }
+
+    auto disk_image::readv(const std::vector<io_vec> &vecs, hwpart_t hwpart) -> int
+    {
+        std::lock_guard<std::recursive_mutex> m_lock(m_mtx);
+        for (const auto &vec : vecs) {
+            if (!range_valid(vec.lba, vec.count, hwpart)) {
+                return -ERANGE;
+            }
+        }
+        int err = open_and_truncate(hwpart);
+        if (err) {
+            return err;
         }
-        auto to_read = count * m_sector_size;
-        auto buf_b   = reinterpret_cast<uint8_t *>(buf);
-        do {
-            auto ret = ::read(m_filedes[hwpart], buf_b, to_read);
-            if (ret < 0) {
-                return -errno;
+        for (const auto &vec : vecs) {
+            err = read_sectors(vec.buf, vec.lba, vec.count, hwpart);
+            if (err) {
+                return err;
             }
-            to_read -= ret;
-            buf_b += ret;
-        } while (to_read > 0);
+        }
         return 0;
     }
 
+    auto disk_image::submit(io_request req) -> int
+    {
+        {
+            std::lock_guard<std::mutex> lock(m_io_mtx);
+            if (!m_io_thread.joinable()) {
+                m_io_stop   = false;
+                m_io_thread = std::thread(&disk_image::io_worker, this);
+            }
+            m_io_queue.push_back(std::move(req));
+        }
+        m_io_cv.notify_one();
+        return 0;
+    }
+
+    auto disk_image::io_worker() -> void
+    {
+        std::unique_lock<std::mutex> lock(m_io_mtx);
+        for (;;) {
+            m_io_cv.wait(lock, [this] { return m_io_stop || !m_io_queue.empty(); });
+            if (m_io_queue.empty()) {
+                return;
+            }
+            auto req = std::move(m_io_queue.front());
+            m_io_queue.pop_front();
+            lock.unlock();
+            const auto err = (req.op == io_op::read) ? readv(req.vecs, req.hwpart) : writev(req.vecs, req.hwpart);
+            if (req.on_complete) {
+                req.on_complete(err);
+            }
+            lock.lock();
+        }
+    }
+
+    auto disk_image::stop_io_worker() -> void
+    {
+        {
+            std::lock_guard<std::mutex> lock(m_io_mtx);
+            m_io_stop = true;
+        }
+        m_io_cv.notify_one();
+        // Requests queued are still completed before the worker exits
+        if (m_io_thread.joinable()) {
+            m_io_thread.join();
+        }
+    }
+
     auto disk_image::sync() -> int
     {
         std::lock_guard<std::recursive_mutex> m_lock(m_mtx);
@@ -190,6 +256,43 @@ namespace purefs::blkdev
         return 0;
     }
 
+    auto disk_image::read_sectors(void *buf, sector_t lba, std::size_t count, hwpart_t hwpart) -> int
+    {
+        auto offs    = off64_t(lba) * off64_t(m_sector_size);
+        auto to_read = count * m_sector_size;
+        auto buf_b   = reinterpret_cast<uint8_t *>(buf);
+        while (to_read > 0) {
+            auto ret = ::pread64(m_filedes[hwpart], buf_b, to_read, offs);
+            if (ret < 0) {
+                return -errno;
+            }
+            if (ret == 0) {
+                return -EIO;
+            }
+            to_read -= ret;
+            buf_b += ret;
+            offs += ret;
+        }
+        return 0;
+    }
+
+    auto disk_image::write_sectors(const void *buf, sector_t lba, std::size_t count, hwpart_t hwpart) -> int
+    {
+        auto offs     = off64_t(lba) * off64_t(m_sector_size);
+        auto to_write = count * m_sector_size;
+        auto buf_b    = reinterpret_cast<const uint8_t *>(buf);
+        while (to_write > 0) {
+            auto ret = ::pwrite64(m_filedes[hwpart], buf_b, to_write, offs);
+            if (ret < 0) {
+                return -errno;
+            }
+            to_write -= ret;
+            buf_b += ret;
+            offs += ret;
+        }
+        return 0;
+    }
+
     auto disk_image::pm_control(pm_state target_state) -> int
     {
         pmState = target_state;
@@ -0,0 +1,144 @@
+// Copyright (c) 2017-2021, Mudita Sp. z.o.o. All rights reserved.
+// For licensing, see https://github.com/mudita/MuditaOS/LICENSE.md
+
+#pragma once
+
+#include <purefs/blkdev/disk.hpp>
+
+#include <memory>
+#include <vector>
+
+namespace testing::vfs
+{
+    //! Disk passing the requests to the underlying disk, asynchronous ones are completed inline
+    class forwarding_disk : public purefs::blkdev::disk
+    {
+      public:
+        explicit forwarding_disk(std::shared_ptr<purefs::blkdev::disk> disk) : m_disk(std::move(disk))
+        {}
+        auto probe(unsigned flags) -> int override
+        {
+            return m_disk->probe(flags);
+        }
+        auto cleanup() -> int override
+        {
+            return m_disk->cleanup();
+        }
+        auto write(const void *buf, purefs::blkdev::sector_t lba, std::size_t count, purefs::blkdev::hwpart_t hwpart)
+            -> int override
+        {
+            return m_disk->write(buf, lba, count, hwpart);
+        }
+        auto read(void *buf, purefs::blkdev::sector_t lba, std::size_t count, purefs::blkdev::hwpart_t hwpart)
+            -> int override
+        {
+            return m_disk->read(buf, lba, count, hwpart);
+        }
+        auto readv(const std::vector<purefs::blkdev::io_vec> &vecs, purefs::blkdev::hwpart_t hwpart) -> int override
+        {
+            return m_disk->readv(vecs, hwpart);
+        }
+        auto writev(const std::vector<purefs::blkdev::io_vec> &vecs, purefs::blkdev::hwpart_t hwpart) -> int override
+        {
+            return m_disk->writev(vecs, hwpart);
+        }
+        auto erase(purefs::blkdev::sector_t lba, std::size_t count, purefs::blkdev::hwpart_t hwpart) -> int override
+        {
+            return m_disk->erase(lba, count, hwpart);
+        }
+        auto sync() -> int override
+        {
+            return m_disk->sync();
+        }
+        auto pm_control(purefs::blkdev::pm_state target_state) -> int override
+        {
+            return m_disk->pm_control(target_state);
+        }
+        auto pm_read(purefs::blkdev::pm_state &current_state) -> int override
+        {
+            return m_disk->pm_read(current_state);
+        }
+        auto status() const -> purefs::blkdev::media_status override
+        {
+            return m_disk->status();
+        }
+        auto get_info(purefs::blkdev::info_type what, purefs::blkdev::hwpart_t hwpart) const
+            -> purefs::blkdev::scount_t override
+        {
+            return m_disk->get_info(what, hwpart);
+        }
+
+      private:
+        const std::shared_ptr<purefs::blkdev::disk> m_disk;
+    };
+
+    //! Disk counting the requests and sectors which reach the underlying disk
+    class counting_disk final : public forwarding_disk
+    {
+      public:
+        using forwarding_disk::forwarding_disk;
+        auto write(const void *buf, purefs::blkdev::sector_t lba, std::size_t count, purefs::blkdev::hwpart_t hwpart)
+            -> int override
+        {
+            ++writes;
+            sectors_written += count;
+            return forwarding_disk::write(buf, lba, count, hwpart);
+        }
+        auto read(void *buf, purefs::blkdev::sector_t lba, std::size_t count, purefs::blkdev::hwpart_t hwpart)
+            -> int override
+        {
+            ++reads;
+            sectors_read += count;
+            return forwarding_disk::read(buf, lba, count, hwpart);
+        }
+        auto readv(const std::vector<purefs::blkdev::io_vec> &vecs, purefs::blkdev::hwpart_t hwpart) -> int override
+        {
+            ++reads;
+            for (const auto &vec : vecs) {
+                sectors_read += vec.count;
+            }
+            return forwarding_disk::readv(vecs, hwpart);
+        }
+        auto writev(const std::vector<purefs::blkdev::io_vec> &vecs, purefs::blkdev::hwpart_t hwpart) -> int override
+        {
+            ++writes;
+            for (const auto &vec : vecs) {
+                sectors_written += vec.count;
+            }
+            return forwarding_disk::writev(vecs, hwpart);
+        }
+        auto reset() -> void
+        {
+            reads           = 0;
+            writes          = 0;
+            sectors_read    = 0;
+            sectors_written = 0;
+        }
+        std::size_t reads{};
+        std::size_t writes{};
+        std::size_t sectors_read{};
+        std::size_t sectors_written{};
+    };
+
+    //! Disk keeping the asynchronous requests until they are completed on demand
+    class deferring_disk final : public forwarding_disk
+    {
+      public:
+        using forwarding_disk::forwarding_disk;
+        auto submit(purefs::blkdev::io_request req) -> int override
+        {
+            m_deferred.push_back(std::move(req));
+            return 0;
+        }
+        auto complete_deferred() -> void
+        {
+            auto deferred = std::move(m_deferred);
+            for (auto &req : deferred) {
+                forwarding_disk::submit(std::move(req));
+            }
+        }
+
+      private:
+        std::vector<purefs::blkdev::io_request> m_deferred;
+    };
+} // namespace testing::vfs
@@ -7,15 +7,21 @@
 #include <platform/linux/DiskImage.hpp>
 
 #include "test-setup.hpp"
+#include "test-disks.hpp"
 
 #include <filesystem>
+#include <future>
 
 namespace
 {
+    using ::testing::vfs::counting_disk;
+    using ::testing::vfs::deferring_disk;
+
     constexpr auto part_disk_image     = "test_disk.img";
     constexpr auto part_disk_image_ext = "test_disk_ext.img";
     constexpr auto part_disk_image_bad = "test_disk_bad.img";
     constexpr auto eeprom_image        = "test_eeprom.bin";
+    constexpr auto cache_disk_image    = "test_cache.img";
 } // namespace
 
 TEST_CASE("Registering and unregistering device")
@@ -171,6 +177,188 @@ TEST_CASE("Disk manager EEPROM emulation")
     REQUIRE(buf_in2 == buf_out2);
 }
 
+TEST_CASE("Disk manager sector cache")
+{
+    static constexpr auto disk_size   = 1024 * 1024;
+    static constexpr auto sector_size = 512;
+
+    using namespace purefs;
+    std::ofstream ofc(cache_disk_image);
+    ofc.close();
+    std::filesystem::resize_file(cache_disk_image, disk_size);
+    blkdev::disk_manager dm;
+    auto disk = std::make_shared<counting_disk>(std::make_shared<blkdev::disk_image>(cache_disk_image, sector_size, 1));
+    REQUIRE(disk);
+    REQUIRE(dm.register_device(disk, "cache0", blkdev::flags::no_parts_scan) == 0);
+    std::vector<char> buf_in(sector_size), buf_out(sector_size);
+
+    SECTION("Sectors read again come from the cache")
+    {
+        std::vector<char> buf_cached(sector_size);
+        const auto reads = disk->reads;
+        REQUIRE(dm.read("cache0", buf_out.data(), 100, 1) == 0);
+        REQUIRE(dm.read("cache0", buf_cached.data(), 100, 1) == 0);
+        REQUIRE(disk->reads == reads + 1);
+        REQUIRE(buf_out == buf_cached);
+    }
+
+    SECTION("Writes are deferred until sync and written in a single request")
+    {
+        for (auto lba = 200; lba < 204; ++lba) {
+            std::fill(std::begin(buf_in), std::end(buf_in), char(lba));
+            REQUIRE(dm.write("cache0", buf_in.data(), lba, 1) == 0);
+        }
+        REQUIRE(disk->writes == 0);
+        REQUIRE(dm.read("cache0", buf_out.data(), 201, 1) == 0);
+        REQUIRE(buf_out == std::vector<char>(sector_size, char(201)));
+        REQUIRE(dm.sync("cache0") == 0);
+        REQUIRE(disk->writes == 1);
+        for (auto lba = 200; lba < 204; ++lba) {
+            REQUIRE(disk->read(buf_out.data(), lba, 1, 0) == 0);
+            REQUIRE(buf_out == std::vector<char>(sector_size, char(lba)));
+        }
+    }
+
+    SECTION("Sequential reads are read ahead")
+    {
+        REQUIRE(dm.read("cache0", buf_out.data(), 300, 1) == 0);
+        REQUIRE(dm.read("cache0", buf_out.data(), 301, 1) == 0);
+        const auto reads = disk->reads;
+        for (auto lba = 302; lba < 310; ++lba) {
+            REQUIRE(dm.read("cache0", buf_out.data(), lba, 1) == 0);
+        }
+        REQUIRE(disk->reads == reads);
+    }
+
+    SECTION("Large requests go to the disk and stay coherent with the cache")
+    {
+        static constexpr auto count = 128;
+        std::fill(std::begin(buf_in), std::end(buf_in), 0x55);
+        REQUIRE(dm.write("cache0", buf_in.data(), 410, 1) == 0);
+        std::vector<char> large_out(count * sector_size);
+        REQUIRE(dm.read("cache0", large_out.data(), 400, count) == 0);
+        REQUIRE(std::equal(std::begin(buf_in), std::end(buf_in), std::begin(large_out) + 10 * sector_size));
+        std::vector<char> large_in(count * sector_size, 0x66);
+        const auto writes = disk->writes;
+        REQUIRE(dm.write("cache0", large_in.data(), 400, count) == 0);
+        REQUIRE(disk->writes == writes + 1);
+        REQUIRE(dm.read("cache0", buf_out.data(), 410, 1) == 0);
+        REQUIRE(buf_out == std::vector<char>(sector_size, 0x66));
+        REQUIRE(dm.sync("cache0") == 0);
+        REQUIRE(disk->read(buf_out.data(), 410, 1, 0) == 0);
+        REQUIRE(buf_out == std::vector<char>(sector_size, 0x66));
+    }
+
+    SECTION("Vectored ranges missing from the cache go to the disk in a single request")
+    {
+        std::vector<char> buf1(2 * sector_size, 0x11), buf2(sector_size, 0x22);
+        const auto writes = disk->writes;
+        REQUIRE(dm.writev("cache0", {{800, 2, buf1.data()}, {900, 1, buf2.data()}}) == 0);
+        REQUIRE(disk->writes == writes + 1);
+        std::vector<char> out1(buf1.size()), out2(buf2.size());
+        const auto reads = disk->reads;
+        REQUIRE(dm.readv("cache0", {{800, 2, out1.data()}, {900, 1, out2.data()}}) == 0);
+        REQUIRE(disk->reads == reads + 1);
+        REQUIRE(out1 == buf1);
+        REQUIRE(out2 == buf2);
+    }
+
+    SECTION("Unregistering the device writes back the cache")
+    {
+        std::fill(std::begin(buf_in), std::end(buf_in), 0x77);
+        REQUIRE(dm.write("cache0", buf_in.data(), 600, 1) == 0);
+        REQUIRE(disk->writes == 0);
+        REQUIRE(dm.unregister_device("cache0") == 0);
+        std::ifstream ifc(cache_disk_image, std::ios::binary);
+        ifc.seekg(600 * sector_size);
+        REQUIRE(ifc.read(buf_out.data(), sector_size));
+        REQUIRE(buf_in == buf_out);
+    }
+
+    SECTION("Cache is not used when disabled")
+    {
+        auto uncached =
+            std::make_shared<counting_disk>(std::make_shared<blkdev::disk_image>(cache_disk_image, sector_size, 1));
+        const auto flags = blkdev::flags::no_parts_scan | blkdev::flags::no_sector_cache;
+        REQUIRE(dm.register_device(uncached, "nocache0", flags) == 0);
+        REQUIRE(dm.write("nocache0", buf_in.data(), 700, 1) == 0);
+        REQUIRE(uncached->writes == 1);
+    }
+
+    SECTION("Sectors of asynchronous requests in progress are not cached")
+    {
+        auto deferring =
+            std::make_shared<deferring_disk>(std::make_shared<blkdev::disk_image>(cache_disk_image, sector_size, 1));
+        REQUIRE(dm.register_device(deferring, "defer0", blkdev::flags::no_parts_scan) == 0);
+        std::fill(std::begin(buf_in), std::end(buf_in), 0x44);
+        bool written = false;
+        REQUIRE(dm.submit("defer0", blkdev::io_op::write, {{1000, 1, buf_in.data()}}, [&](int err) {
+            written = err == 0;
+        }) == 0);
+        REQUIRE(dm.read("defer0", buf_out.data(), 999, 1) == 0);
+        REQUIRE(dm.read("defer0", buf_out.data(), 1000, 1) == 0);
+        deferring->complete_deferred();
+        REQUIRE(written);
+        REQUIRE(dm.read("defer0", buf_out.data(), 1000, 1) == 0);
+        REQUIRE(buf_out == buf_in);
+    }
+}
+
+TEST_CASE("Disk manager vectored and asynchronous IO")
+{
+    static constexpr auto disk_size   = 1024 * 1024;
+    static constexpr auto sector_size = 512;
+
+    using namespace purefs;
+    std::ofstream ofc(cache_disk_image);
+    ofc.close();
+    std::filesystem::resize_file(cache_disk_image, disk_size);
+    blkdev::disk_manager dm;
+    const auto cached   = unsigned(blkdev::flags::no_parts_scan);
+    const auto uncached = unsigned(blkdev::flags::no_parts_scan | blkdev::flags::no_sector_cache);
+    const auto flags    = GENERATE_COPY(cached, uncached);
+    auto disk = std::make_shared<blkdev::disk_image>(cache_disk_image, sector_size, 1);
+    REQUIRE(dm.register_device(disk, "vec0", flags) == 0);
+    std::vector<char> buf1(2 * sector_size, 0x11), buf2(sector_size, 0x22), buf3(3 * sector_size, 0x33);
+
+    SECTION("Scattered ranges are written and read back")
+    {
+        REQUIRE(dm.writev("vec0", {{10, 2, buf1.data()}, {100, 1, buf2.data()}, {50, 3, buf3.data()}}) == 0);
+        std::vector<char> out1(buf1.size()), out2(buf2.size()), out3(buf3.size());
+        REQUIRE(dm.readv("vec0", {{10, 2, out1.data()}, {100, 1, out2.data()}, {50, 3, out3.data()}}) == 0);
+        REQUIRE(out1 == buf1);
+        REQUIRE(out2 == buf2);
+        REQUIRE(out3 == buf3);
+        REQUIRE(dm.read("vec0", out2.data(), 11, 1) == 0);
+        REQUIRE(out2 == std::vector<char>(sector_size, 0x11));
+    }
+
+    SECTION("Range out of the disk fails the whole request")
+    {
+        const auto sectors = dm.get_info("vec0", blkdev::info_type::sector_count);
+        REQUIRE(sectors > 0);
+        REQUIRE(dm.readv("vec0", {{0, 1, buf2.data()}, {blkdev::sector_t(sectors), 1, buf2.data()}}) == -ERANGE);
+        REQUIRE(dm.writev("vec0", {{blkdev::sector_t(sectors) - 1, 2, buf1.data()}}) == -ERANGE);
+    }
+
+    SECTION("Asynchronous requests are completed")
+    {
+        std::promise<int> written;
+        REQUIRE(dm.submit("vec0", blkdev::io_op::write, {{20, 2, buf1.data()}, {30, 3, buf3.data()}}, [&](int err) {
+            written.set_value(err);
+        }) == 0);
+        REQUIRE(written.get_future().get() == 0);
+        std::vector<char> out1(buf1.size()), out3(buf3.size());
+        std::promise<int> read;
+        REQUIRE(dm.submit("vec0", blkdev::io_op::read, {{20, 2, out1.data()}, {30, 3, out3.data()}}, [&](int err) {
+            read.set_value(err);
+        }) == 0);
+        REQUIRE(read.get_future().get() == 0);
+        REQUIRE(out1 == buf1);
+        REQUIRE(out3 == buf3);
+    }
+}
+
 TEST_CASE("Null pointer passed to disk manager functions")
 {
     using namespace purefs;
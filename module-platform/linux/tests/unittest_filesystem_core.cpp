@@ -14,13 +14,124 @@
 #include <purefs/fs/thread_local_cwd.hpp>
 
 #include "test-setup.hpp"
+#include "test-disks.hpp"
 
+#include <FreeRTOS.h>
+#include <semphr.h>
+#include <task.h>
+
+#include <atomic>
+#include <cstring>
+#include <functional>
 #include <tuple>
 
 #include <sys/statvfs.h>
 #include <sys/stat.h>
 #include <fcntl.h>
 
+namespace
+{
+    //! Disk blocking the read armed until it is released
+    class gated_disk final : public ::testing::vfs::forwarding_disk
+    {
+      public:
+        explicit gated_disk(std::shared_ptr<purefs::blkdev::disk> disk)
+            : forwarding_disk(std::move(disk)), m_entered(xSemaphoreCreateBinary()), m_release(xSemaphoreCreateBinary())
+        {}
+        ~gated_disk()
+        {
+            vSemaphoreDelete(m_entered);
+            vSemaphoreDelete(m_release);
+        }
+        auto read(void *buf, purefs::blkdev::sector_t lba, std::size_t count, purefs::blkdev::hwpart_t hwpart)
+            -> int override
+        {
+            if (m_armed.exchange(false)) {
+                xSemaphoreGive(m_entered);
+                xSemaphoreTake(m_release, portMAX_DELAY);
+            }
+            return forwarding_disk::read(buf, lba, count, hwpart);
+        }
+        auto arm() -> void
+        {
+            m_armed = true;
+        }
+        auto wait_entered() -> void
+        {
+            xSemaphoreTake(m_entered, portMAX_DELAY);
+        }
+        auto release() -> void
+        {
+            xSemaphoreGive(m_release);
+        }
+
+      private:
+        std::atomic<bool> m_armed{};
+        SemaphoreHandle_t m_entered;
+        SemaphoreHandle_t m_release;
+    };
+
+    //! Task running the function, the owner waits for it with join
+    class test_task
+    {
+      public:
+        explicit test_task(std::function<void()> fn) : m_fn(std::move(fn)), m_done(xSemaphoreCreateBinary())
+        {
+            xTaskCreate(&test_task::entry, "vfs-test", stack_depth, this, tskIDLE_PRIORITY + 1, nullptr);
+        }
+        ~test_task()
+        {
+            vSemaphoreDelete(m_done);
+        }
+        auto join() -> void
+        {
+            xSemaphoreTake(m_done, portMAX_DELAY);
+        }
+
+      private:
+        static constexpr auto stack_depth = 4096;
+        static void entry(void *arg)
+        {
+            const auto self = static_cast<test_task *>(arg);
+            self->m_fn();
+            xSemaphoreGive(self->m_done);
+            vTaskDelete(nullptr);
+        }
+        std::function<void()> m_fn;
+        SemaphoreHandle_t m_done;
+    };
+
+    //! Run the function in a task of the scheduler, as only tasks can block on the VFS locks
+    //! @note The scheduler is started once, the function runs all the cases which need it
+    auto run_in_scheduler(std::function<void()> fn) -> void
+    {
+        static std::function<void()> test;
+        test = std::move(fn);
+        xTaskCreate(
+            [](void *) {
+                test();
+                vTaskEndScheduler();
+            },
+            "vfs-main",
+            4096,
+            nullptr,
+            tskIDLE_PRIORITY + 1,
+            nullptr);
+        vTaskStartScheduler();
+    }
+
+    auto write_file(purefs::fs::filesystem &fs_core, std::string_view path, const std::string &text) -> int
+    {
+        const auto fd = fs_core.open(path, O_WRONLY | O_CREAT | O_TRUNC, 0660);
+        if (fd < 0) {
+            return fd;
+        }
+        const auto ret = fs_core.write(fd, text.c_str(), text.size());
+        const auto err = fs_core.close(fd);
+        return (ret != ssize_t(text.size())) ? -EIO : err;
+    }
+} // namespace
+
 TEST_CASE("Corefs: Registering and unregistering block device")
 {
     using namespace purefs;
@@ -278,6 +389,35 @@ TEST_CASE("Corefs: Directory operations")
     }
 }
 
+TEST_CASE("Corefs: Paths are normalized")
+{
+    using namespace purefs;
+    auto dm   = std::make_shared<blkdev::disk_manager>();
+    auto disk = std::make_shared<blkdev::disk_image>(::testing::vfs::disk_image);
+    REQUIRE(disk);
+    REQUIRE(dm->register_device(disk, "emmc0") == 0);
+    purefs::fs::filesystem fscore(dm);
+    const auto vfs_vfat = std::make_shared<fs::drivers::filesystem_vfat>();
+    REQUIRE(fscore.register_filesystem("vfat", vfs_vfat) == 0);
+    REQUIRE(fscore.mount("emmc0part0", "/sys", "vfat") == 0);
+
+    struct stat st;
+    REQUIRE(fscore.stat("/sys//current/./", st) == 0);
+    REQUIRE((st.st_mode & S_IFMT) == S_IFDIR);
+    REQUIRE(fscore.stat("/sys/current/../current", st) == 0);
+    REQUIRE(fscore.stat("/sys/../../sys/current", st) == 0);
+    REQUIRE(fscore.stat("/sysx/current", st) == -ENOENT);
+
+    REQUIRE(fscore.chdir("/sys/./current//") == 0);
+    REQUIRE(fscore.getcwd() == "/sys/current");
+    REQUIRE(fscore.chdir("..") == 0);
+    REQUIRE(fscore.getcwd() == "/sys");
+    REQUIRE(fscore.stat("current/.", st) == 0);
+    REQUIRE(fscore.chdir("/sys") == 0);
+    REQUIRE(fscore.umount("/sys") == 0);
+    REQUIRE(fscore.stat("/sys/current", st) == -ENOENT);
+}
+
 TEST_CASE("Corefs: Read only filesystem")
 {
     using namespace purefs;
@@ -437,3 +577,143 @@ TEST_CASE("Corefs: stat extended")
     // Final umount
     REQUIRE(fs_core.umount("/sys") == 0);
 }
+
+TEST_CASE("Corefs: File descriptor reused after close")
+{
+    using namespace purefs;
+    auto dm   = std::make_shared<blkdev::disk_manager>();
+    auto disk = std::make_shared<blkdev::disk_image>(::testing::vfs::disk_image);
+    REQUIRE(dm->register_device(disk, "emmc0") == 0);
+    fs::filesystem fs_core(dm);
+    REQUIRE(fs_core.register_filesystem("vfat", std::make_shared<fs::drivers::filesystem_vfat>()) == 0);
+    REQUIRE(fs_core.mount("emmc0part0", "/sys", "vfat") == 0);
+    REQUIRE(write_file(fs_core, "/sys/reuse1.txt", "first") == 0);
+    REQUIRE(write_file(fs_core, "/sys/reuse2.txt", "second file") == 0);
+
+    const auto fd = fs_core.open("/sys/reuse1.txt", O_RDONLY, 0);
+    REQUIRE(fd >= 3);
+    REQUIRE(fs_core.close(fd) == 0);
+    char buf[32]{};
+    REQUIRE(fs_core.read(fd, buf, sizeof buf) == -EBADF);
+    REQUIRE(fs_core.close(fd) == -EBADF);
+
+    // The descriptor number is reused and refers to the file opened last
+    const auto fd2 = fs_core.open("/sys/reuse2.txt", O_RDONLY, 0);
+    REQUIRE(fd2 == fd);
+    REQUIRE(fs_core.read(fd2, buf, sizeof buf) == 11);
+    REQUIRE(std::memcmp(buf, "second file", 11) == 0);
+    REQUIRE(fs_core.close(fd2) == 0);
+
+    REQUIRE(fs_core.unlink("/sys/reuse1.txt") == 0);
+    REQUIRE(fs_core.unlink("/sys/reuse2.txt") == 0);
+    REQUIRE(fs_core.umount("/sys") == 0);
+}
+
+TEST_CASE("Corefs: Concurrent file operations")
+{
+    using namespace purefs;
+    static constexpr auto race_iterations = 200;
+    const std::string text                = "blocked";
+
+    struct
+    {
+        int mount{-1};
+        ssize_t read_blocked{};
+        int close_blocked{};
+        bool closed_while_reading{true};
+        ssize_t read_after_close{};
+        int race_mount{-1};
+        int race_umount{-1};
+        int race_failures{-1};
+    } result;
+
+    run_in_scheduler([&] {
+        auto dm   = std::make_shared<blkdev::disk_manager>();
+        auto disk = std::make_shared<gated_disk>(std::make_shared<blkdev::disk_image>(::testing::vfs::disk_image));
+        auto disk2 = std::make_shared<blkdev::disk_image>(::testing::vfs::disk_image);
+        if (dm->register_device(disk, "emmc0", blkdev::flags::no_sector_cache) != 0 ||
+            dm->register_device(disk2, "emmc1", blkdev::flags::no_sector_cache) != 0) {
+            return;
+        }
+        fs::filesystem fs_core(dm);
+        fs_core.register_filesystem("vfat", std::make_shared<fs::drivers::filesystem_vfat>());
+        result.mount = fs_core.mount("emmc0part0", "/sys", "vfat");
+        if (result.mount != 0 || write_file(fs_core, "/sys/blocked.txt", text) != 0) {
+            return;
+        }
+
+        // Close waits for the read in progress, later calls on the descriptor fail
+        {
+            const auto fd = fs_core.open("/sys/blocked.txt", O_RDONLY, 0);
+            std::atomic<bool> closed{};
+            char buf[32]{};
+            disk->arm();
+            test_task reader([&] { result.read_blocked = fs_core.read(fd, buf, sizeof buf); });
+            disk->wait_entered();
+            test_task closer([&] {
+                result.close_blocked = fs_core.close(fd);
+                closed               = true;
+            });
+            vTaskDelay(pdMS_TO_TICKS(100));
+            result.closed_while_reading = closed;
+            disk->release();
+            reader.join();
+            closer.join();
+            result.read_after_close = fs_core.read(fd, buf, sizeof buf);
+        }
+
+        // Umount closes only the files of its mount point, while descriptors are closed and reused concurrently.
+        // The second device is the same image, mounted read only to leave the first one the only writer.
+        result.race_mount = fs_core.mount("emmc1part0", "/sys2", "vfat", fs::mount_flags::read_only);
+        if (result.race_mount != 0) {
+            return;
+        }
+        int failures = 0;
+        test_task other_mount([&] {
+            for (auto i = 0; i < race_iterations; ++i) {
+                char buf[32]{};
+                const auto fd = fs_core.open("/sys2/blocked.txt", O_RDONLY, 0);
+                if (fd < 0) {
+                    ++failures;
+                    continue;
+                }
+                if (fs_core.read(fd, buf, sizeof buf) != ssize_t(text.size()) || text != buf) {
+                    ++failures;
+                }
+                if (fs_core.close(fd) != 0) {
+                    ++failures;
+                }
+            }
+        });
+        test_task umounted([&] {
+            for (auto i = 0; i < race_iterations; ++i) {
+                char buf[32]{};
+                const auto fd = fs_core.open("/sys/blocked.txt", O_RDONLY, 0);
+                if (fd >= 0) {
+                    fs_core.read(fd, buf, sizeof buf);
+                    fs_core.close(fd);
+                }
+            }
+        });
+        vTaskDelay(pdMS_TO_TICKS(5));
+        result.race_umount = fs_core.umount("/sys");
+        other_mount.join();
+        umounted.join();
+        result.race_failures = failures;
+        fs_core.umount("/sys2");
+
+        if (fs_core.mount("emmc0part0", "/sys", "vfat") == 0) {
+            fs_core.unlink("/sys/blocked.txt");
+            fs_core.umount("/sys");
+        }
+    });
+
+    REQUIRE(result.mount == 0);
+    REQUIRE(result.read_blocked == ssize_t(text.size()));
+    REQUIRE(result.close_blocked == 0);
+    REQUIRE_FALSE(result.closed_while_reading);
+    REQUIRE(result.read_after_close == -EBADF);
+    REQUIRE(result.race_mount == 0);
+    REQUIRE(result.race_umount == 0);
+    REQUIRE(result.race_failures == 0);
+}
@@ -0,0 +1,181 @@
+// Copyright (c) 2017-2021, Mudita Sp. z.o.o. All rights reserved.
+// For licensing, see https://github.com/mudita/MuditaOS/LICENSE.md
+#define CATCH_CONFIG_MAIN
+#include <catch2/catch.hpp>
+
+#include <platform/linux/DiskImage.hpp>
+
+#include <purefs/fs/filesystem.hpp>
+#include <purefs/blkdev/disk_manager.hpp>
+#include <purefs/fs/drivers/filesystem_littlefs.hpp>
+#include <lfs.h>
+#include <sys/stat.h>
+#include <fcntl.h>
+
+#include "test-disks.hpp"
+
+#include <chrono>
+#include <cstdio>
+#include <map>
+#include <string>
+#include <vector>
+
+namespace
+{
+    using ::testing::vfs::counting_disk;
+
+    constexpr auto disk_image = "lfstest.img";
+    constexpr auto block_size = 32U * 1024U;
+
+    struct profile
+    {
+        const char *name;
+        purefs::fs::drivers::littlefs_params params;
+    };
+
+    const std::vector<profile> profiles{
+        {"whole block", {block_size, block_size, block_size, block_size, 0}},
+        {"default", {block_size, 0, 0, 0, 0}},
+        {"user partition", {block_size, 0, 0, 8U * 1024U, 0}},
+    };
+
+    struct measurement
+    {
+        std::size_t sectors{};
+        std::chrono::microseconds time{};
+    };
+
+    template <typename Fn> auto measure(counting_disk &disk, Fn fn) -> measurement
+    {
+        disk.reset();
+        const auto start = std::chrono::steady_clock::now();
+        fn();
+        const auto stop = std::chrono::steady_clock::now();
+        return {disk.sectors_read + disk.sectors_written,
+                std::chrono::duration_cast<std::chrono::microseconds>(stop - start)};
+    }
+
+    auto report(const char *profile, const char *what, const measurement &result) -> void
+    {
+        std::printf("littlefs %-16s %-24s %8zu sectors %8lld us\n",
+                    profile,
+                    what,
+                    result.sectors,
+                    static_cast<long long>(result.time.count()));
+    }
+
+    //! Read all the regular files in the directory
+    auto read_files(purefs::fs::filesystem &fs_core, const std::string &path) -> std::map<std::string, std::string>
+    {
+        std::map<std::string, std::string> files;
+        auto dh = fs_core.diropen(path);
+        REQUIRE(dh);
+        std::string name;
+        struct stat st;
+        while (fs_core.dirnext(dh, name, st) == 0) {
+            if (S_ISREG(st.st_mode)) {
+                files.emplace(name, std::string{});
+            }
+        }
+        REQUIRE(fs_core.dirclose(dh) == 0);
+
+        std::vector<char> buf(4096);
+        for (auto &[name, contents] : files) {
+            const auto fd = fs_core.open(path + "/" + name, O_RDONLY, 0);
+            REQUIRE(fd >= 3);
+            for (ssize_t ret; (ret = fs_core.read(fd, buf.data(), buf.size())) > 0;) {
+                contents.append(buf.data(), ret);
+            }
+            REQUIRE(fs_core.close(fd) == 0);
+        }
+        return files;
+    }
+} // namespace
+
+TEST_CASE("littlefs profiles: Mount and small file reads")
+{
+    using namespace purefs;
+    std::map<std::string, std::size_t> sectors_read;
+    std::map<std::string, std::string> reference;
+
+    for (const auto &prof : profiles) {
+        auto dm   = std::make_shared<blkdev::disk_manager>();
+        auto disk = std::make_shared<counting_disk>(std::make_shared<blkdev::disk_image>(disk_image));
+        REQUIRE(dm->register_device(disk, "emmc0", blkdev::flags::no_sector_cache) == 0);
+        fs::filesystem fs_core(dm);
+        REQUIRE(fs_core.register_filesystem("littlefs", std::make_shared<fs::drivers::filesystem_littlefs>()) == 0);
+
+        const auto mount = measure(*disk, [&] {
+            REQUIRE(fs_core.mount("emmc0part0", "/sys", "littlefs", fs::mount_flags::read_only, &prof.params) == 0);
+        });
+        std::map<std::string, std::string> files;
+        const auto reads = measure(*disk, [&] { files = read_files(fs_core, "/sys"); });
+        REQUIRE(fs_core.umount("/sys") == 0);
+
+        report(prof.name, "mount", mount);
+        report(prof.name, "small file reads", reads);
+        REQUIRE(!files.empty());
+        if (reference.empty()) {
+            reference = files;
+        }
+        REQUIRE(files == reference);
+        sectors_read[prof.name] = mount.sectors + reads.sectors;
+    }
+    REQUIRE(sectors_read["default"] < sectors_read["whole block"]);
+    REQUIRE(sectors_read["user partition"] < sectors_read["whole block"]);
+}
+
+TEST_CASE("littlefs profiles: First write after remount")
+{
+    using namespace purefs;
+    static constexpr auto filename = "/sys/test_profile_tmp.bin";
+    // Larger than a block, so that the write allocates blocks instead of inlining the data in the metadata
+    const std::string data(2 * block_size, 'x');
+
+    for (const auto &prof : profiles) {
+        auto dm   = std::make_shared<blkdev::disk_manager>();
+        auto disk = std::make_shared<counting_disk>(std::make_shared<blkdev::disk_image>(disk_image));
+        REQUIRE(dm->register_device(disk, "emmc0", blkdev::flags::no_sector_cache) == 0);
+        fs::filesystem fs_core(dm);
+        REQUIRE(fs_core.register_filesystem("littlefs", std::make_shared<fs::drivers::filesystem_littlefs>()) == 0);
+
+        const auto write_file = [&] {
+            const auto fd = fs_core.open(filename, O_CREAT | O_RDWR | O_TRUNC, 0);
+            REQUIRE(fd >= 3);
+            REQUIRE(fs_core.write(fd, data.c_str(), data.length()) == static_cast<ssize_t>(data.length()));
+            REQUIRE(fs_core.close(fd) == 0);
+        };
+        const auto remount_and_write = [&](const char *what) {
+            const auto mount = measure(*disk, [&] {
+                REQUIRE(fs_core.mount("emmc0part0", "/sys", "littlefs", 0, &prof.params) == 0);
+            });
+            const auto write = measure(*disk, write_file);
+            REQUIRE(fs_core.umount("/sys") == 0);
+            report(prof.name, (std::string("mount, ") + what).c_str(), mount);
+            report(prof.name, (std::string("first write, ") + what).c_str(), write);
+            return write;
+        };
+
+        // Volume written during the previous mount, its lookahead buffer is filled on the next mount
+        REQUIRE(fs_core.mount("emmc0part0", "/sys", "littlefs", 0, &prof.params) == 0);
+        write_file();
+        REQUIRE(fs_core.umount("/sys") == 0);
+        const auto warm = remount_and_write("written");
+
+        // Volume only read during the previous mount
+        REQUIRE(fs_core.mount("emmc0part0", "/sys", "littlefs", 0, &prof.params) == 0);
+        struct stat st;
+        REQUIRE(fs_core.stat(filename, st) == 0);
+        REQUIRE(st.st_size == static_cast<off_t>(data.length()));
+        REQUIRE(fs_core.umount("/sys") == 0);
+        const auto cold = remount_and_write("read");
+
+#if defined(LFS_VERSION) && LFS_VERSION >= 0x00020008
+        REQUIRE(warm.sectors < cold.sectors);
+#endif
+
+        REQUIRE(fs_core.mount("emmc0part0", "/sys", "littlefs", 0, &prof.params) == 0);
+        REQUIRE(fs_core.unlink(filename) == 0);
+        REQUIRE(fs_core.umount("/sys") == 0);
+    }
+}
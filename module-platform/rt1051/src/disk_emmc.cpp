@@ -98,6 +98,65 @@ namespace purefs::blkdev
         }
         return statusBlkDevSuccess;
     }
+    auto disk_emmc::readv(const std::vector<io_vec> &vecs, hwpart_t hwpart) -> int
+    {
+        cpp_freertos::LockGuard lock(mutex);
+        if (!mmcCard->isHostReady) {
+            return statusBlkDevFail;
+        }
+        auto err = switch_partition(hwpart);
+        if (err != kStatus_Success) {
+            return err;
+        }
+        // The partition is selected and the host enabled once for all the ranges
+        if (pmState == pm_state::suspend) {
+            driverUSDHC->Enable();
+        }
+        for (const auto &vec : vecs) {
+            err = (vec.buf != nullptr)
+                      ? MMC_ReadBlocks(mmcCard.get(), static_cast<uint8_t *>(vec.buf), vec.lba, vec.count)
+                      : statusBlkDevFail;
+            if (err != kStatus_Success) {
+                break;
+            }
+        }
+        if (pmState == pm_state::suspend) {
+            driverUSDHC->Disable();
+        }
+        if (err != kStatus_Success) {
+            return err;
+        }
+        return statusBlkDevSuccess;
+    }
+    auto disk_emmc::writev(const std::vector<io_vec> &vecs, hwpart_t hwpart) -> int
+    {
+        cpp_freertos::LockGuard lock(mutex);
+        if (!mmcCard->isHostReady) {
+            return statusBlkDevFail;
+        }
+        auto err = switch_partition(hwpart);
+        if (err != kStatus_Success) {
+            return err;
+        }
+        if (pmState == pm_state::suspend) {
+            driverUSDHC->Enable();
+        }
+        for (const auto &vec : vecs) {
+            err = (vec.buf != nullptr)
+                      ? MMC_WriteBlocks(mmcCard.get(), static_cast<const uint8_t *>(vec.buf), vec.lba, vec.count)
+                      : statusBlkDevFail;
+            if (err != kStatus_Success) {
+                break;
+            }
+        }
+        if (pmState == pm_state::suspend) {
+            driverUSDHC->Disable();
+        }
+        if (err != kStatus_Success) {
+            return err;
+        }
+        return statusBlkDevSuccess;
+    }
     auto disk_emmc::sync() -> int
     {
         cpp_freertos::LockGuard lock(mutex);
@@ -30,6 +30,8 @@ namespace purefs::blkdev
         auto cleanup() -> int override;
         auto write(const void *buf, sector_t lba, std::size_t count, hwpart_t hwpart) -> int override;
         auto read(void *buf, sector_t lba, std::size_t count, hwpart_t hwpart) -> int override;
+        auto readv(const std::vector<io_vec> &vecs, hwpart_t hwpart) -> int override;
+        auto writev(const std::vector<io_vec> &vecs, hwpart_t hwpart) -> int override;
         auto sync() -> int override;
         auto status() const -> media_status override;
         auto get_info(info_type what, hwpart_t hwpart) const -> scount_t override;
@@ -108,6 +108,11 @@ namespace settings
         return getCache()->getValue({.service = interface.ownerName(), .variable = variableName, .scope = scope});
     }
 
+    std::optional<std::int64_t> Settings::getNumber(const std::string &variableName, SettingsScope scope)
+    {
+        return getCache()->getNumber({.service = interface.ownerName(), .variable = variableName, .scope = scope});
+    }
+
     SettingsCache *Settings::getCache()
     {
         return SettingsCache::getInstance();
@@ -135,15 +135,10 @@ auto SettingsAgent::handleSetVariable(sys::Message *req) -> sys::MessagePointer
         auto oldValue = dbGetValue(path);
         if (oldValue.has_value() && oldValue.value() != value) {
             dbSetValue(path, value);
-            for (const auto &regPath : variableChangeRecipients[path.to_string()]) {
-                if (regPath.service != path.service) {
-                    auto updateMsg =
-                        std::make_shared<settings::Messages::VariableChanged>(regPath, value, oldValue.value_or(""));
-                    parentService->bus.sendUnicast(std::move(updateMsg), regPath.service);
-                    LOG_DEBUG("[SettingsAgent::handleSetVariable] notified service: %s", regPath.service.c_str());
-                }
-            }
         }
+        // Services registered on the change are notified by the settings cache, filled here for the senders which
+        // don't go through it.
+        cache->apply(*msg);
     }
     return std::make_shared<sys::ResponseMessage>();
 }
@@ -4,11 +4,75 @@
 #include <service-db/SettingsCache.hpp>
 #include <mutex.hpp>
 
+#include <array>
+#include <charconv>
+#include <map>
+#include <memory>
+#include <unordered_map>
+#include <vector>
+
 namespace settings
 {
 
     namespace
     {
+        constexpr std::size_t shardsCount = 8;
+
+        struct Entry
+        {
+            std::string value;
+            std::optional<std::int64_t> number;
+            std::uint32_t version = 0;
+        };
+        using Entries = std::unordered_map<std::string, Entry>;
+
+        std::optional<std::int64_t> parseNumber(const std::string &value)
+        {
+            std::int64_t number = 0;
+            const auto end      = value.data() + value.size();
+            if (const auto [last, error] = std::from_chars(value.data(), end, number);
+                error == std::errc{} && last == end) {
+                return number;
+            }
+            return std::nullopt;
+        }
+
+        class Shard
+        {
+          public:
+            std::shared_ptr<const Entries> snapshot() const
+            {
+                cpp_freertos::LockGuard lock(mutex);
+                return entries;
+            }
+
+            /// Sets the value, returns the previous one or std::nullopt if the value didn't change
+            std::optional<std::string> setValue(const std::string &key, const std::string &value)
+            {
+                cpp_freertos::LockGuard lock(mutex);
+                std::string oldValue;
+                if (auto found = entries->find(key); found != entries->end()) {
+                    if (found->second.value == value) {
+                        return std::nullopt;
+                    }
+                    oldValue = found->second.value;
+                }
+                // Snapshots taken by readers must stay as they are, the entries are copied only if there are any
+                if (entries.use_count() > 1) {
+                    entries = std::make_shared<Entries>(*entries);
+                }
+                auto &entry  = (*entries)[key];
+                entry.value  = value;
+                entry.number = parseNumber(value);
+                entry.version++;
+                return oldValue;
+            }
+
+          private:
+            mutable cpp_freertos::MutexStandard mutex;
+            std::shared_ptr<Entries> entries = std::make_shared<Entries>();
+        };
+
         class SettingsCacheImpl : public SettingsCache
         {
           public:
@@ -18,29 +82,72 @@ namespace settings
                 return instance;
             }
 
-            const std::string &getValue(const EntryPath &path) const;
+            /// Calls the reader with the entry of the path or nullptr, the entry is valid only within the call
+            template <typename Reader> auto read(const EntryPath &path, Reader reader) const
+            {
+                const auto key     = path.to_string();
+                const auto entries = shardOf(key).snapshot();
+                const auto found   = entries->find(key);
+                return reader(found != entries->end() ? &found->second : nullptr);
+            }
+
             void setValue(const EntryPath &path, const std::string &value);
+            SubscriptionId subscribe(const EntryPath &path, ChangeCallback callback);
+            void unsubscribe(SubscriptionId id);
 
           private:
-            std::map<EntryPath, std::string> settingsMap;
-            mutable cpp_freertos::MutexStandard settingsMutex;
+            struct Subscription
+            {
+                EntryPath path;
+                std::string key;
+                ChangeCallback callback;
+            };
+
+            const Shard &shardOf(const std::string &key) const
+            {
+                return shards[std::hash<std::string>{}(key) % shardsCount];
+            }
+            Shard &shardOf(const std::string &key)
+            {
+                return shards[std::hash<std::string>{}(key) % shardsCount];
+            }
+
+            std::array<Shard, shardsCount> shards;
+
+            std::map<SubscriptionId, Subscription> subscriptions;
+            SubscriptionId lastSubscriptionId = 0;
+            mutable cpp_freertos::MutexStandard subscriptionsMutex;
         };
 
-        const std::string &SettingsCacheImpl::getValue(const EntryPath &path) const
+        void SettingsCacheImpl::setValue(const EntryPath &path, const std::string &value)
         {
-            static const std::string empty;
-            cpp_freertos::LockGuard lock(settingsMutex);
-            auto pathIt = settingsMap.find(path);
-            if (settingsMap.end() != pathIt) {
-                return pathIt->second;
+            const auto key      = path.to_string();
+            const auto oldValue = shardOf(key).setValue(key, value);
+            if (!oldValue.has_value()) {
+                return;
+            }
+
+            // Callbacks are called under the lock, so none is called anymore once unsubscribe returns
+            cpp_freertos::LockGuard lock(subscriptionsMutex);
+            for (const auto &[id, subscription] : subscriptions) {
+                if (subscription.key == key && subscription.path.service != path.service) {
+                    subscription.callback(subscription.path, value, *oldValue);
+                }
             }
-            return empty;
         }
 
-        void SettingsCacheImpl::setValue(const EntryPath &path, const std::string &value)
+        SettingsCache::SubscriptionId SettingsCacheImpl::subscribe(const EntryPath &path, ChangeCallback callback)
+        {
+            cpp_freertos::LockGuard lock(subscriptionsMutex);
+            const auto id = ++lastSubscriptionId;
+            subscriptions.emplace(id, Subscription{path, path.to_string(), std::move(callback)});
+            return id;
+        }
+
+        void SettingsCacheImpl::unsubscribe(SubscriptionId id)
         {
-            cpp_freertos::LockGuard lock(settingsMutex);
-            settingsMap[path] = value;
+            cpp_freertos::LockGuard lock(subscriptionsMutex);
+            subscriptions.erase(id);
         }
     } // namespace
 
@@ -49,13 +156,44 @@ namespace settings
         return &SettingsCacheImpl::get();
     }
 
-    const std::string &SettingsCache::getValue(const EntryPath &path) const
+    std::string SettingsCache::getValue(const EntryPath &path) const
+    {
+        return SettingsCacheImpl::get().read(
+            path, [](const Entry *entry) { return entry != nullptr ? entry->value : std::string{}; });
+    }
+
+    std::optional<std::int64_t> SettingsCache::getNumber(const EntryPath &path) const
     {
-        return SettingsCacheImpl::get().getValue(path);
+        return SettingsCacheImpl::get().read(path, [](const Entry *entry) {
+            return entry != nullptr ? entry->number : std::nullopt;
+        });
+    }
+
+    std::uint32_t SettingsCache::getVersion(const EntryPath &path) const
+    {
+        return SettingsCacheImpl::get().read(
+            path, [](const Entry *entry) { return entry != nullptr ? entry->version : std::uint32_t{0}; });
     }
 
     void SettingsCache::setValue(const EntryPath &path, const std::string &value)
     {
         return SettingsCacheImpl::get().setValue(path, value);
     }
+
+    void SettingsCache::apply(const Messages::SetVariable &message)
+    {
+        if (!message.isCacheUpdated()) {
+            setValue(message.getPath(), message.getValue().value_or(""));
+        }
+    }
+
+    SettingsCache::SubscriptionId SettingsCache::subscribe(const EntryPath &path, ChangeCallback callback)
+    {
+        return SettingsCacheImpl::get().subscribe(path, std::move(callback));
+    }
+
+    void SettingsCache::unsubscribe(SubscriptionId id)
+    {
+        SettingsCacheImpl::get().unsubscribe(id);
+    }
 } // namespace settings
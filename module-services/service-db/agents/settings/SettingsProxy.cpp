@@ -41,6 +41,10 @@ namespace settings
 
     void SettingsProxy::deinit()
     {
+        for (const auto &[path, id] : subscriptions) {
+            SettingsCache::getInstance()->unsubscribe(id);
+        }
+        subscriptions.clear();
         if (isValid()) {
             getService()->disconnect(typeid(settings::Messages::VariableChanged));
         }
@@ -65,17 +69,35 @@ namespace settings
 
     void SettingsProxy::registerValueChange(EntryPath path)
     {
+        if (subscriptions.find(path) == subscriptions.end()) {
+            // Called in the thread of the service changing the value, the change is passed on as a message
+            auto onChange = [service = std::weak_ptr<sys::Service>(getService())](
+                                const EntryPath &changed, const std::string &value, const std::string &oldValue) {
+                if (auto owner = service.lock(); owner != nullptr) {
+                    owner->bus.sendUnicast(
+                        std::make_shared<settings::Messages::VariableChanged>(changed, value, oldValue),
+                        owner->GetName());
+                }
+            };
+            subscriptions[path] = SettingsCache::getInstance()->subscribe(path, std::move(onChange));
+        }
+        // service-db still sends the current value right away
         message<settings::Messages::RegisterOnVariableChange>(getService()->bus, std::move(path));
     }
 
     void SettingsProxy::unregisterValueChange(EntryPath path)
     {
+        if (auto subscription = subscriptions.find(path); subscription != subscriptions.end()) {
+            SettingsCache::getInstance()->unsubscribe(subscription->second);
+            subscriptions.erase(subscription);
+        }
         message<settings::Messages::UnregisterOnVariableChange>(getService()->bus, std::move(path));
     }
 
     void SettingsProxy::setValue(const EntryPath &path, const std::string &value)
     {
-        message<settings::Messages::SetVariable>(getService()->bus, path, value);
+        // Settings put the value into the cache before sending it
+        message<settings::Messages::SetVariable>(getService()->bus, path, value, true);
     }
 
 } // namespace settings
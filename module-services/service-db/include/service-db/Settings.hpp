@@ -45,6 +45,9 @@ namespace settings
         void unregisterValueChange(const std::string &variableName, SettingsScope scope = SettingsScope::AppLocal);
         /// unregisters all registered variables (both global and local)
         std::string getValue(const std::string &variableName, SettingsScope scope = SettingsScope::AppLocal);
+        /// Value as a number without parsing it on each read, std::nullopt if it is not set or not a number
+        std::optional<std::int64_t> getNumber(const std::string &variableName,
+                                              SettingsScope scope = SettingsScope::AppLocal);
 
         SettingsCache *getCache();
 
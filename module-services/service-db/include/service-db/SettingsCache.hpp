@@ -4,15 +4,40 @@
 #pragma once
 
 #include "SettingsMessages.hpp"
-#include <map>
+
+#include <cstdint>
+#include <functional>
+#include <optional>
+#include <string>
 
 namespace settings
 {
+    /// Process-wide copy of the settings, read by every service without asking service-db.
+    /// Settings are spread over shards, each with a snapshot replaced on write (copy-on-write), so a reader only
+    /// holds the shard lock to take the snapshot and never waits for a lookup or a copy done by another thread.
     class SettingsCache
     {
       public:
-        const std::string &getValue(const EntryPath &path) const;
+        /// Called with the path of the subscriber, the new and the old value. Runs in the thread changing the value,
+        /// so it should only pass the change on (e.g. post a message) and not call back into the cache.
+        using ChangeCallback =
+            std::function<void(const EntryPath &path, const std::string &value, const std::string &oldValue)>;
+        using SubscriptionId = std::uint32_t;
+
+        std::string getValue(const EntryPath &path) const;
+        /// Value as a number, parsed once when the value is set; std::nullopt if unset or not a number
+        std::optional<std::int64_t> getNumber(const EntryPath &path) const;
+        /// Number of changes of the value, 0 if never set. Lets readers tell cheaply if the value changed.
+        std::uint32_t getVersion(const EntryPath &path) const;
         void setValue(const EntryPath &path, const std::string &value);
+        /// Puts the value of the message into the cache unless the sender has already done it. Setting it again
+        /// would bring back a value the sender may have changed since sending the message.
+        void apply(const Messages::SetVariable &message);
+
+        /// Calls the callback on every change of the value made on behalf of a service other than path.service
+        SubscriptionId subscribe(const EntryPath &path, ChangeCallback callback);
+        void unsubscribe(SubscriptionId id);
+
         static SettingsCache *getInstance();
         virtual ~SettingsCache() = default;
     };
@@ -61,8 +61,18 @@ namespace settings
         {
           public:
             SetVariable() = default;
-            SetVariable(EntryPath path, std::string value) : Variable(std::move(path), value)
+            SetVariable(EntryPath path, std::string value, bool cacheUpdated = false)
+                : Variable(std::move(path), value), cacheUpdated(cacheUpdated)
             {}
+
+            /// Whether the sender has already put the value into the settings cache
+            [[nodiscard]] auto isCacheUpdated() const noexcept -> bool
+            {
+                return cacheUpdated;
+            }
+
+          private:
+            bool cacheUpdated = false;
         };
 
         class RegisterOnVariableChange : public Variable
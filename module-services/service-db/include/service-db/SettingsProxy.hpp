@@ -3,8 +3,10 @@
 #pragma once
 
 #include "EntryPath.hpp"
+#include "SettingsCache.hpp"
 #include "Service/ServiceProxy.hpp"
 #include <functional>
+#include <map>
 
 namespace settings
 {
@@ -26,5 +28,7 @@ namespace settings
 
       private:
         std::function<void(EntryPath, std::string)> onChangeHandler;
+        /// Changes made by other services are pushed by the settings cache, not sent by service-db
+        std::map<EntryPath, SettingsCache::SubscriptionId> subscriptions;
     };
 } // namespace settings
@@ -38,10 +38,13 @@ namespace settings
         return "";
     }
 
-    const std::string &SettingsCache::getValue(const EntryPath &path) const
+    std::string SettingsCache::getValue(const EntryPath &path) const
     {
-        static const std::string val;
-        return val;
+        return {};
+    }
+    std::optional<std::int64_t> SettingsCache::getNumber(const EntryPath &path) const
+    {
+        return std::nullopt;
     }
     void SettingsCache::setValue(const EntryPath &path, const std::string &value)
     {}
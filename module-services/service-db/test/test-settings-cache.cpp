@@ -0,0 +1,117 @@
+// Copyright (c) 2017-2021, Mudita Sp. z.o.o. All rights reserved.
+// For licensing, see https://github.com/mudita/MuditaOS/LICENSE.md
+
+#include <catch2/catch.hpp>
+#include <service-db/SettingsCache.hpp>
+
+#include <vector>
+
+using namespace settings;
+
+TEST_CASE("Settings cache - values")
+{
+    auto cache = SettingsCache::getInstance();
+    EntryPath path{"mode", "service", "profile", "values", SettingsScope::AppLocal};
+
+    REQUIRE(cache->getValue(path).empty());
+    REQUIRE(!cache->getNumber(path).has_value());
+    REQUIRE(cache->getVersion({"mode", "service", "profile", "unset", SettingsScope::AppLocal}) == 0);
+
+    SECTION("number")
+    {
+        const auto version = cache->getVersion(path);
+        cache->setValue(path, "-42");
+        REQUIRE(cache->getValue(path) == "-42");
+        REQUIRE(cache->getNumber(path) == -42);
+        REQUIRE(cache->getVersion(path) == version + 1);
+
+        cache->setValue(path, "42a");
+        REQUIRE(!cache->getNumber(path).has_value());
+        REQUIRE(cache->getVersion(path) == version + 2);
+    }
+
+    SECTION("same value doesn't change the version")
+    {
+        cache->setValue(path, "value");
+        const auto version = cache->getVersion(path);
+        cache->setValue(path, "value");
+        REQUIRE(cache->getVersion(path) == version);
+    }
+
+    SECTION("value read is a copy")
+    {
+        cache->setValue(path, "first");
+        const auto value = cache->getValue(path);
+        cache->setValue(path, "second");
+        REQUIRE(value == "first");
+        REQUIRE(cache->getValue(path) == "second");
+    }
+
+    cache->setValue(path, "");
+}
+
+TEST_CASE("Settings cache - subscriptions")
+{
+    auto cache = SettingsCache::getInstance();
+    EntryPath global{"", "", "", "subscribed", SettingsScope::Global};
+    EntryPath subscriber{"", "subscriber", "", "subscribed", SettingsScope::Global};
+    EntryPath setter{"", "setter", "", "subscribed", SettingsScope::Global};
+
+    std::vector<std::pair<std::string, std::string>> changes;
+    const auto id = cache->subscribe(
+        subscriber, [&changes](const EntryPath &path, const std::string &value, const std::string &oldValue) {
+            REQUIRE(path.service == "subscriber");
+            changes.emplace_back(value, oldValue);
+        });
+
+    cache->setValue(setter, "1");
+    cache->setValue(setter, "1");
+    REQUIRE(changes.size() == 1);
+    REQUIRE(changes.back() == std::pair<std::string, std::string>{"1", ""});
+
+    // changes made by the subscriber itself are not reported back
+    cache->setValue(subscriber, "2");
+    REQUIRE(changes.size() == 1);
+    REQUIRE(cache->getValue(global) == "2");
+
+    cache->unsubscribe(id);
+    cache->setValue(setter, "3");
+    REQUIRE(changes.size() == 1);
+}
+
+TEST_CASE("Settings cache - set variable messages")
+{
+    auto cache = SettingsCache::getInstance();
+    EntryPath subscriber{"", "subscriber", "", "messages", SettingsScope::Global};
+    EntryPath setter{"", "setter", "", "messages", SettingsScope::Global};
+
+    std::vector<std::string> changes;
+    const auto id = cache->subscribe(
+        subscriber,
+        [&changes](const EntryPath &, const std::string &value, const std::string &) { changes.push_back(value); });
+
+    SECTION("two quick sets of the same key through the cache")
+    {
+        // Both values are in the cache before service-db handles the first message
+        cache->setValue(setter, "1");
+        const Messages::SetVariable first{setter, "1", true};
+        cache->setValue(setter, "2");
+        const Messages::SetVariable second{setter, "2", true};
+
+        cache->apply(first);
+        REQUIRE(cache->getValue(setter) == "2");
+        cache->apply(second);
+        REQUIRE(cache->getValue(setter) == "2");
+        REQUIRE(changes == std::vector<std::string>{"1", "2"});
+    }
+
+    SECTION("set bypassing the cache")
+    {
+        cache->apply(Messages::SetVariable{setter, "3"});
+        REQUIRE(cache->getValue(setter) == "3");
+        REQUIRE(changes == std::vector<std::string>{"3"});
+    }
+
+    cache->unsubscribe(id);
+    cache->setValue(setter, "");
+}
@@ -105,11 +105,18 @@ namespace service::eink
 
     EinkStatus_e EinkDisplay::update(std::uint8_t *displayBuffer)
     {
-        return EinkUpdateFrame(pointTopLeft.x,
-                               pointTopLeft.y,
-                               size.width,
-                               size.height,
-                               displayBuffer,
+        return update(displayBuffer, {pointTopLeft.x, pointTopLeft.y, size.width, size.height});
+    }
+
+    EinkStatus_e EinkDisplay::update(std::uint8_t *displayBuffer, const ::gui::BoundingBox &window)
+    {
+        // The driver reads the window from the buffer using the display width as the row stride.
+        const auto windowOffset = static_cast<std::size_t>(window.y) * size.width + window.x;
+        return EinkUpdateFrame(window.x,
+                               window.y,
+                               window.w,
+                               window.h,
+                               displayBuffer + windowOffset,
                                getCurrentBitsPerPixelFormat(),
                                displayMode);
     }
@@ -123,9 +130,14 @@ namespace service::eink
     }
 
     EinkStatus_e EinkDisplay::refresh(EinkDisplayTimingsMode_e refreshMode)
+    {
+        return refresh(refreshMode, {pointTopLeft.x, pointTopLeft.y, size.width, size.height});
+    }
+
+    EinkStatus_e EinkDisplay::refresh(EinkDisplayTimingsMode_e refreshMode, const ::gui::BoundingBox &window)
     {
         currentWaveform.useCounter += 1;
-        return EinkRefreshImage(pointTopLeft.x, pointTopLeft.y, size.width, size.height, refreshMode);
+        return EinkRefreshImage(window.x, window.y, window.w, window.h, refreshMode);
     }
 
     bool EinkDisplay::isNewWaveformNeeded(EinkWaveforms_e newMode, std::int32_t newTemperature) const
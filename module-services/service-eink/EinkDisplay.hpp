@@ -4,6 +4,7 @@
 #pragma once
 
 #include <gui/Common.hpp>
+#include <gui/core/BoundingBox.hpp>
 
 #include <EinkIncludes.hpp>
 #include "Common.hpp"
@@ -28,7 +29,11 @@ namespace service::eink
 
         EinkStatus_e resetAndInit();
         EinkStatus_e update(std::uint8_t *displayBuffer);
+        /// Transfers only the window of the frame buffer to the display memory
+        EinkStatus_e update(std::uint8_t *displayBuffer, const ::gui::BoundingBox &window);
         EinkStatus_e refresh(EinkDisplayTimingsMode_e refreshMode);
+        /// Refreshes only the window of the display
+        EinkStatus_e refresh(EinkDisplayTimingsMode_e refreshMode, const ::gui::BoundingBox &window);
         void dither();
         void powerOn();
         void powerOff();
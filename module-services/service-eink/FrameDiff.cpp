@@ -0,0 +1,124 @@
+// Copyright (c) 2017-2021, Mudita Sp. z.o.o. All rights reserved.
+// For licensing, see https://github.com/mudita/MuditaOS/LICENSE.md
+
+#include "FrameDiff.hpp"
+
+#include <algorithm>
+#include <cstring>
+
+namespace service::eink
+{
+    namespace
+    {
+        /// Unchanged rows between changed ones which are still merged into a single window. Sending a few more rows is
+        /// cheaper than sending another window.
+        constexpr auto MaxRowsGap = 16U;
+
+        std::uint32_t alignDown(std::uint32_t value, std::uint32_t alignment) noexcept
+        {
+            return value - value % alignment;
+        }
+
+        std::uint32_t alignUp(std::uint32_t value, std::uint32_t alignment) noexcept
+        {
+            return alignDown(value + alignment - 1, alignment);
+        }
+    } // namespace
+
+    FrameDiff::FrameDiff(::gui::Size screenSize)
+        : size{screenSize}, lastFrame(static_cast<std::size_t>(screenSize.width) * screenSize.height)
+    {}
+
+    auto FrameDiff::update(const std::uint8_t *frame) -> std::vector<::gui::BoundingBox>
+    {
+        if (!isLastFrameValid) {
+            std::memcpy(lastFrame.data(), frame, lastFrame.size());
+            isLastFrameValid = true;
+            return {::gui::BoundingBox{0, 0, size.width, size.height}};
+        }
+
+        auto windows = findChangedWindows(frame);
+        store(frame, windows);
+        return windows;
+    }
+
+    void FrameDiff::invalidate() noexcept
+    {
+        isLastFrameValid = false;
+    }
+
+    auto FrameDiff::findChangedWindows(const std::uint8_t *frame) const -> std::vector<::gui::BoundingBox>
+    {
+        std::vector<::gui::BoundingBox> windows;
+        std::uint32_t left = size.width, right = 0, top = 0, lastChangedRow = 0;
+        bool isWindowOpen = false;
+
+        const auto closeWindow = [&]() {
+            windows.push_back(align(::gui::BoundingBox(left, top, right - left, lastChangedRow + 1 - top)));
+            left         = size.width;
+            right        = 0;
+            isWindowOpen = false;
+        };
+
+        for (std::uint32_t row = 0; row < size.height; ++row) {
+            const auto offset     = static_cast<std::size_t>(row) * size.width;
+            const auto *newPixels = frame + offset;
+            const auto *oldPixels = lastFrame.data() + offset;
+            if (std::memcmp(newPixels, oldPixels, size.width) == 0) {
+                continue;
+            }
+
+            if (isWindowOpen && row - lastChangedRow > MaxRowsGap) {
+                closeWindow();
+            }
+            if (!isWindowOpen) {
+                top          = row;
+                isWindowOpen = true;
+            }
+            lastChangedRow = row;
+
+            std::uint32_t first = 0;
+            while (newPixels[first] == oldPixels[first]) {
+                ++first;
+            }
+            std::uint32_t last = size.width - 1;
+            while (newPixels[last] == oldPixels[last]) {
+                --last;
+            }
+            left  = std::min(left, first);
+            right = std::max(right, last + 1);
+        }
+        if (isWindowOpen) {
+            closeWindow();
+        }
+
+        if (windows.size() > MaxWindows) {
+            auto whole = ::gui::BoundingBox{};
+            for (const auto &window : windows) {
+                whole = ::gui::BoundingBox::unite(whole, window);
+            }
+            return {whole};
+        }
+        return windows;
+    }
+
+    auto FrameDiff::align(::gui::BoundingBox window) const noexcept -> ::gui::BoundingBox
+    {
+        const auto left   = alignDown(window.x, WindowAlignment);
+        const auto top    = alignDown(window.y, WindowAlignment);
+        const auto right  = std::min(alignUp(window.x + window.w, WindowAlignment), size.width);
+        const auto bottom = std::min(alignUp(window.y + window.h, WindowAlignment), size.height);
+        return ::gui::BoundingBox(left, top, right - left, bottom - top);
+    }
+
+    void FrameDiff::store(const std::uint8_t *frame, const std::vector<::gui::BoundingBox> &windows)
+    {
+        for (const auto &window : windows) {
+            auto offset = static_cast<std::size_t>(window.y) * size.width + window.x;
+            for (std::uint32_t row = 0; row < window.h; ++row) {
+                std::memcpy(lastFrame.data() + offset, frame + offset, window.w);
+                offset += size.width;
+            }
+        }
+    }
+} // namespace service::eink
@@ -0,0 +1,46 @@
+// Copyright (c) 2017-2021, Mudita Sp. z.o.o. All rights reserved.
+// For licensing, see https://github.com/mudita/MuditaOS/LICENSE.md
+
+#pragma once
+
+#include <gui/Common.hpp>
+#include <gui/core/BoundingBox.hpp>
+
+#include <cstdint>
+#include <vector>
+
+namespace service::eink
+{
+    /**
+     * Keeps the frame last shown on the display and finds the windows of a new frame which differ from it.
+     * Windows are aligned to the display transfer granularity, so they can be passed directly to the driver.
+     */
+    class FrameDiff
+    {
+      public:
+        static constexpr auto WindowAlignment = 8U;
+        static constexpr auto MaxWindows      = 4U;
+
+        explicit FrameDiff(::gui::Size screenSize);
+
+        /**
+         * Compares the frame with the last one and stores it as the last one
+         * @param frame     Frame of the screen size, one byte per pixel
+         * @return Windows which changed, whole frame if the last one is unknown, empty if nothing changed
+         */
+        [[nodiscard]] auto update(const std::uint8_t *frame) -> std::vector<::gui::BoundingBox>;
+        /**
+         * Forgets the last frame, e.g. when the display content is changed in other way
+         */
+        void invalidate() noexcept;
+
+      private:
+        [[nodiscard]] auto findChangedWindows(const std::uint8_t *frame) const -> std::vector<::gui::BoundingBox>;
+        [[nodiscard]] auto align(::gui::BoundingBox window) const noexcept -> ::gui::BoundingBox;
+        void store(const std::uint8_t *frame, const std::vector<::gui::BoundingBox> &windows);
+
+        const ::gui::Size size;
+        std::vector<std::uint8_t> lastFrame;
+        bool isLastFrameValid = false;
+    };
+} // namespace service::eink
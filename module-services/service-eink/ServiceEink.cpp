@@ -9,6 +9,7 @@
 #include <service-gui/messages/EinkInitialized.hpp>
 #include <time/ScopedTime.hpp>
 #include <Timers/TimerFactory.hpp>
+#include <Service/MessagePool.hpp>
 
 #include <log/log.hpp>
 #include <messages/EinkMessage.hpp>
@@ -42,7 +43,7 @@ namespace service::eink
     ServiceEink::ServiceEink(ExitAction exitAction, const std::string &name, std::string parent)
         : sys::Service(name, std::move(parent), ServceEinkStackDepth),
           exitAction{exitAction}, display{{BOARD_EINK_DISPLAY_RES_X, BOARD_EINK_DISPLAY_RES_Y}},
-          currentState{State::Running}, settings{std::make_unique<settings::Settings>()}
+          frameDiff{display.getSize()}, currentState{State::Running}, settings{std::make_unique<settings::Settings>()}
     {
         displayPowerOffTimer = sys::TimerFactory::createSingleShotTimer(
             this, "einkDisplayPowerOff", displayPowerOffTimeout, [this](sys::Timer &) { display.powerOff(); });
@@ -100,6 +101,7 @@ namespace service::eink
     {
         if (exitAction == ExitAction::WipeOut) {
             display.wipeOut();
+            frameDiff.invalidate();
         }
         display.shutdown();
         settings->deinit();
@@ -130,6 +132,7 @@ namespace service::eink
     void ServiceEink::enterActiveMode()
     {
         setState(State::Running);
+        frameDiff.invalidate();
 
         if (const auto status = display.resetAndInit(); status != EinkOK) {
             LOG_FATAL("Error: Could not initialize Eink display!");
@@ -141,6 +144,7 @@ namespace service::eink
     void ServiceEink::suspend()
     {
         setState(State::Suspended);
+        frameDiff.invalidate();
         display.shutdown();
     }
 
@@ -163,6 +167,7 @@ namespace service::eink
             display.setMode(EinkDisplayColorMode_e::EinkDisplayColorModeStandard);
         }
         internal::StaticData::get().setInvertedMode(invertedModeRequested);
+        frameDiff.invalidate();
     }
 
     sys::MessagePointer ServiceEink::handleImageMessage(sys::Message *request)
@@ -175,11 +180,19 @@ namespace service::eink
         utils::time::Scoped measurement("ImageMessage");
 
         showImage(message->getData(), message->getRefreshMode());
-        return std::make_shared<service::eink::ImageDisplayedNotification>(message->getContextId());
+        return sys::makePooledMessage<service::eink::ImageDisplayedNotification>(message->getContextId());
     }
 
     void ServiceEink::showImage(std::uint8_t *frameBuffer, ::gui::RefreshModes refreshMode)
     {
+        auto windows = frameDiff.update(frameBuffer);
+        if (refreshMode == ::gui::RefreshModes::GUI_REFRESH_DEEP) {
+            windows = {::gui::BoundingBox{0, 0, display.getSize().width, display.getSize().height}};
+        }
+        if (windows.empty()) {
+            return;
+        }
+
         displayPowerOffTimer.stop();
 
         auto displayPowerOffTimerReload = gsl::finally([this]() { displayPowerOffTimer.start(); });
@@ -187,29 +200,42 @@ namespace service::eink
         if (const auto status = prepareDisplay(refreshMode, WaveformTemperature::KEEP_CURRENT);
             status != EinkStatus_e ::EinkOK) {
             LOG_FATAL("Failed to prepare frame");
+            frameDiff.invalidate();
             return;
         }
 
-        if (const auto status = updateDisplay(frameBuffer, refreshMode); status != EinkStatus_e ::EinkOK) {
+        if (const auto status = updateDisplay(frameBuffer, windows); status != EinkStatus_e ::EinkOK) {
             LOG_FATAL("Failed to update frame");
+            frameDiff.invalidate();
             return;
         }
 
-        if (const auto status = refreshDisplay(refreshMode); status != EinkStatus_e ::EinkOK) {
+        auto refreshWindow = ::gui::BoundingBox{};
+        for (const auto &window : windows) {
+            refreshWindow = ::gui::BoundingBox::unite(refreshWindow, window);
+        }
+        if (const auto status = refreshDisplay(refreshMode, refreshWindow); status != EinkStatus_e ::EinkOK) {
             LOG_FATAL("Failed to refresh frame");
+            frameDiff.invalidate();
             return;
         }
     }
 
-    EinkStatus_e ServiceEink::updateDisplay(std::uint8_t *frameBuffer, ::gui::RefreshModes refreshMode)
+    EinkStatus_e ServiceEink::updateDisplay(std::uint8_t *frameBuffer, const std::vector<::gui::BoundingBox> &windows)
     {
-        return display.update(frameBuffer);
+        for (const auto &window : windows) {
+            if (const auto status = display.update(frameBuffer, window); status != EinkStatus_e::EinkOK) {
+                return status;
+            }
+        }
+        return EinkStatus_e::EinkOK;
     }
 
-    EinkStatus_e ServiceEink::refreshDisplay(::gui::RefreshModes refreshMode)
+    EinkStatus_e ServiceEink::refreshDisplay(::gui::RefreshModes refreshMode, const ::gui::BoundingBox &window)
     {
         const auto isDeepRefresh = refreshMode == ::gui::RefreshModes::GUI_REFRESH_DEEP;
-        return display.refresh(isDeepRefresh ? EinkDisplayTimingsDeepCleanMode : EinkDisplayTimingsFastRefreshMode);
+        return display.refresh(isDeepRefresh ? EinkDisplayTimingsDeepCleanMode : EinkDisplayTimingsFastRefreshMode,
+                               window);
     }
 
     EinkStatus_e ServiceEink::prepareDisplay(::gui::RefreshModes refreshMode, WaveformTemperature behaviour)
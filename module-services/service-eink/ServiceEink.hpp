@@ -10,6 +10,7 @@
 
 #include "EinkSentinel.hpp"
 #include "EinkDisplay.hpp"
+#include "FrameDiff.hpp"
 
 #include <service-db/DBServiceName.hpp>
 #include <service-db/Settings.hpp>
@@ -18,6 +19,7 @@
 #include <chrono>
 #include <cstdint>
 #include <string>
+#include <vector>
 #include <module-services/service-eink/messages/EinkModeMessage.hpp>
 
 namespace service::eink
@@ -63,8 +65,8 @@ namespace service::eink
 
         void showImage(std::uint8_t *frameBuffer, ::gui::RefreshModes refreshMode);
         EinkStatus_e prepareDisplay(::gui::RefreshModes refreshMode, WaveformTemperature behaviour);
-        EinkStatus_e refreshDisplay(::gui::RefreshModes refreshMode);
-        EinkStatus_e updateDisplay(uint8_t *frameBuffer, ::gui::RefreshModes refreshMode);
+        EinkStatus_e refreshDisplay(::gui::RefreshModes refreshMode, const ::gui::BoundingBox &window);
+        EinkStatus_e updateDisplay(uint8_t *frameBuffer, const std::vector<::gui::BoundingBox> &windows);
         void setDisplayMode(EinkModeMessage::Mode mode);
 
         sys::MessagePointer handleEinkModeChangedMessage(sys::Message *message);
@@ -75,6 +77,7 @@ namespace service::eink
 
         ExitAction exitAction;
         EinkDisplay display;
+        FrameDiff frameDiff;
         State currentState;
         sys::TimerHandle displayPowerOffTimer;
         std::shared_ptr<EinkSentinel> eInkSentinel;
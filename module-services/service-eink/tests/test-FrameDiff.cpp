@@ -0,0 +1,80 @@
+// Copyright (c) 2017-2021, Mudita Sp. z.o.o. All rights reserved.
+// For licensing, see https://github.com/mudita/MuditaOS/LICENSE.md
+
+#include <catch2/catch.hpp>
+
+#include "FrameDiff.hpp"
+
+#include <vector>
+
+using namespace service::eink;
+
+namespace
+{
+    constexpr auto Width  = 64U;
+    constexpr auto Height = 96U;
+
+    void setPixel(std::vector<std::uint8_t> &frame, std::uint32_t x, std::uint32_t y, std::uint8_t colour)
+    {
+        frame[y * Width + x] = colour;
+    }
+} // namespace
+
+TEST_CASE("FrameDiffTests")
+{
+    FrameDiff diff{{Width, Height}};
+    std::vector<std::uint8_t> frame(Width * Height, 0x0F);
+
+    SECTION("First frame is changed as a whole")
+    {
+        const auto windows = diff.update(frame.data());
+        REQUIRE(windows.size() == 1U);
+        REQUIRE(windows[0] == ::gui::BoundingBox{0, 0, Width, Height});
+    }
+
+    SECTION("Nothing changed")
+    {
+        (void)diff.update(frame.data());
+        REQUIRE(diff.update(frame.data()).empty());
+    }
+
+    SECTION("Single pixel changed")
+    {
+        (void)diff.update(frame.data());
+        setPixel(frame, 10, 20, 0x00);
+        const auto windows = diff.update(frame.data());
+        REQUIRE(windows.size() == 1U);
+        REQUIRE(windows[0] == ::gui::BoundingBox{8, 16, 8, 8});
+        REQUIRE(diff.update(frame.data()).empty());
+    }
+
+    SECTION("Distant changes are sent in separate windows")
+    {
+        (void)diff.update(frame.data());
+        setPixel(frame, 1, 1, 0x00);
+        setPixel(frame, 60, 90, 0x00);
+        const auto windows = diff.update(frame.data());
+        REQUIRE(windows.size() == 2U);
+        REQUIRE(windows[0] == ::gui::BoundingBox{0, 0, 8, 8});
+        REQUIRE(windows[1] == ::gui::BoundingBox{56, 88, 8, 8});
+    }
+
+    SECTION("Near changes are merged")
+    {
+        (void)diff.update(frame.data());
+        setPixel(frame, 1, 1, 0x00);
+        setPixel(frame, 30, 10, 0x00);
+        const auto windows = diff.update(frame.data());
+        REQUIRE(windows.size() == 1U);
+        REQUIRE(windows[0] == ::gui::BoundingBox{0, 0, 32, 16});
+    }
+
+    SECTION("Invalidated frame is changed as a whole")
+    {
+        (void)diff.update(frame.data());
+        diff.invalidate();
+        const auto windows = diff.update(frame.data());
+        REQUIRE(windows.size() == 1U);
+        REQUIRE(windows[0] == ::gui::BoundingBox{0, 0, Width, Height});
+    }
+}
@@ -5,6 +5,7 @@
 #include <service-fileindexer/StartupIndexer.hpp>
 #include <service-fileindexer/Constants.hpp>
 
+#include <Service/MessagePool.hpp>
 #include <Timers/TimerFactory.hpp>
 #include <purefs/filesystem_paths.hpp>
 #include <purefs/fs/inotify_message.hpp>
@@ -42,8 +43,8 @@ namespace service::detail
             }
 
             const auto abspath = fs::absolute(entry).string();
-            const auto inotifyMsg =
-                std::make_shared<purefs::fs::message::inotify>(purefs::fs::inotify_flags::close_write, abspath, ""sv);
+            const auto inotifyMsg = sys::makePooledMessage<purefs::fs::message::inotify>(
+                purefs::fs::inotify_flags::close_write, abspath, ""sv);
             svc->bus.sendUnicast(inotifyMsg, std::string(service::name::file_indexer));
         }
     }
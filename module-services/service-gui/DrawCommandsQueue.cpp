@@ -48,6 +48,19 @@ namespace service::gui
         return maxRefreshMode;
     }
 
+    auto DrawCommandsQueue::getDirtyArea() const -> std::optional<::gui::BoundingBox>
+    {
+        cpp_freertos::LockGuard lock{queueMutex};
+        ::gui::BoundingBox dirtyArea;
+        for (const auto &item : queue) {
+            if (!item.dirtyArea.has_value()) {
+                return std::nullopt;
+            }
+            dirtyArea = ::gui::BoundingBox::unite(dirtyArea, *item.dirtyArea);
+        }
+        return dirtyArea;
+    }
+
     void DrawCommandsQueue::clear()
     {
         cpp_freertos::LockGuard lock{queueMutex};
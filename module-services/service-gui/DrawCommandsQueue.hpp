@@ -5,11 +5,11 @@
 
 #include "SynchronizationMechanism.hpp"
 
-#include <gui/core/DrawCommand.hpp>
+#include <gui/core/DrawCommandList.hpp>
 
 #include <cstdint>
-#include <list>
 #include <memory>
+#include <optional>
 #include <vector>
 
 namespace service::gui
@@ -17,11 +17,12 @@ namespace service::gui
     class DrawCommandsQueue
     {
       public:
-        using CommandList = std::list<std::unique_ptr<::gui::DrawCommand>>;
+        using CommandList = ::gui::DrawCommandList;
         struct QueueItem
         {
             CommandList commands;
             ::gui::RefreshModes refreshMode = ::gui::RefreshModes::GUI_REFRESH_FAST;
+            std::optional<::gui::BoundingBox> dirtyArea;
         };
         using QueueContainer = std::vector<QueueItem>;
 
@@ -32,6 +33,8 @@ namespace service::gui
         void enqueue(QueueItem &&item);
         [[nodiscard]] auto dequeue() -> QueueItem;
         [[nodiscard]] auto getMaxRefreshModeAndClear() -> ::gui::RefreshModes;
+        /// Gets area covered by all queued items, so that it is not lost when the items are dropped
+        [[nodiscard]] auto getDirtyArea() const -> std::optional<::gui::BoundingBox>;
         void clear();
         [[nodiscard]] auto size() const noexcept -> QueueContainer::size_type;
 
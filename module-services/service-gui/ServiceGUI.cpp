@@ -9,10 +9,11 @@
 #include "messages/EinkInitialized.hpp"
 #include "messages/ChangeColorScheme.hpp"
 
-#include <DrawCommand.hpp>
+#include <DrawCommandList.hpp>
 #include <FontManager.hpp>
 #include <gui/core/ImageManager.hpp>
 #include <log/log.hpp>
+#include <Service/MessagePool.hpp>
 #include <service-eink/Common.hpp>
 #include <service-eink/messages/ImageMessage.hpp>
 #include <service-eink/messages/EinkMessage.hpp>
@@ -128,12 +129,17 @@ namespace service::gui
             LOG_WARN("Service not yet initialised - ignoring draw commands");
             return std::make_shared<sys::ResponseMessage>(sys::ReturnCodes::Unresolved);
         }
+        const auto drawMsg = static_cast<DrawMessage *>(message);
         if (isInState(State::Suspended) || lastRenderScheduled) {
             LOG_WARN("Ignoring draw commands");
+            keepDroppedDirtyArea(*drawMsg);
             return std::make_shared<sys::ResponseMessage>(sys::ReturnCodes::Unresolved);
         }
 
-        if (const auto drawMsg = static_cast<DrawMessage *>(message); !drawMsg->commands.empty()) {
+        if (drawMsg->commands.empty()) {
+            keepDroppedDirtyArea(*drawMsg);
+        }
+        else {
             if (drawMsg->isType(DrawMessage::Type::SUSPEND)) {
                 setState(State::Suspended);
             }
@@ -143,11 +149,37 @@ namespace service::gui
             if (!isAnyFrameBeingRenderedOrDisplayed()) {
                 prepareDisplayEarly(drawMsg->mode);
             }
-            notifyRenderer(std::move(drawMsg->commands), drawMsg->mode);
+            // Dirty area is relative to the previous frame of the same sender only.
+            if (drawMsg->sender != lastDrawSender) {
+                drawMsg->dirtyArea = std::nullopt;
+                lastDrawSender     = drawMsg->sender;
+            }
+            else if (drawMsg->dirtyArea.has_value() && droppedDirtyArea.has_value()) {
+                drawMsg->dirtyArea = ::gui::BoundingBox::unite(*drawMsg->dirtyArea, *droppedDirtyArea);
+            }
+            droppedDirtyArea = std::nullopt;
+            notifyRenderer(std::move(drawMsg->commands), drawMsg->mode, drawMsg->dirtyArea);
         }
         return std::make_shared<sys::ResponseMessage>();
     }
 
+    void ServiceGUI::keepDroppedDirtyArea(const DrawMessage &drawMsg)
+    {
+        // Next frame of any other sender is rendered as a whole anyway.
+        if (drawMsg.sender != lastDrawSender) {
+            return;
+        }
+        // The sender has already forgotten the changes of the dropped frame, so they go with its next frame.
+        if (!drawMsg.dirtyArea.has_value()) {
+            lastDrawSender.clear();
+            droppedDirtyArea = std::nullopt;
+            return;
+        }
+        droppedDirtyArea = droppedDirtyArea.has_value()
+                               ? ::gui::BoundingBox::unite(*droppedDirtyArea, *drawMsg.dirtyArea)
+                               : *drawMsg.dirtyArea;
+    }
+
     sys::MessagePointer ServiceGUI::handleChangeColorScheme(sys::Message *message)
     {
         const auto msg = static_cast<ChangeColorScheme *>(message);
@@ -161,10 +193,11 @@ namespace service::gui
         bus.sendUnicast(msg, service::name::eink);
     }
 
-    void ServiceGUI::notifyRenderer(std::list<std::unique_ptr<::gui::DrawCommand>> &&commands,
-                                    ::gui::RefreshModes refreshMode)
+    void ServiceGUI::notifyRenderer(::gui::DrawCommandList &&commands,
+                                    ::gui::RefreshModes refreshMode,
+                                    std::optional<::gui::BoundingBox> dirtyArea)
     {
-        enqueueDrawCommands(DrawCommandsQueue::QueueItem{std::move(commands), refreshMode});
+        enqueueDrawCommands(DrawCommandsQueue::QueueItem{std::move(commands), refreshMode, dirtyArea});
         worker->notify(WorkerGUI::Signal::Render);
     }
 
@@ -176,6 +209,12 @@ namespace service::gui
 
     void ServiceGUI::enqueueDrawCommands(DrawCommandsQueue::QueueItem &&item)
     {
+        // Areas of the dropped frames have to be redrawn as well.
+        if (const auto queuedArea = commandsQueue->getDirtyArea(); item.dirtyArea.has_value()) {
+            item.dirtyArea = queuedArea.has_value()
+                                 ? std::optional{::gui::BoundingBox::unite(*item.dirtyArea, *queuedArea)}
+                                 : std::nullopt;
+        }
         // Clear all queue elements for now to keep only the latest command in the queue.
         // In the future, we'll need to implement more sophisticated algorithm for partially refresh the display.
         if (item.refreshMode == ::gui::RefreshModes::GUI_REFRESH_DEEP) {
@@ -211,7 +250,7 @@ namespace service::gui
     void ServiceGUI::sendOnDisplay(::gui::Context *context, int contextId, ::gui::RefreshModes refreshMode)
     {
         setState(State::Busy);
-        auto imageMsg = std::make_shared<service::eink::ImageMessage>(contextId, context, refreshMode);
+        auto imageMsg = sys::makePooledMessage<service::eink::ImageMessage>(contextId, context, refreshMode);
         bus.sendUnicast(imageMsg, service::name::eink);
         scheduleContextRelease(contextId);
     }
@@ -6,6 +6,7 @@
 #include <DrawCommand.hpp>
 #include <log/log.hpp>
 #include <Renderer.hpp>
+#include <Service/MessagePool.hpp>
 #include <Service/Worker.hpp>
 #include <service-gui/ServiceGUI.hpp>
 
@@ -39,7 +40,7 @@ namespace service::gui
         switch (command) {
         case Signal::Render: {
             auto item = guiService->commandsQueue->dequeue();
-            render(item.commands, item.refreshMode);
+            render(item.commands, item.refreshMode, item.dirtyArea);
             break;
         }
         case Signal::ChangeColorScheme: {
@@ -51,21 +52,63 @@ namespace service::gui
         }
     }
 
-    void WorkerGUI::render(DrawCommandsQueue::CommandList &commands, ::gui::RefreshModes refreshMode)
+    void WorkerGUI::render(DrawCommandsQueue::CommandList &commands,
+                           ::gui::RefreshModes refreshMode,
+                           const std::optional<::gui::BoundingBox> &dirtyArea)
     {
         const auto [contextId, context] = guiService->contextPool->borrowContext(); // Waits for the context.
-        renderer.render(context, commands);
+
+        std::optional<::gui::BoundingBox> renderedArea;
+        if (dirtyArea.has_value()) {
+            renderedArea = renderDirtyArea(contextId, context, commands, *dirtyArea);
+        }
+        if (!renderedArea.has_value()) {
+            renderer.render(context, commands);
+            renderedArea = ::gui::BoundingBox{0, 0, context->getW(), context->getH()};
+            invalidateRenderedFrames();
+        }
+
+        for (auto &[id, area] : outdatedAreas) {
+            area = ::gui::BoundingBox::unite(area, *renderedArea);
+        }
+        outdatedAreas[contextId] = ::gui::BoundingBox{};
+        lastContextId            = contextId;
+
         onRenderingFinished(contextId, refreshMode);
     }
 
+    auto WorkerGUI::renderDirtyArea(int contextId,
+                                    ::gui::Context *context,
+                                    DrawCommandsQueue::CommandList &commands,
+                                    const ::gui::BoundingBox &dirtyArea) -> std::optional<::gui::BoundingBox>
+    {
+        const auto outdatedArea = outdatedAreas.find(contextId);
+        if (!lastContextId.has_value() || outdatedArea == outdatedAreas.end()) {
+            return std::nullopt;
+        }
+
+        // Bring the context up to date with the most recent frame before drawing the changes on top of it.
+        if (*lastContextId != contextId) {
+            context->copyArea(*guiService->contextPool->peekContext(*lastContextId), outdatedArea->second);
+        }
+        return renderer.render(context, commands, dirtyArea);
+    }
+
+    void WorkerGUI::invalidateRenderedFrames()
+    {
+        lastContextId = std::nullopt;
+        outdatedAreas.clear();
+    }
+
     void WorkerGUI::changeColorScheme(const std::unique_ptr<::gui::ColorScheme> &scheme)
     {
         renderer.changeColorScheme(scheme);
+        invalidateRenderedFrames();
     }
 
     void WorkerGUI::onRenderingFinished(int contextId, ::gui::RefreshModes refreshMode)
     {
-        auto msg = std::make_shared<service::gui::RenderingFinished>(contextId, refreshMode);
+        auto msg = sys::makePooledMessage<service::gui::RenderingFinished>(contextId, refreshMode);
         guiService->bus.sendUnicast(std::move(msg), guiService->GetName());
     }
 } // namespace service::gui
@@ -11,6 +11,8 @@
 #include <Service/Worker.hpp>
 
 #include <cstdint>
+#include <map>
+#include <optional>
 
 namespace service::gui
 {
@@ -35,11 +37,22 @@ namespace service::gui
 
       private:
         void handleCommand(Signal command);
-        void render(DrawCommandsQueue::CommandList &commands, ::gui::RefreshModes refreshMode);
+        void render(DrawCommandsQueue::CommandList &commands,
+                    ::gui::RefreshModes refreshMode,
+                    const std::optional<::gui::BoundingBox> &dirtyArea);
+        auto renderDirtyArea(int contextId,
+                             ::gui::Context *context,
+                             DrawCommandsQueue::CommandList &commands,
+                             const ::gui::BoundingBox &dirtyArea) -> std::optional<::gui::BoundingBox>;
+        void invalidateRenderedFrames();
         void changeColorScheme(const std::unique_ptr<::gui::ColorScheme> &scheme);
         void onRenderingFinished(int contextId, ::gui::RefreshModes refreshMode);
 
         ServiceGUI *guiService;
         ::gui::Renderer renderer;
+        /// Id of the context holding the most recent frame
+        std::optional<int> lastContextId;
+        /// Areas in which contexts differ from the most recent frame, contexts missing here have unknown content
+        std::map<int, ::gui::BoundingBox> outdatedAreas;
     };
 } // namespace service::gui
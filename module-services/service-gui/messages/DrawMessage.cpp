@@ -4,11 +4,11 @@
 #include <messages/DrawMessage.hpp>
 #include <messages/GUIMessage.hpp>
 #include <Common.hpp>
-#include <DrawCommand.hpp>
+#include <DrawCommandList.hpp>
 
 namespace service::gui
 {
-    DrawMessage::DrawMessage(std::list<::gui::Command> commands, ::gui::RefreshModes mode)
+    DrawMessage::DrawMessage(::gui::DrawCommandList commands, ::gui::RefreshModes mode)
         : GUIMessage(), mode(mode), commands(std::move(commands))
     {}
 } // namespace service::gui
@@ -18,6 +18,7 @@
 
 #include <cstdint>
 #include <memory>
+#include <optional>
 #include <string>
 
 namespace gui
@@ -28,6 +29,7 @@ namespace gui
 
 namespace service::gui
 {
+    class DrawMessage;
     class WorkerGUI;
 
     class ServiceGUI : public sys::Service
@@ -57,9 +59,12 @@ namespace service::gui
         void registerMessageHandlers();
 
         void prepareDisplayEarly(::gui::RefreshModes refreshMode);
-        void notifyRenderer(std::list<std::unique_ptr<::gui::DrawCommand>> &&commands, ::gui::RefreshModes refreshMode);
+        void notifyRenderer(::gui::DrawCommandList &&commands,
+                            ::gui::RefreshModes refreshMode,
+                            std::optional<::gui::BoundingBox> dirtyArea);
         void notifyRenderColorSchemeChange(::gui::ColorScheme &&scheme);
         void enqueueDrawCommands(DrawCommandsQueue::QueueItem &&item);
+        void keepDroppedDirtyArea(const DrawMessage &drawMsg);
         void sendOnDisplay(::gui::Context *context, int contextId, ::gui::RefreshModes refreshMode);
         void scheduleContextRelease(int contextId);
         bool isNextFrameReady() const noexcept;
@@ -82,6 +87,9 @@ namespace service::gui
         RenderCache cache;
         sys::TimerHandle contextReleaseTimer;
         State currentState;
+        std::string lastDrawSender;
+        /// Dirty area of the last sender's frames that were not rendered
+        std::optional<::gui::BoundingBox> droppedDirtyArea;
         bool lastRenderScheduled;
         bool waitingForLastRender;
     };
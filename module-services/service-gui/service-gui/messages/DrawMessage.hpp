@@ -4,12 +4,12 @@
 #pragma once
 
 #include "GUIMessage.hpp"
-#include <core/DrawCommand.hpp>
+#include <core/DrawCommandList.hpp>
 #include <gui/Common.hpp>
 #include <Service/Message.hpp>
 
-#include <list>
 #include <memory>
+#include <optional>
 
 #include "Service/Message.hpp"
 #include "core/DrawCommandForward.hpp"
@@ -30,9 +30,11 @@ namespace service::gui
 
       public:
         ::gui::RefreshModes mode;
-        std::list<::gui::Command> commands;
+        ::gui::DrawCommandList commands;
+        /// area (in window coordinates) changed since previous frame, whole frame is redrawn if not set
+        std::optional<::gui::BoundingBox> dirtyArea;
 
-        DrawMessage(std::list<::gui::Command> commandsList, ::gui::RefreshModes mode);
+        DrawMessage(::gui::DrawCommandList commandsList, ::gui::RefreshModes mode);
 
         void setCommandType(Type value) noexcept
         {
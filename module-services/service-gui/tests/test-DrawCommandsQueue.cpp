@@ -70,4 +70,14 @@ TEST_CASE("DrawCommandsQueueTests")
         REQUIRE(queue.size() == 0);
         REQUIRE(maxRefreshMode == ::gui::RefreshModes::GUI_REFRESH_DEEP);
     }
+
+    SECTION("Get dirty area of queued items")
+    {
+        queue.enqueue(DrawCommandsQueue::QueueItem{{}, ::gui::RefreshModes::GUI_REFRESH_FAST, {{0, 0, 10, 10}}});
+        queue.enqueue(DrawCommandsQueue::QueueItem{{}, ::gui::RefreshModes::GUI_REFRESH_FAST, {{20, 20, 10, 10}}});
+        REQUIRE(queue.getDirtyArea() == ::gui::BoundingBox{0, 0, 30, 30});
+
+        queue.enqueue(DrawCommandsQueue::QueueItem{});
+        REQUIRE_FALSE(queue.getDirtyArea().has_value());
+    }
 }
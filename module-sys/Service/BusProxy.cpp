@@ -3,12 +3,18 @@
 
 #include <Service/BusProxy.hpp>
 
+#include <Service/Service.hpp>
+
 #include "details/bus/Bus.hpp"
+#include "details/bus/PendingRequests.hpp"
+
+#include "ticks.hpp"
 
 namespace sys
 {
     BusProxy::BusProxy(Service *owner, Watchdog &watchdog)
-        : owner{owner}, watchdog{watchdog}, busImpl{std::make_unique<Bus>()}
+        : owner{owner}, ownerName{owner->GetName()}, watchdog{watchdog}, busImpl{std::make_unique<Bus>()},
+          pendingRequests{std::make_unique<PendingRequests>()}
     {
         channels.push_back(BusChannel::System); // Mandatory for each service.
     }
@@ -35,6 +41,42 @@ namespace sys
         return ret;
     }
 
+    std::optional<MessageUIDType> BusProxy::sendUnicastAsync(std::shared_ptr<Message> message,
+                                                             const std::string &targetName,
+                                                             ResponseHandler handler,
+                                                             std::uint32_t timeout)
+    {
+        auto request = message;
+        if (!sendUnicast(std::move(message), targetName)) {
+            return std::nullopt;
+        }
+        // The response is handled in this thread, so it can't be received before the request is added
+        pendingRequests->add(request->uniID, cpp_freertos::Ticks::GetTicks() + timeout, std::move(handler));
+        return request->uniID;
+    }
+
+    void BusProxy::cancelRequest(MessageUIDType requestId)
+    {
+        pendingRequests->cancel(requestId);
+    }
+
+    bool BusProxy::handleResponse(const std::shared_ptr<Message> &message)
+    {
+        return !pendingRequests->empty() && pendingRequests->respond(message);
+    }
+
+    void BusProxy::handleTimeouts()
+    {
+        if (!pendingRequests->empty()) {
+            pendingRequests->expire(cpp_freertos::Ticks::GetTicks());
+        }
+    }
+
+    std::uint32_t BusProxy::timeToNextTimeout() const
+    {
+        return pendingRequests->timeToDeadline(cpp_freertos::Ticks::GetTicks()).value_or(portMAX_DELAY);
+    }
+
     void BusProxy::sendMulticast(std::shared_ptr<Message> message, BusChannel channel)
     {
         busImpl->SendMulticast(std::move(message), channel, owner);
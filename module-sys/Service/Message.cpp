@@ -4,8 +4,64 @@
 #include <Service/Message.hpp>
 #include <Service/Service.hpp>
 
+#include <atomic>
+
 namespace sys
 {
+    namespace
+    {
+        struct InternedName
+        {
+            std::string name;
+            InternedName *next;
+        };
+
+        InternedName unknownName{"Unknown", nullptr};
+        /// Names are only added, at the head of the list, and never removed
+        std::atomic<InternedName *> internedNames{&unknownName};
+
+        const InternedName *findInterned(const InternedName *head, std::string_view name)
+        {
+            for (auto node = head; node != nullptr; node = node->next) {
+                if (node->name == name) {
+                    return node;
+                }
+            }
+            return nullptr;
+        }
+
+        const std::string *intern(std::string_view name)
+        {
+            auto head = internedNames.load(std::memory_order_acquire);
+            if (const auto found = findInterned(head, name); found != nullptr) {
+                return &found->name;
+            }
+
+            auto node = new InternedName{std::string(name), head};
+            while (!internedNames.compare_exchange_weak(
+                node->next, node, std::memory_order_acq_rel, std::memory_order_acquire)) {
+                // Another thread added names meanwhile, one of them may be this one
+                if (const auto found = findInterned(node->next, name); found != nullptr) {
+                    delete node;
+                    return &found->name;
+                }
+            }
+            return &node->name;
+        }
+    } // namespace
+
+    ServiceName::ServiceName() noexcept : name{&unknownName.name}
+    {}
+
+    ServiceName::ServiceName(std::string_view name) : name{intern(name)}
+    {}
+
+    ServiceName &ServiceName::operator=(std::string_view name)
+    {
+        this->name = intern(name);
+        return *this;
+    }
+
     SendResult CreateSendResult(ReturnCodes retCode, MessagePointer msg)
     {
         return std::make_pair(retCode, msg);
@@ -37,7 +93,7 @@ namespace sys
 
     bool Message::ValidateMessage() const noexcept
     {
-        return !(id == invalidMessageUid || type == Message::Type::Unspecified || sender == "Unknown");
+        return !(id == invalidMessageUid || type == Message::Type::Unspecified || sender == ServiceName{});
     }
 
     void Message::ValidateUnicastMessage() const
@@ -0,0 +1,123 @@
+// Copyright (c) 2017-2021, Mudita Sp. z.o.o. All rights reserved.
+// For licensing, see https://github.com/mudita/MuditaOS/LICENSE.md
+
+#include <Service/MessageHandlers.hpp>
+#include <Service/Message.hpp>
+
+#include <cstdint>
+
+namespace sys
+{
+    bool MessageHandlers::connect(const std::type_info &type, MessageHandler handler)
+    {
+        if (auto entry = lookup(&type); entry != nullptr && entry->connected) {
+            return false;
+        }
+
+        // A type may have more than one std::type_info object (e.g. when loaded from a shared library),
+        // every entry of the type gets the handler
+        insert(type);
+        for (auto &entry : slots) {
+            if (entry != nullptr && *entry->type == type) {
+                entry->handler   = handler;
+                entry->connected = true;
+            }
+        }
+        return true;
+    }
+
+    bool MessageHandlers::disconnect(const std::type_info &type)
+    {
+        auto disconnected = false;
+        for (auto &entry : slots) {
+            if (entry != nullptr && entry->connected && *entry->type == type) {
+                entry->handler   = nullptr;
+                entry->connected = false;
+                disconnected     = true;
+            }
+        }
+        return disconnected;
+    }
+
+    auto MessageHandlers::find(const Message &message) -> const Entry &
+    {
+        const auto &type = typeid(message);
+        auto entry       = lookup(&type);
+        if (entry == nullptr) {
+            entry = &insert(type);
+        }
+        if (!entry->checked) {
+            entry->dataMessage = dynamic_cast<const DataMessage *>(&message) != nullptr;
+            entry->checked     = true;
+        }
+        return *entry;
+    }
+
+    std::size_t MessageHandlers::slotOf(const std::type_info *type) const noexcept
+    {
+        // type_info objects are aligned, the lowest bits carry no information
+        const auto address = reinterpret_cast<std::uintptr_t>(type);
+        return ((address >> 3) ^ (address >> 11)) & (slots.size() - 1);
+    }
+
+    auto MessageHandlers::lookup(const std::type_info *type) const noexcept -> Entry *
+    {
+        if (slots.empty()) {
+            return nullptr;
+        }
+        for (auto slot = slotOf(type);; slot = (slot + 1) & (slots.size() - 1)) {
+            const auto &entry = slots[slot];
+            if (entry == nullptr) {
+                return nullptr;
+            }
+            if (entry->type == type) {
+                return entry.get();
+            }
+        }
+    }
+
+    auto MessageHandlers::insert(const std::type_info &type) -> Entry &
+    {
+        if (auto entry = lookup(&type); entry != nullptr) {
+            return *entry;
+        }
+        // Keep at most half of the slots used so probing stays short
+        if ((used + 1) * 2 > slots.size()) {
+            grow();
+        }
+
+        auto entry  = std::make_unique<Entry>();
+        entry->type = &type;
+        for (const auto &other : slots) {
+            if (other != nullptr && *other->type == type) {
+                *entry      = *other;
+                entry->type = &type;
+                break;
+            }
+        }
+
+        auto slot = slotOf(&type);
+        while (slots[slot] != nullptr) {
+            slot = (slot + 1) & (slots.size() - 1);
+        }
+        slots[slot] = std::move(entry);
+        ++used;
+        return *slots[slot];
+    }
+
+    void MessageHandlers::grow()
+    {
+        auto old = std::move(slots);
+        slots    = std::vector<std::unique_ptr<Entry>>(old.empty() ? initialCapacity : old.size() * 2);
+        for (auto &entry : old) {
+            if (entry == nullptr) {
+                continue;
+            }
+            auto slot = slotOf(entry->type);
+            while (slots[slot] != nullptr) {
+                slot = (slot + 1) & (slots.size() - 1);
+            }
+            slots[slot] = std::move(entry);
+        }
+    }
+} // namespace sys
@@ -0,0 +1,39 @@
+// Copyright (c) 2017-2021, Mudita Sp. z.o.o. All rights reserved.
+// For licensing, see https://github.com/mudita/MuditaOS/LICENSE.md
+
+#include <Service/MessagePool.hpp>
+#include "module-os/CriticalSectionGuard.hpp"
+
+namespace sys::pool
+{
+    Blocks::Blocks(void *storage, std::size_t blockSize, std::size_t count) noexcept
+        : begin{static_cast<std::byte *>(storage)}, end{begin + blockSize * count}
+    {
+        for (auto block = end; block != begin;) {
+            block -= blockSize;
+            freeBlocks = new (block) FreeBlock{freeBlocks};
+        }
+    }
+
+    void *Blocks::take() noexcept
+    {
+        cpp_freertos::CriticalSectionGuard guard;
+        if (freeBlocks == nullptr) {
+            return nullptr;
+        }
+        auto block = freeBlocks;
+        freeBlocks = block->next;
+        return block;
+    }
+
+    bool Blocks::give(void *block) noexcept
+    {
+        const auto address = static_cast<std::byte *>(block);
+        if (address < begin || address >= end) {
+            return false;
+        }
+        cpp_freertos::CriticalSectionGuard guard;
+        freeBlocks = new (block) FreeBlock{freeBlocks};
+        return true;
+    }
+} // namespace sys::pool
@@ -19,6 +19,7 @@
 #include <cstdint>                 // for uint32_t, uint64_t, UINT32_MAX
 #include <iosfwd>                  // for std
 #include <typeinfo>                // for type_info
+#include <vector>                  // for vector
 #include <system/Constants.hpp>
 
 #if (DEBUG_SERVICE_MESSAGES > 0)
@@ -95,29 +96,42 @@ namespace sys
 
     void Service::Run()
     {
+        // Messages are taken in batches, so the mailbox is synchronized with senders once per batch
+        std::vector<std::shared_ptr<Message>> messages;
         while (enableRunLoop) {
-            auto msg = mailbox.pop();
-            if (!msg) {
-                continue;
+            messages.clear();
+            mailbox.pop_all(messages, bus.timeToNextTimeout());
+
+            for (const auto &msg : messages) {
+                if (!enableRunLoop) {
+                    break;
+                }
+                if (!msg) {
+                    continue;
+                }
+                if (bus.handleResponse(msg)) {
+                    continue;
+                }
+
+                // Remove all staled messages
+                uint32_t timestamp = cpp_freertos::Ticks::GetTicks();
+                staleUniqueMsg.erase(std::remove_if(staleUniqueMsg.begin(),
+                                                    staleUniqueMsg.end(),
+                                                    [&](const auto &id) {
+                                                        return ((id.first == msg->uniID) ||
+                                                                ((timestamp - id.second) >= 15000));
+                                                    }),
+                                     staleUniqueMsg.end());
+
+                const bool respond = msg->type != Message::Type::Response && GetName() != msg->sender;
+                auto response      = msg->Execute(this);
+                if (response == nullptr || !respond) {
+                    continue;
+                }
+
+                bus.sendResponse(response, msg);
             }
-
-            // Remove all staled messages
-            uint32_t timestamp = cpp_freertos::Ticks::GetTicks();
-            staleUniqueMsg.erase(std::remove_if(staleUniqueMsg.begin(),
-                                                staleUniqueMsg.end(),
-                                                [&](const auto &id) {
-                                                    return ((id.first == msg->uniID) ||
-                                                            ((timestamp - id.second) >= 15000));
-                                                }),
-                                 staleUniqueMsg.end());
-
-            const bool respond = msg->type != Message::Type::Response && GetName() != msg->sender;
-            auto response      = msg->Execute(this);
-            if (response == nullptr || !respond) {
-                continue;
-            }
-
-            bus.sendResponse(response, msg);
+            bus.handleTimeouts();
         }
         CloseService();
     };
@@ -131,11 +145,12 @@ namespace sys
     {
         debug_msg(this, message);
 
-        if (const auto &[handled, ret] = ExecuteMessageHandler(message); handled) {
+        const auto &handlers = message_handlers.find(*message);
+        if (const auto &[handled, ret] = ExecuteMessageHandler(handlers, message); handled) {
             return ret;
         }
-        if (auto dataMsg = dynamic_cast<DataMessage *>(message); dataMsg != nullptr) {
-            return DataReceivedHandler(dataMsg, nullptr);
+        if (handlers.dataMessage) {
+            return DataReceivedHandler(static_cast<DataMessage *>(message), nullptr);
         }
 
         LOG_ERROR("Failed to handle message of type [%s]", typeid(*message).name());
@@ -146,32 +161,29 @@ namespace sys
     {
         debug_msg(this, message);
 
-        if (const auto &[handled, ret] = ExecuteMessageHandler(message); handled) {
+        if (const auto &[handled, ret] = ExecuteMessageHandler(message_handlers.find(*message), message); handled) {
             return ret;
         }
         DataMessage dummy(MessageType::MessageTypeUninitialized);
         return DataReceivedHandler(&dummy, message);
     }
 
-    auto Service::ExecuteMessageHandler(Message *message) -> std::pair<bool, MessagePointer>
+    auto Service::ExecuteMessageHandler(const MessageHandlers::Entry &handlers, Message *message)
+        -> std::pair<bool, MessagePointer>
     {
-        const auto idx = type_index(typeid(*message));
-        if (const auto handler = message_handlers.find(idx); handler != message_handlers.end()) {
-            const auto &handlerFunction = handler->second;
-            if (handlerFunction == nullptr) {
-                return {true, nullptr};
-            }
-            return {true, handlerFunction(message)};
+        if (!handlers.connected) {
+            return {false, nullptr};
+        }
+        if (handlers.handler == nullptr) {
+            return {true, nullptr};
         }
-        return {false, nullptr};
+        return {true, handlers.handler(message)};
     }
 
     bool Service::connect(const type_info &type, MessageHandler handler)
     {
-        auto idx = type_index(type);
-        if (message_handlers.find(idx) == message_handlers.end()) {
+        if (message_handlers.connect(type, std::move(handler))) {
             log_debug("Registering new message handler on %s", type.name());
-            message_handlers[idx] = std::move(handler);
             return true;
         }
         LOG_ERROR("Handler for: %s already registered!", type.name());
@@ -191,12 +203,7 @@ namespace sys
 
     bool Service::disconnect(const std::type_info &type)
     {
-        auto iter = message_handlers.find(type);
-        if (iter == std::end(message_handlers)) {
-            return false;
-        }
-        message_handlers.erase(iter);
-        return true;
+        return message_handlers.disconnect(type);
     }
 
     void Service::CloseHandler()
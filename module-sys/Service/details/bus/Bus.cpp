@@ -2,6 +2,7 @@
 // For licensing, see https://github.com/mudita/MuditaOS/LICENSE.md
 
 #include "Bus.hpp"
+#include "ServiceRegistry.hpp"
 
 #include <Service/Service.hpp>
 #include "SystemWatchdog/SystemWatchdog.hpp"
@@ -11,7 +12,6 @@
 
 #include <algorithm>
 #include <cassert>
-#include <set>
 
 namespace sys
 {
@@ -20,29 +20,23 @@ namespace sys
         MessageUID uniqueMsgId;
         MessageUID unicastMsgId;
 
-        std::map<BusChannel, std::set<Service *>> channels;
-        std::map<std::string, Service *> servicesRegistered;
+        ServiceRegistry services;
     } // namespace
 
     void Bus::Add(Service *service)
     {
         cpp_freertos::CriticalSectionGuard guard;
 
-        for (auto channel : service->bus.channels) {
-            channels[channel].insert(service);
+        if (!services.add(service->GetName(), service, service->bus.channels)) {
+            LOG_ERROR("Service %s can't be registered, too many services", service->GetName().c_str());
         }
-        servicesRegistered[service->GetName()] = service;
     }
 
     void Bus::Remove(Service *service)
     {
         cpp_freertos::CriticalSectionGuard guard;
 
-        for (auto channel : service->bus.channels) {
-            auto &services = channels[channel];
-            services.erase(service);
-        }
-        servicesRegistered.erase(service->GetName());
+        services.remove(service->GetName(), service, service->bus.channels);
     }
 
     void Bus::SendResponse(std::shared_ptr<Message> response, std::shared_ptr<Message> request, Service *sender)
@@ -51,7 +45,7 @@ namespace sys
         assert(request != nullptr);
         assert(sender != nullptr);
 
-        response->sender    = sender->GetName();
+        response->sender    = sender->bus.ownerName;
         response->transType = Message::TransmissionType::Unicast;
 
         if (request->transType == Message::TransmissionType::Unicast) {
@@ -72,8 +66,7 @@ namespace sys
             response->ValidateResponseMessage();
         }
 
-        if (auto it = servicesRegistered.find(request->sender); it != servicesRegistered.end()) {
-            const auto targetService = it->second;
+        if (const auto targetService = services.get(request->sender); targetService != nullptr) {
             targetService->mailbox.push(response);
         }
     }
@@ -86,13 +79,12 @@ namespace sys
             message->uniID = unicastMsgId.getNext();
         }
 
-        message->sender    = sender->GetName();
+        message->sender    = sender->bus.ownerName;
         message->transType = Message::TransmissionType::Unicast;
 
         message->ValidateUnicastMessage();
 
-        if (auto it = servicesRegistered.find(targetName); it != servicesRegistered.end()) {
-            const auto targetService = it->second;
+        if (const auto targetService = services.get(targetName); targetService != nullptr) {
             targetService->mailbox.push(message);
             return true;
         }
@@ -117,14 +109,12 @@ namespace sys
             message->uniID = unicastMsgId.getNext();
         }
 
-        message->sender    = sender->GetName();
+        message->sender    = sender->bus.ownerName;
         message->transType = Message::TransmissionType ::Unicast;
 
         message->ValidateUnicastMessage();
 
-        auto ele = servicesRegistered.find(targetName);
-        if (ele != servicesRegistered.end()) {
-            const auto targetService = servicesRegistered[targetName];
+        if (const auto targetService = services.get(targetName); targetService != nullptr) {
             targetService->mailbox.push(message);
         }
         else {
@@ -169,7 +159,7 @@ namespace sys
             }
 
             // Received response
-            if ((rxmsg->uniID == unicastID) && (message->sender == sender->GetName())) {
+            if ((rxmsg->uniID == unicastID) && (message->sender == sender->bus.ownerName)) {
 
                 // Push messages collected during waiting for response to processing queue
                 for (const auto &w : tempMsg) {
@@ -206,13 +196,11 @@ namespace sys
 
         message->channel   = channel;
         message->transType = Message::TransmissionType::Multicast;
-        message->sender    = sender->GetName();
+        message->sender    = sender->bus.ownerName;
 
         message->ValidateMulticastMessage();
 
-        for (const auto &target : channels[channel]) {
-            target->mailbox.push(message);
-        }
+        services.forEach(channel, [&message](Service *target) { target->mailbox.push(message); });
     }
 
     void Bus::SendBroadcast(std::shared_ptr<Message> message, Service *sender)
@@ -223,13 +211,10 @@ namespace sys
         }
 
         message->transType = Message::TransmissionType ::Broadcast;
-        message->sender    = sender->GetName();
+        message->sender    = sender->bus.ownerName;
 
         message->ValidateBroadcastMessage();
 
-        for (const auto &target : servicesRegistered) {
-            const auto targetService = target.second;
-            targetService->mailbox.push(message);
-        }
+        services.forEach([&message](Service *target) { target->mailbox.push(message); });
     }
 } // namespace sys
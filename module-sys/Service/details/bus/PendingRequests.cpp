@@ -0,0 +1,79 @@
+// Copyright (c) 2017-2021, Mudita Sp. z.o.o. All rights reserved.
+// For licensing, see https://github.com/mudita/MuditaOS/LICENSE.md
+
+#include "PendingRequests.hpp"
+
+#include <vector>
+
+namespace sys
+{
+    void PendingRequests::add(MessageUIDType id, std::uint32_t deadline, ResponseHandler handler)
+    {
+        requests[id] = Request{deadline, std::move(handler)};
+    }
+
+    bool PendingRequests::cancel(MessageUIDType id)
+    {
+        return requests.erase(id) != 0;
+    }
+
+    bool PendingRequests::respond(const MessagePointer &message)
+    {
+        // Only responses carry the unique ID of the request they answer, other messages may reuse a stale one
+        if (message->type != Message::Type::Response) {
+            return false;
+        }
+        const auto request = requests.find(message->uniID);
+        if (request == requests.end()) {
+            return false;
+        }
+        // The handler may send another request, so it's called once the request is removed
+        auto handler = std::move(request->second.handler);
+        requests.erase(request);
+        if (handler) {
+            handler(CreateSendResult(ReturnCodes::Success, message));
+        }
+        return true;
+    }
+
+    void PendingRequests::expire(std::uint32_t now)
+    {
+        std::vector<ResponseHandler> expired;
+        for (auto request = requests.begin(); request != requests.end();) {
+            if (passed(request->second.deadline, now)) {
+                expired.push_back(std::move(request->second.handler));
+                request = requests.erase(request);
+            }
+            else {
+                ++request;
+            }
+        }
+        for (const auto &handler : expired) {
+            if (handler) {
+                handler(CreateSendResult(ReturnCodes::Timeout, nullptr));
+            }
+        }
+    }
+
+    std::optional<std::uint32_t> PendingRequests::timeToDeadline(std::uint32_t now) const
+    {
+        std::optional<std::uint32_t> nearest;
+        for (const auto &[id, request] : requests) {
+            const auto left = passed(request.deadline, now) ? 0U : request.deadline - now;
+            if (!nearest.has_value() || left < *nearest) {
+                nearest = left;
+            }
+        }
+        return nearest;
+    }
+
+    bool PendingRequests::empty() const noexcept
+    {
+        return requests.empty();
+    }
+
+    bool PendingRequests::passed(std::uint32_t deadline, std::uint32_t now) noexcept
+    {
+        return static_cast<std::int32_t>(deadline - now) <= 0;
+    }
+} // namespace sys
@@ -0,0 +1,47 @@
+// Copyright (c) 2017-2021, Mudita Sp. z.o.o. All rights reserved.
+// For licensing, see https://github.com/mudita/MuditaOS/LICENSE.md
+
+#pragma once
+
+#include "Service/Message.hpp"
+
+#include <cstdint>
+#include <functional>
+#include <map>
+#include <optional>
+
+namespace sys
+{
+    /// Requests sent by a service without waiting for their responses, by the unique IDs of the requests.
+    /// Used only in the thread of the service, so handlers are called there as well.
+    class PendingRequests
+    {
+      public:
+        using ResponseHandler = std::function<void(SendResult result)>;
+
+        void add(MessageUIDType id, std::uint32_t deadline, ResponseHandler handler);
+        bool cancel(MessageUIDType id);
+
+        /// Passes the response message to the handler of the request it responds to
+        /// \return false if the message is not a response to a pending request
+        bool respond(const MessagePointer &message);
+        /// Passes ReturnCodes::Timeout to the handlers of requests with the deadline passed
+        void expire(std::uint32_t now);
+
+        /// Ticks left to the nearest deadline, std::nullopt if there is no request pending
+        [[nodiscard]] std::optional<std::uint32_t> timeToDeadline(std::uint32_t now) const;
+        [[nodiscard]] bool empty() const noexcept;
+
+      private:
+        struct Request
+        {
+            std::uint32_t deadline;
+            ResponseHandler handler;
+        };
+
+        /// Ticks wrap around, a deadline is passed if it's not ahead of now by less than half of the ticks range
+        [[nodiscard]] static bool passed(std::uint32_t deadline, std::uint32_t now) noexcept;
+
+        std::map<MessageUIDType, Request> requests;
+    };
+} // namespace sys
@@ -0,0 +1,100 @@
+// Copyright (c) 2017-2021, Mudita Sp. z.o.o. All rights reserved.
+// For licensing, see https://github.com/mudita/MuditaOS/LICENSE.md
+
+#include "ServiceRegistry.hpp"
+
+#include <functional>
+
+namespace sys
+{
+    void ServiceRegistry::HandleSet::insert(Handle handle) noexcept
+    {
+        words[handle / bitsPerWord].fetch_or(1U << (handle % bitsPerWord), std::memory_order_release);
+    }
+
+    void ServiceRegistry::HandleSet::erase(Handle handle) noexcept
+    {
+        words[handle / bitsPerWord].fetch_and(~(1U << (handle % bitsPerWord)), std::memory_order_release);
+    }
+
+    bool ServiceRegistry::add(const std::string &name, Service *service, const std::vector<BusChannel> &channels)
+    {
+        const auto handle = handleOf(name);
+        if (handle == invalidHandle) {
+            return false;
+        }
+
+        services[handle].store(service, std::memory_order_release);
+        registered.insert(handle);
+        // The handle may still be on the channels of a service replaced under the same name
+        for (auto &set : this->channels) {
+            set.erase(handle);
+        }
+        for (auto channel : channels) {
+            this->channels[magic_enum::enum_integer(channel)].insert(handle);
+        }
+        return true;
+    }
+
+    void ServiceRegistry::remove(const std::string &name, Service *service, const std::vector<BusChannel> &channels)
+    {
+        const auto handle = find(name);
+        if (handle == invalidHandle || get(handle) != service) {
+            return;
+        }
+
+        for (auto channel : channels) {
+            this->channels[magic_enum::enum_integer(channel)].erase(handle);
+        }
+        registered.erase(handle);
+        services[handle].store(nullptr, std::memory_order_release);
+    }
+
+    auto ServiceRegistry::find(const std::string &name) const noexcept -> Handle
+    {
+        for (auto slot = slotOf(name);; slot = (slot + 1) % index.size()) {
+            const auto value = index[slot].load(std::memory_order_acquire);
+            if (value == 0) {
+                return invalidHandle;
+            }
+            if (const auto handle = static_cast<Handle>(value - 1); names[handle] == name) {
+                return handle;
+            }
+        }
+    }
+
+    Service *ServiceRegistry::get(Handle handle) const noexcept
+    {
+        return handle < services.size() ? services[handle].load(std::memory_order_acquire) : nullptr;
+    }
+
+    Service *ServiceRegistry::get(const std::string &name) const noexcept
+    {
+        return get(find(name));
+    }
+
+    auto ServiceRegistry::handleOf(const std::string &name) -> Handle
+    {
+        if (const auto handle = find(name); handle != invalidHandle) {
+            return handle;
+        }
+        if (namesCount == maxNames) {
+            return invalidHandle;
+        }
+
+        const auto handle = namesCount++;
+        names[handle]     = name;
+        // At most half of the index slots are used, so there is always a free one
+        auto slot = slotOf(name);
+        while (index[slot].load(std::memory_order_relaxed) != 0) {
+            slot = (slot + 1) % index.size();
+        }
+        index[slot].store(static_cast<std::uint16_t>(handle + 1), std::memory_order_release);
+        return handle;
+    }
+
+    std::size_t ServiceRegistry::slotOf(const std::string &name) noexcept
+    {
+        return std::hash<std::string>{}(name) % (2 * maxNames);
+    }
+} // namespace sys
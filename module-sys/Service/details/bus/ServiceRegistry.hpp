@@ -0,0 +1,98 @@
+// Copyright (c) 2017-2021, Mudita Sp. z.o.o. All rights reserved.
+// For licensing, see https://github.com/mudita/MuditaOS/LICENSE.md
+
+#pragma once
+
+#include "system/Common.hpp"
+
+#include <magic_enum.hpp>
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace sys
+{
+    class Service; // forward declaration
+
+    /// Services reachable through the bus, looked up on every message sent.
+    /// Each service name gets a handle when registered for the first time, kept for good, so a service restarted
+    /// under the same name is found under the same handle. Handles index atomic service pointers, and channels are
+    /// atomic bitsets of handles, so sending never takes a lock and finding a service by its name costs a hash and
+    /// a single string comparison. Registering and unregistering must be serialized by the caller.
+    class ServiceRegistry
+    {
+      public:
+        using Handle = std::size_t;
+
+        static constexpr std::size_t maxNames = 128;
+        static constexpr Handle invalidHandle = maxNames;
+
+        /// Registers the service under the name on the channels, replacing the channels registered before
+        /// \return false if there is no handle left for a new name
+        bool add(const std::string &name, Service *service, const std::vector<BusChannel> &channels);
+        /// Unregisters the service, unless another service has been registered under its name in the meantime
+        void remove(const std::string &name, Service *service, const std::vector<BusChannel> &channels);
+
+        [[nodiscard]] Handle find(const std::string &name) const noexcept;
+        [[nodiscard]] Service *get(Handle handle) const noexcept;
+        [[nodiscard]] Service *get(const std::string &name) const noexcept;
+
+        /// Calls the function with each service registered on the channel
+        template <typename Function> void forEach(BusChannel channel, Function function) const
+        {
+            channels[magic_enum::enum_integer(channel)].forEach(
+                [this, &function](Handle handle) { call(handle, function); });
+        }
+
+        /// Calls the function with each service registered
+        template <typename Function> void forEach(Function function) const
+        {
+            registered.forEach([this, &function](Handle handle) { call(handle, function); });
+        }
+
+      private:
+        class HandleSet
+        {
+          public:
+            void insert(Handle handle) noexcept;
+            void erase(Handle handle) noexcept;
+
+            template <typename Function> void forEach(Function function) const
+            {
+                for (std::size_t word = 0; word < words.size(); ++word) {
+                    for (auto bits = words[word].load(std::memory_order_acquire); bits != 0; bits &= bits - 1) {
+                        function(word * bitsPerWord + __builtin_ctz(bits));
+                    }
+                }
+            }
+
+          private:
+            static constexpr std::size_t bitsPerWord = 32;
+            std::array<std::atomic<std::uint32_t>, maxNames / bitsPerWord> words{};
+        };
+
+        template <typename Function> void call(Handle handle, Function &function) const
+        {
+            if (auto service = get(handle); service != nullptr) {
+                function(service);
+            }
+        }
+
+        Handle handleOf(const std::string &name);
+        [[nodiscard]] static std::size_t slotOf(const std::string &name) noexcept;
+
+        /// Names by their handles, a name is set once before its handle is published in the index
+        std::array<std::string, maxNames> names;
+        std::size_t namesCount = 0;
+        /// Open addressing index of names, handle + 1 in each used slot
+        std::array<std::atomic<std::uint16_t>, 2 * maxNames> index{};
+
+        std::array<std::atomic<Service *>, maxNames> services{};
+        HandleSet registered;
+        std::array<HandleSet, magic_enum::enum_count<BusChannel>()> channels;
+    };
+} // namespace sys
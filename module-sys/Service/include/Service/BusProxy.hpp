@@ -7,26 +7,43 @@
 #include <SystemWatchdog/Watchdog.hpp>
 
 #include <cstdint>
+#include <functional>
 #include <memory>
+#include <optional>
 #include <string>
 #include <vector>
 
 namespace sys
 {
-    class Service; // Forward declaration
-    class Bus;     // Forward declaration
+    class Service;         // Forward declaration
+    class Bus;             // Forward declaration
+    class PendingRequests; // Forward declaration
 
     class BusProxy
     {
       public:
         static constexpr auto defaultTimeout = 5000U;
 
+        using ResponseHandler = std::function<void(SendResult result)>;
+
         ~BusProxy() noexcept;
 
         bool sendUnicast(std::shared_ptr<Message> message, const std::string &targetName);
         SendResult sendUnicastSync(std::shared_ptr<Message> message,
                                    const std::string &targetName,
                                    std::uint32_t timeout);
+        /**
+         * Sends a request without waiting for the response. The response is passed to the handler in the thread of
+         * the service once it is received, or ReturnCodes::Timeout if it is not received in time. Other messages are
+         * handled in the meantime and any number of requests may be pending. To be called in the service thread only.
+         * @return Id of the request to cancel it, std::nullopt if the request can't be sent
+         */
+        std::optional<MessageUIDType> sendUnicastAsync(std::shared_ptr<Message> message,
+                                                       const std::string &targetName,
+                                                       ResponseHandler handler,
+                                                       std::uint32_t timeout = defaultTimeout);
+        /// Drops the request, its handler is not called anymore
+        void cancelRequest(MessageUIDType requestId);
         void sendMulticast(std::shared_ptr<Message> message, BusChannel channel);
         void sendBroadcast(std::shared_ptr<Message> message);
 
@@ -51,14 +68,25 @@ namespace sys
         void sendResponse(std::shared_ptr<Message> response, std::shared_ptr<Message> request);
 
       private:
+        friend class Bus;
         friend class Service;
         explicit BusProxy(Service *owner, Watchdog &watchdog);
 
         void connect();
         void disconnect();
 
+        /// Passes the message to the handler of the request it responds to, returns false if it's not a response
+        bool handleResponse(const std::shared_ptr<Message> &message);
+        /// Passes timeouts to the handlers of requests not responded in time
+        void handleTimeouts();
+        /// Ticks until the nearest request timeout, portMAX_DELAY if no request is pending
+        [[nodiscard]] std::uint32_t timeToNextTimeout() const;
+
         Service *owner;
+        /// Interned once to be copied to every message sent
+        ServiceName ownerName;
         Watchdog &watchdog;
         std::unique_ptr<Bus> busImpl;
+        std::unique_ptr<PendingRequests> pendingRequests;
     };
 } // namespace sys
@@ -3,78 +3,208 @@
 
 #pragma once
 
+#include <array>
+#include <atomic>
+#include <cstddef>
 #include <deque>
+#include <vector>
 #include "thread.hpp"
+#include "ticks.hpp"
 #include <mutex.hpp>
-#include <condition_variable.hpp>
+#include <semaphore.hpp>
 
-template <typename T> class Mailbox
+/// Queue of items sent to a thread by any number of other threads.
+/// Items are put into a bounded ring without locking (one compare-and-swap per item), so senders never wait for each
+/// other nor for the receiver. Only if the ring is full items go to an overflow queue guarded by a mutex, and from then
+/// on until the receiver takes them all, so items of each sender keep their order.
+/// The receiver is woken with a semaphore given only if it is actually waiting.
+/// All pop and peek calls and push_front must be made by the thread owning the mailbox.
+template <typename T, std::size_t Capacity = 32> class Mailbox
 {
+    static_assert(Capacity >= 2 && (Capacity & (Capacity - 1)) == 0, "Mailbox capacity must be a power of two");
+
   public:
     Mailbox(cpp_freertos::Thread *thread) : thread_(thread)
-    {}
+    {
+        for (std::size_t i = 0; i < Capacity; ++i) {
+            cells_[i].sequence.store(i, std::memory_order_relaxed);
+        }
+    }
 
     T peek()
     {
-
-        cpp_freertos::LockGuard mlock(mutex_);
-        while (queue_.empty()) {
-            thread_->Wait(cond_, mutex_);
+        while (!collect()) {
+            wait(portMAX_DELAY);
         }
-        auto item = queue_.front();
-        return item;
+        return pending_.front();
     }
 
     T pop(uint32_t timeout = portMAX_DELAY)
     {
-
-        cpp_freertos::LockGuard mlock(mutex_);
-        while (queue_.empty()) {
-            if (thread_->Wait(cond_, mutex_, timeout) == false) {
+        const auto start = cpp_freertos::Ticks::GetTicks();
+        while (!collect()) {
+            if (!wait(remaining(start, timeout))) {
                 return nullptr;
             }
         }
-        auto item = queue_.front();
-        queue_.pop_front();
+        auto item = std::move(pending_.front());
+        pending_.pop_front();
         return item;
     }
 
     void pop(T &item)
     {
-        cpp_freertos::LockGuard mlock(mutex_);
-        while (queue_.empty()) {
-            thread_->Wait(cond_, mutex_);
+        item = pop();
+    }
+
+    /// Moves all the items received to the end of items, waits for at least one for up to the timeout
+    /// \return false on timeout
+    bool pop_all(std::vector<T> &items, uint32_t timeout = portMAX_DELAY)
+    {
+        const auto start = cpp_freertos::Ticks::GetTicks();
+        while (!collect()) {
+            if (!wait(remaining(start, timeout))) {
+                return false;
+            }
+        }
+        for (auto &item : pending_) {
+            items.push_back(std::move(item));
         }
-        item = queue_.front();
-        queue_.pop_front();
+        pending_.clear();
+        return true;
     }
 
+    /// Puts the item back before all the others, to be called only by the thread owning the mailbox
     void push_front(const T &item)
     {
-        mutex_.Lock();
-        queue_.push_front(item);
-        mutex_.Unlock();
+        pending_.push_front(item);
     }
 
     void push(const T &item)
     {
-        mutex_.Lock();
-        queue_.push_back(item);
-        mutex_.Unlock();
-        cond_.Signal();
+        push(T(item));
     }
 
     void push(T &&item)
     {
-        mutex_.Lock();
-        queue_.push_back(std::move(item));
-        mutex_.Unlock();
-        cond_.Signal();
+        if (overflowed_.load() || !tryPush(item)) {
+            cpp_freertos::LockGuard lock(overflowMutex_);
+            overflow_.push_back(std::move(item));
+            overflowed_.store(true);
+        }
+        if (waiting_.exchange(false)) {
+            wakeup_.Give();
+        }
     }
 
   private:
+    struct Cell
+    {
+        std::atomic<std::size_t> sequence;
+        T item;
+    };
+
+    /// Reserves a cell by moving the end of the ring, the item is visible to the receiver once its sequence is set
+    bool tryPush(T &item)
+    {
+        auto position = enqueuePosition_.load(std::memory_order_relaxed);
+        while (true) {
+            auto &cell          = cells_[position & (Capacity - 1)];
+            const auto sequence = cell.sequence.load(std::memory_order_acquire);
+            const auto diff     = static_cast<std::ptrdiff_t>(sequence) - static_cast<std::ptrdiff_t>(position);
+            if (diff == 0) {
+                if (enqueuePosition_.compare_exchange_weak(position, position + 1)) {
+                    cell.item = std::move(item);
+                    cell.sequence.store(position + 1);
+                    return true;
+                }
+            }
+            else if (diff < 0) {
+                return false;
+            }
+            else {
+                position = enqueuePosition_.load(std::memory_order_relaxed);
+            }
+        }
+    }
+
+    bool tryPop()
+    {
+        auto &cell = cells_[dequeuePosition_ & (Capacity - 1)];
+        if (cell.sequence.load(std::memory_order_acquire) != dequeuePosition_ + 1) {
+            return false;
+        }
+        pending_.push_back(std::move(cell.item));
+        cell.item = T{};
+        cell.sequence.store(dequeuePosition_ + Capacity, std::memory_order_release);
+        ++dequeuePosition_;
+        return true;
+    }
+
+    /// No cell is reserved by a sender, so none is still being written to
+    bool ringEmpty() const
+    {
+        return enqueuePosition_.load() == dequeuePosition_;
+    }
+
+    bool readyToCollect() const
+    {
+        const auto &cell = cells_[dequeuePosition_ & (Capacity - 1)];
+        return cell.sequence.load() == dequeuePosition_ + 1 || (overflowed_.load() && ringEmpty());
+    }
+
+    /// Moves the items received to pending_, returns true if there is any item pending
+    bool collect()
+    {
+        while (tryPop()) {}
+        if (overflowed_.load()) {
+            cpp_freertos::LockGuard lock(overflowMutex_);
+            // Items in the ring are older than the overflowing ones of the same sender. The ring is checked under the
+            // lock, as a sender reserves a cell before it takes the lock to put its next item in the overflow.
+            if (ringEmpty()) {
+                for (auto &item : overflow_) {
+                    pending_.push_back(std::move(item));
+                }
+                overflow_.clear();
+                overflowed_.store(false);
+            }
+        }
+        return !pending_.empty();
+    }
+
+    bool wait(TickType_t timeout)
+    {
+        waiting_.store(true);
+        if (readyToCollect()) {
+            waiting_.store(false);
+            return true;
+        }
+        const auto woken = wakeup_.Take(timeout);
+        waiting_.store(false);
+        return woken;
+    }
+
+    static TickType_t remaining(TickType_t start, uint32_t timeout)
+    {
+        if (timeout == portMAX_DELAY) {
+            return portMAX_DELAY;
+        }
+        const auto elapsed = cpp_freertos::Ticks::GetTicks() - start;
+        return elapsed < timeout ? timeout - elapsed : 0;
+    }
+
     cpp_freertos::Thread *thread_;
-    std::deque<T> queue_;
-    cpp_freertos::MutexStandard mutex_;
-    cpp_freertos::ConditionVariable cond_;
+
+    std::array<Cell, Capacity> cells_;
+    std::atomic<std::size_t> enqueuePosition_{0};
+    std::size_t dequeuePosition_ = 0;
+
+    std::deque<T> overflow_;
+    std::atomic_bool overflowed_{false};
+    cpp_freertos::MutexStandard overflowMutex_;
+
+    std::atomic_bool waiting_{false};
+    cpp_freertos::BinarySemaphore wakeup_;
+
+    std::deque<T> pending_;
 };
@@ -12,6 +12,7 @@
 #include <cstdint>
 #include <memory>
 #include <string>
+#include <string_view>
 
 namespace sys
 {
@@ -31,6 +32,59 @@ namespace sys
         [[nodiscard]] MessageUIDType getNext() noexcept;
     };
 
+    /// Name of a service interned for the whole run, so copying it copies a pointer and comparing two names compares
+    /// pointers. Interning a new name is lock-free but looks through the names interned before, so names used on
+    /// every message (e.g. the name of the sender service) should be interned once and then copied.
+    class ServiceName
+    {
+      public:
+        /// "Unknown"
+        ServiceName() noexcept;
+        explicit ServiceName(std::string_view name);
+        ServiceName &operator=(std::string_view name);
+
+        [[nodiscard]] const std::string &str() const noexcept
+        {
+            return *name;
+        }
+        [[nodiscard]] const char *c_str() const noexcept
+        {
+            return name->c_str();
+        }
+        operator const std::string &() const noexcept
+        {
+            return *name;
+        }
+
+        friend bool operator==(const ServiceName &lhs, const ServiceName &rhs) noexcept
+        {
+            return lhs.name == rhs.name;
+        }
+        friend bool operator!=(const ServiceName &lhs, const ServiceName &rhs) noexcept
+        {
+            return lhs.name != rhs.name;
+        }
+        friend bool operator==(const ServiceName &lhs, std::string_view rhs) noexcept
+        {
+            return *lhs.name == rhs;
+        }
+        friend bool operator!=(const ServiceName &lhs, std::string_view rhs) noexcept
+        {
+            return *lhs.name != rhs;
+        }
+        friend bool operator==(std::string_view lhs, const ServiceName &rhs) noexcept
+        {
+            return lhs == *rhs.name;
+        }
+        friend bool operator!=(std::string_view lhs, const ServiceName &rhs) noexcept
+        {
+            return lhs != *rhs.name;
+        }
+
+      private:
+        const std::string *name;
+    };
+
     class Message
     {
       public:
@@ -66,14 +120,14 @@ namespace sys
         Type type                  = Type::Unspecified;
         TransmissionType transType = TransmissionType::Unspecified;
         BusChannel channel         = BusChannel::Unknown;
-        std::string sender         = "Unknown";
+        ServiceName sender;
 
         [[nodiscard]] std::string to_string() const
         {
             return "| ID:" + std::to_string(id) + " | uniID: " + std::to_string(uniID) +
                    " | Type: " + std::string(magic_enum::enum_name(type)) +
                    " | TransmissionType: " + std::string(magic_enum::enum_name(transType)) +
-                   " | Channel: " + std::string(magic_enum::enum_name(channel)) + " | Sender: " + sender + " |";
+                   " | Channel: " + std::string(magic_enum::enum_name(channel)) + " | Sender: " + sender.str() + " |";
         }
 
         /**
@@ -0,0 +1,51 @@
+// Copyright (c) 2017-2021, Mudita Sp. z.o.o. All rights reserved.
+// For licensing, see https://github.com/mudita/MuditaOS/LICENSE.md
+
+#pragma once
+
+#include "ServiceForward.hpp"
+
+#include <cstddef>
+#include <memory>
+#include <typeinfo>
+#include <vector>
+
+namespace sys
+{
+    /// Message handlers of a service, looked up by the type of a message on every message received.
+    /// A type is keyed by the address of its std::type_info, which is constant for the type, in an open addressing
+    /// table, so the lookup hashes a pointer instead of walking a map comparing type names.
+    /// Each type looked up gets an entry, even if there is no handler for it, so everything else needing RTTI
+    /// (e.g. if it is a DataMessage) is checked only once per type.
+    class MessageHandlers
+    {
+      public:
+        struct Entry
+        {
+            const std::type_info *type = nullptr;
+            MessageHandler handler;
+            bool connected   = false;
+            /// Set on the first message of the type, an entry added by connect has no message to check yet
+            bool dataMessage = false;
+            bool checked     = false;
+        };
+
+        bool connect(const std::type_info &type, MessageHandler handler);
+        bool disconnect(const std::type_info &type);
+
+        /// Entry of the type of the message, created on the first lookup of the type.
+        /// Entries are never moved nor removed, so the reference stays valid even if a handler connects another one.
+        const Entry &find(const Message &message);
+
+      private:
+        static constexpr std::size_t initialCapacity = 16;
+
+        [[nodiscard]] std::size_t slotOf(const std::type_info *type) const noexcept;
+        Entry *lookup(const std::type_info *type) const noexcept;
+        Entry &insert(const std::type_info &type);
+        void grow();
+
+        std::vector<std::unique_ptr<Entry>> slots;
+        std::size_t used = 0;
+    };
+} // namespace sys
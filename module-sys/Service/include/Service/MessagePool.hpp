@@ -0,0 +1,110 @@
+// Copyright (c) 2017-2021, Mudita Sp. z.o.o. All rights reserved.
+// For licensing, see https://github.com/mudita/MuditaOS/LICENSE.md
+
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <memory>
+#include <new>
+
+namespace sys
+{
+    namespace pool
+    {
+        /// Fixed number of equal blocks carved from the storage given, taken and given back from any thread.
+        /// It's only a free list in a critical section, shorter than the one of the heap allocator.
+        class Blocks
+        {
+          public:
+            Blocks(void *storage, std::size_t blockSize, std::size_t count) noexcept;
+
+            /// nullptr if all the blocks are taken
+            void *take() noexcept;
+            /// false if the pointer is not a block of the pool
+            bool give(void *block) noexcept;
+
+          private:
+            struct FreeBlock
+            {
+                FreeBlock *next;
+            };
+
+            std::byte *begin;
+            std::byte *end;
+            FreeBlock *freeBlocks = nullptr;
+        };
+
+        template <std::size_t Size, std::size_t Alignment, std::size_t Count> class StaticBlocks : public Blocks
+        {
+          public:
+            StaticBlocks() noexcept : Blocks(storage.data(), blockSize, Count)
+            {}
+
+          private:
+            static constexpr auto blockSize =
+                (std::max(Size, sizeof(void *)) + Alignment - 1) / Alignment * Alignment;
+            alignas(std::max(Alignment, alignof(void *))) std::array<std::byte, blockSize * Count> storage;
+        };
+
+        /// Allocates single objects from a pool of Count blocks of the type, falls back to the heap when it's empty
+        template <typename T, std::size_t Count> class Allocator
+        {
+          public:
+            using value_type = T;
+            template <typename U> struct rebind
+            {
+                using other = Allocator<U, Count>;
+            };
+
+            Allocator() noexcept = default;
+            template <typename U> Allocator(const Allocator<U, Count> &) noexcept
+            {}
+
+            T *allocate(std::size_t n)
+            {
+                if (n == 1) {
+                    if (auto block = blocks().take(); block != nullptr) {
+                        return static_cast<T *>(block);
+                    }
+                }
+                return static_cast<T *>(::operator new(n * sizeof(T)));
+            }
+
+            void deallocate(T *object, std::size_t) noexcept
+            {
+                if (!blocks().give(object)) {
+                    ::operator delete(object);
+                }
+            }
+
+            template <typename U> bool operator==(const Allocator<U, Count> &) const noexcept
+            {
+                return true;
+            }
+            template <typename U> bool operator!=(const Allocator<U, Count> &) const noexcept
+            {
+                return false;
+            }
+
+          private:
+            static Blocks &blocks()
+            {
+                static StaticBlocks<sizeof(T), alignof(T), Count> instance;
+                return instance;
+            }
+        };
+    } // namespace pool
+
+    inline constexpr std::size_t defaultPooledMessagesCount = 8;
+
+    /// Makes a message like std::make_shared, but the message and its shared state come from a pool of blocks kept
+    /// for the type, so the heap is used only if more messages of the type are alive at once than the pool holds.
+    /// Meant for messages sent all the time, e.g. on each frame rendered.
+    template <typename Msg, std::size_t Count = defaultPooledMessagesCount, typename... Args>
+    std::shared_ptr<Msg> makePooledMessage(Args &&...args)
+    {
+        return std::allocate_shared<Msg>(pool::Allocator<Msg, Count>{}, std::forward<Args>(args)...);
+    }
+} // namespace sys
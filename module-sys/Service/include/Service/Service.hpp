@@ -7,6 +7,7 @@
 #include "BusProxy.hpp"
 #include "Mailbox.hpp" // for Mailbox
 #include "Message.hpp" // for MessagePointer
+#include "MessageHandlers.hpp"
 #include "ServiceManifest.hpp"
 #include "thread.hpp" // for Thread
 #include <SystemWatchdog/Watchdog.hpp>
@@ -91,7 +92,7 @@ namespace sys
 
         void Run() override;
 
-        std::map<std::type_index, MessageHandler> message_handlers;
+        MessageHandlers message_handlers;
 
       private:
         /// first point of enttry on messages - actually used method in run
@@ -101,11 +102,13 @@ namespace sys
         auto HandleMessage(Message *message) -> MessagePointer;
         auto HandleResponse(ResponseMessage *message) -> MessagePointer;
         /// Execute a message handler functor, if found one.
+        /// \param handlers Message handlers entry of the type of the message
         /// \param message  Request message
         /// \return A pair of:
         /// - True if message handler called, false otherwise.
         /// - A response message on success, nullptr otherwise.
-        auto ExecuteMessageHandler(Message *message) -> std::pair<bool, MessagePointer>;
+        static auto ExecuteMessageHandler(const MessageHandlers::Entry &handlers, Message *message)
+            -> std::pair<bool, MessagePointer>;
 
         friend Proxy;
 
@@ -0,0 +1,55 @@
+// Copyright (c) 2017-2021, Mudita Sp. z.o.o. All rights reserved.
+// For licensing, see https://github.com/mudita/MuditaOS/LICENSE.md
+
+#include <catch2/catch.hpp>
+#include <Service/Mailbox.hpp>
+
+#include <memory>
+#include <vector>
+
+namespace
+{
+    using Item = std::shared_ptr<int>;
+    constexpr auto capacity = 4;
+} // namespace
+
+TEST_CASE("Mailbox")
+{
+    Mailbox<Item, capacity> mailbox(nullptr);
+
+    SECTION("empty mailbox times out")
+    {
+        REQUIRE(mailbox.pop(0) == nullptr);
+        std::vector<Item> items;
+        REQUIRE(!mailbox.pop_all(items, 0));
+        REQUIRE(items.empty());
+    }
+
+    SECTION("items keep their order when the ring overflows")
+    {
+        for (auto i = 0; i < 3 * capacity; ++i) {
+            mailbox.push(std::make_shared<int>(i));
+        }
+        REQUIRE(*mailbox.peek() == 0);
+        REQUIRE(*mailbox.pop(0) == 0);
+
+        // ring is used again once the overflow is taken
+        mailbox.push(std::make_shared<int>(3 * capacity));
+
+        std::vector<Item> items;
+        REQUIRE(mailbox.pop_all(items, 0));
+        REQUIRE(items.size() == 3 * capacity);
+        for (auto i = 0; i < 3 * capacity; ++i) {
+            REQUIRE(*items[i] == i + 1);
+        }
+        REQUIRE(mailbox.pop(0) == nullptr);
+    }
+
+    SECTION("item put back is popped first")
+    {
+        mailbox.push(std::make_shared<int>(1));
+        mailbox.push_front(std::make_shared<int>(0));
+        REQUIRE(*mailbox.pop(0) == 0);
+        REQUIRE(*mailbox.pop(0) == 1);
+    }
+}
@@ -0,0 +1,84 @@
+// Copyright (c) 2017-2021, Mudita Sp. z.o.o. All rights reserved.
+// For licensing, see https://github.com/mudita/MuditaOS/LICENSE.md
+
+#include <catch2/catch.hpp>
+#include <Service/Message.hpp>
+#include <Service/MessageHandlers.hpp>
+
+namespace
+{
+    class FirstMessage : public sys::DataMessage
+    {};
+
+    class SecondMessage : public sys::Message
+    {
+      public:
+        SecondMessage() : Message(Type::Data)
+        {}
+    };
+} // namespace
+
+TEST_CASE("Message handlers lookup")
+{
+    sys::MessageHandlers handlers;
+    FirstMessage first;
+    SecondMessage second;
+
+    SECTION("not connected")
+    {
+        const auto &entry = handlers.find(first);
+        REQUIRE(!entry.connected);
+        REQUIRE(entry.dataMessage);
+        REQUIRE(!handlers.find(second).dataMessage);
+        REQUIRE(&handlers.find(first) == &entry);
+    }
+
+    SECTION("connect and disconnect")
+    {
+        auto calls = 0;
+        REQUIRE(handlers.connect(typeid(FirstMessage), [&calls](sys::Message *) {
+            ++calls;
+            return sys::msgHandled();
+        }));
+        REQUIRE(!handlers.connect(typeid(FirstMessage), nullptr));
+
+        const auto &entry = handlers.find(first);
+        REQUIRE(entry.connected);
+        REQUIRE(entry.handler(&first) != nullptr);
+        REQUIRE(calls == 1);
+        REQUIRE(!handlers.find(second).connected);
+
+        REQUIRE(handlers.disconnect(typeid(FirstMessage)));
+        REQUIRE(!handlers.disconnect(typeid(FirstMessage)));
+        REQUIRE(!entry.connected);
+        REQUIRE(handlers.connect(typeid(FirstMessage), nullptr));
+        REQUIRE(entry.connected);
+    }
+
+    SECTION("entries stay in place when the table grows")
+    {
+        const auto &entry = handlers.find(first);
+        auto connected    = 0;
+        auto connect      = [&](const std::type_info &type) {
+            connected += handlers.connect(type, nullptr) ? 1 : 0;
+        };
+        connect(typeid(int));
+        connect(typeid(char));
+        connect(typeid(short));
+        connect(typeid(long));
+        connect(typeid(float));
+        connect(typeid(double));
+        connect(typeid(bool));
+        connect(typeid(unsigned));
+        connect(typeid(unsigned char));
+        connect(typeid(unsigned short));
+        connect(typeid(unsigned long));
+        connect(typeid(long long));
+        connect(typeid(unsigned long long));
+        connect(typeid(long double));
+        connect(typeid(SecondMessage));
+        REQUIRE(connected == 15);
+        REQUIRE(&handlers.find(first) == &entry);
+        REQUIRE(handlers.find(second).connected);
+    }
+}
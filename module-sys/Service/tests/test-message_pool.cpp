@@ -0,0 +1,55 @@
+// Copyright (c) 2017-2021, Mudita Sp. z.o.o. All rights reserved.
+// For licensing, see https://github.com/mudita/MuditaOS/LICENSE.md
+
+#include <catch2/catch.hpp>
+#include <Service/Message.hpp>
+#include <Service/MessagePool.hpp>
+
+#include <vector>
+
+namespace
+{
+    class PooledMessage : public sys::DataMessage
+    {
+      public:
+        explicit PooledMessage(int value) : value{value}
+        {}
+        int value;
+    };
+} // namespace
+
+TEST_CASE("Message pool")
+{
+    constexpr auto count = 4;
+    std::vector<std::shared_ptr<PooledMessage>> messages;
+    for (auto i = 0; i < 2 * count; ++i) {
+        messages.push_back(sys::makePooledMessage<PooledMessage, count>(i));
+    }
+    for (auto i = 0; i < 2 * count; ++i) {
+        REQUIRE(messages[i]->value == i);
+        REQUIRE(messages[i].use_count() == 1);
+    }
+
+    // blocks given back are taken again
+    const auto pooled = messages.front().get();
+    messages.erase(messages.begin());
+    auto message = sys::makePooledMessage<PooledMessage, count>(-1);
+    REQUIRE(message.get() == pooled);
+    REQUIRE(message->value == -1);
+}
+
+TEST_CASE("Service names")
+{
+    sys::ServiceName name;
+    REQUIRE(name == "Unknown");
+    REQUIRE(name == sys::ServiceName{"Unknown"});
+
+    name = "ServiceTest";
+    REQUIRE(name == sys::ServiceName{std::string{"ServiceTest"}});
+    REQUIRE(name != sys::ServiceName{});
+    REQUIRE(name.c_str() == sys::ServiceName{"ServiceTest"}.c_str());
+
+    const std::string copy = name;
+    REQUIRE(copy == name);
+    REQUIRE(name != "ServiceOther");
+}
@@ -0,0 +1,82 @@
+// Copyright (c) 2017-2021, Mudita Sp. z.o.o. All rights reserved.
+// For licensing, see https://github.com/mudita/MuditaOS/LICENSE.md
+
+#include <catch2/catch.hpp>
+#include <details/bus/PendingRequests.hpp>
+
+#include <limits>
+#include <vector>
+
+namespace
+{
+    sys::MessagePointer responseTo(sys::MessageUIDType id)
+    {
+        auto response   = std::make_shared<sys::ResponseMessage>();
+        response->uniID = id;
+        return response;
+    }
+} // namespace
+
+TEST_CASE("Pending requests")
+{
+    sys::PendingRequests requests;
+    std::vector<std::pair<int, sys::ReturnCodes>> results;
+    auto handler = [&results](int request) {
+        return [&results, request](sys::SendResult result) { results.emplace_back(request, result.first); };
+    };
+
+    REQUIRE(requests.empty());
+    REQUIRE(!requests.timeToDeadline(0).has_value());
+
+    requests.add(1, 100, handler(1));
+    requests.add(2, 50, handler(2));
+    requests.add(3, 200, handler(3));
+
+    SECTION("responses in any order")
+    {
+        REQUIRE(requests.respond(responseTo(3)));
+        REQUIRE(requests.respond(responseTo(1)));
+        REQUIRE(!requests.respond(responseTo(1)));
+        REQUIRE(!requests.respond(responseTo(4)));
+        auto request   = std::make_shared<sys::DataMessage>();
+        request->uniID = 2;
+        REQUIRE(!requests.respond(request));
+        REQUIRE(results == decltype(results){{3, sys::ReturnCodes::Success}, {1, sys::ReturnCodes::Success}});
+        REQUIRE(!requests.empty());
+    }
+
+    SECTION("timeouts")
+    {
+        REQUIRE(requests.timeToDeadline(10) == 40U);
+        requests.expire(100);
+        REQUIRE(results == decltype(results){{1, sys::ReturnCodes::Timeout}, {2, sys::ReturnCodes::Timeout}});
+        REQUIRE(requests.timeToDeadline(150) == 50U);
+        REQUIRE(requests.timeToDeadline(300) == 0U);
+    }
+
+    SECTION("cancel")
+    {
+        REQUIRE(requests.cancel(2));
+        REQUIRE(!requests.cancel(2));
+        requests.expire(1000);
+        REQUIRE(results.size() == 2);
+        REQUIRE(requests.empty());
+    }
+
+    SECTION("deadline after ticks wrap around")
+    {
+        constexpr auto maxTicks = std::numeric_limits<std::uint32_t>::max();
+        requests.add(4, 10, handler(4));
+        requests.expire(maxTicks - 10);
+        REQUIRE(results.empty());
+        REQUIRE(requests.timeToDeadline(maxTicks - 10) == 21U);
+    }
+
+    SECTION("handler sending another request")
+    {
+        requests.add(5, 100, [&requests, &handler](sys::SendResult) { requests.add(6, 100, handler(6)); });
+        REQUIRE(requests.respond(responseTo(5)));
+        REQUIRE(requests.respond(responseTo(6)));
+        REQUIRE(results == decltype(results){{6, sys::ReturnCodes::Success}});
+    }
+}
@@ -0,0 +1,77 @@
+// Copyright (c) 2017-2021, Mudita Sp. z.o.o. All rights reserved.
+// For licensing, see https://github.com/mudita/MuditaOS/LICENSE.md
+
+#include <catch2/catch.hpp>
+#include <details/bus/ServiceRegistry.hpp>
+
+#include <set>
+#include <string>
+
+namespace
+{
+    // Services are only kept and compared by the registry, never accessed
+    sys::Service *fakeService(std::uintptr_t id)
+    {
+        return reinterpret_cast<sys::Service *>(id * 8);
+    }
+
+    std::set<sys::Service *> registeredOn(const sys::ServiceRegistry &registry, sys::BusChannel channel)
+    {
+        std::set<sys::Service *> services;
+        registry.forEach(channel, [&services](sys::Service *service) { services.insert(service); });
+        return services;
+    }
+} // namespace
+
+TEST_CASE("Service registry")
+{
+    sys::ServiceRegistry registry;
+    const auto first  = fakeService(1);
+    const auto second = fakeService(2);
+
+    REQUIRE(registry.add("First", first, {sys::BusChannel::System, sys::BusChannel::PhoneModeChanges}));
+    REQUIRE(registry.add("Second", second, {sys::BusChannel::System}));
+
+    SECTION("lookup")
+    {
+        REQUIRE(registry.get("First") == first);
+        REQUIRE(registry.get(registry.find("Second")) == second);
+        REQUIRE(registry.find("Third") == sys::ServiceRegistry::invalidHandle);
+        REQUIRE(registry.get("Third") == nullptr);
+    }
+
+    SECTION("channels")
+    {
+        REQUIRE(registeredOn(registry, sys::BusChannel::System) == std::set<sys::Service *>{first, second});
+        REQUIRE(registeredOn(registry, sys::BusChannel::PhoneModeChanges) == std::set<sys::Service *>{first});
+        REQUIRE(registeredOn(registry, sys::BusChannel::PhoneLockChanges).empty());
+
+        auto count = 0;
+        registry.forEach([&count](sys::Service *) { ++count; });
+        REQUIRE(count == 2);
+    }
+
+    SECTION("service restarted under the same name")
+    {
+        const auto handle    = registry.find("First");
+        const auto restarted = fakeService(3);
+        REQUIRE(registry.add("First", restarted, {sys::BusChannel::System}));
+        registry.remove("First", first, {sys::BusChannel::System, sys::BusChannel::PhoneModeChanges});
+        REQUIRE(registry.find("First") == handle);
+        REQUIRE(registry.get(handle) == restarted);
+
+        registry.remove("First", restarted, {sys::BusChannel::System});
+        REQUIRE(registry.get(handle) == nullptr);
+        REQUIRE(registeredOn(registry, sys::BusChannel::System) == std::set<sys::Service *>{second});
+    }
+
+    SECTION("names limit")
+    {
+        for (auto i = 2U; i < sys::ServiceRegistry::maxNames; ++i) {
+            REQUIRE(registry.add("Service" + std::to_string(i), fakeService(i + 10), {}));
+        }
+        REQUIRE(!registry.add("OneTooMany", fakeService(1000), {}));
+        REQUIRE(registry.get("Service100") == fakeService(110));
+        REQUIRE(registry.add("First", first, {}));
+    }
+}
@@ -0,0 +1,623 @@
+// Copyright (c) 2017-2021, Mudita Sp. z.o.o. All rights reserved.
+// For licensing, see https://github.com/mudita/MuditaOS/LICENSE.md
+
+#include "DeferredFormat.hpp"
+
+#include <algorithm>
+#include <cstdio>
+#include <cstring>
+#include <limits>
+#include <type_traits>
+
+namespace Log::deferred
+{
+    namespace
+    {
+        enum class Length
+        {
+            None,
+            Char,
+            Short,
+            Long,
+            LongLong,
+            Max,
+            Size,
+            PtrDiff,
+            LongDouble
+        };
+
+        /// Conversion specification of a printf-like format: %[flags][width][.precision][length]type
+        struct Conversion
+        {
+            const char *flags           = nullptr;
+            std::size_t flagsLength     = 0;
+            const char *width           = nullptr;
+            std::size_t widthLength     = 0;
+            bool widthArgument          = false;
+            bool hasPrecision           = false;
+            const char *precision       = nullptr;
+            std::size_t precisionLength = 0;
+            bool precisionArgument      = false;
+            Length length               = Length::None;
+            const char *lengthText      = nullptr;
+            std::size_t lengthTextSize  = 0;
+            /// Conversion character, 0 if the conversion is not supported
+            char type       = 0;
+            const char *end = nullptr;
+        };
+
+        constexpr auto nullString = "(null)";
+
+        bool isDigit(char c) noexcept
+        {
+            return c >= '0' && c <= '9';
+        }
+
+        const char *skipDigits(const char *position) noexcept
+        {
+            while (isDigit(*position)) {
+                ++position;
+            }
+            return position;
+        }
+
+        Length parseLength(const char *&position) noexcept
+        {
+            switch (*position) {
+            case 'h':
+                ++position;
+                if (*position == 'h') {
+                    ++position;
+                    return Length::Char;
+                }
+                return Length::Short;
+            case 'l':
+                ++position;
+                if (*position == 'l') {
+                    ++position;
+                    return Length::LongLong;
+                }
+                return Length::Long;
+            case 'j':
+                ++position;
+                return Length::Max;
+            case 'z':
+                ++position;
+                return Length::Size;
+            case 't':
+                ++position;
+                return Length::PtrDiff;
+            case 'L':
+                ++position;
+                return Length::LongDouble;
+            default:
+                return Length::None;
+            }
+        }
+
+        bool isSupported(char type, Length length) noexcept
+        {
+            switch (type) {
+            case 'd':
+            case 'i':
+            case 'o':
+            case 'u':
+            case 'x':
+            case 'X':
+                return length != Length::LongDouble;
+            case 'f':
+            case 'F':
+            case 'e':
+            case 'E':
+            case 'g':
+            case 'G':
+            case 'a':
+            case 'A':
+                return length == Length::None || length == Length::Long || length == Length::LongDouble;
+            case 'c':
+            case 's':
+            case 'p':
+                return length == Length::None;
+            case 'n':
+            case '%':
+                return true;
+            default:
+                return false;
+            }
+        }
+
+        /// \param position of the '%' starting the conversion
+        Conversion parse(const char *position) noexcept
+        {
+            Conversion conversion;
+            conversion.flags = ++position;
+            while (*position != '\0' && std::strchr("-+ #0", *position) != nullptr) {
+                ++position;
+            }
+            conversion.flagsLength = position - conversion.flags;
+
+            conversion.width = position;
+            if (*position == '*') {
+                conversion.widthArgument = true;
+                ++position;
+            }
+            else {
+                position = skipDigits(position);
+            }
+            conversion.widthLength = position - conversion.width;
+
+            if (*position == '.') {
+                conversion.hasPrecision = true;
+                conversion.precision    = ++position;
+                if (*position == '*') {
+                    conversion.precisionArgument = true;
+                    ++position;
+                }
+                else {
+                    position = skipDigits(position);
+                }
+                conversion.precisionLength = position - conversion.precision;
+            }
+
+            conversion.lengthText     = position;
+            conversion.length         = parseLength(position);
+            conversion.lengthTextSize = position - conversion.lengthText;
+
+            if (*position != '\0') {
+                conversion.type = isSupported(*position, conversion.length) ? *position : 0;
+                ++position;
+            }
+            conversion.end = position;
+            return conversion;
+        }
+
+        bool isSigned(char type) noexcept
+        {
+            return type == 'd' || type == 'i';
+        }
+
+        bool isUnsigned(char type) noexcept
+        {
+            return type == 'o' || type == 'u' || type == 'x' || type == 'X';
+        }
+
+        bool isReal(char type) noexcept
+        {
+            return type != '\0' && std::strchr("fFeEgGaA", type) != nullptr;
+        }
+
+        std::int64_t takeSigned(Length length, va_list &args) noexcept
+        {
+            switch (length) {
+            case Length::Long:
+                return va_arg(args, long);
+            case Length::LongLong:
+                return va_arg(args, long long);
+            case Length::Max:
+                return va_arg(args, std::intmax_t);
+            case Length::Size:
+                return va_arg(args, std::make_signed_t<std::size_t>);
+            case Length::PtrDiff:
+                return va_arg(args, std::ptrdiff_t);
+            default:
+                return va_arg(args, int);
+            }
+        }
+
+        std::uint64_t takeUnsigned(Length length, va_list &args) noexcept
+        {
+            switch (length) {
+            case Length::Long:
+                return va_arg(args, unsigned long);
+            case Length::LongLong:
+                return va_arg(args, unsigned long long);
+            case Length::Max:
+                return va_arg(args, std::uintmax_t);
+            case Length::Size:
+                return va_arg(args, std::size_t);
+            case Length::PtrDiff:
+                return va_arg(args, std::make_unsigned_t<std::ptrdiff_t>);
+            default:
+                return va_arg(args, unsigned int);
+            }
+        }
+
+        int parsePrecision(const Conversion &conversion) noexcept
+        {
+            constexpr auto maxPrecision = std::numeric_limits<int>::max() / 10;
+            int precision               = 0;
+            for (std::size_t i = 0; i < conversion.precisionLength; ++i) {
+                precision = std::min(precision * 10 + (conversion.precision[i] - '0'), maxPrecision);
+            }
+            return precision;
+        }
+
+        /// Reads the arguments in the order they were stored
+        class Reader
+        {
+          public:
+            Reader(const std::byte *data, std::size_t size) noexcept : position{data}, end{data + size}
+            {}
+
+            template <typename T> bool read(T &value) noexcept
+            {
+                if (static_cast<std::size_t>(end - position) < sizeof(T)) {
+                    return false;
+                }
+                std::memcpy(&value, position, sizeof(T));
+                position += sizeof(T);
+                return true;
+            }
+
+            bool read(const char *&data, std::uint16_t &length) noexcept
+            {
+                if (!read(length) || static_cast<std::size_t>(end - position) < length) {
+                    return false;
+                }
+                data = reinterpret_cast<const char *>(position);
+                position += length;
+                return true;
+            }
+
+          private:
+            const std::byte *position;
+            const std::byte *end;
+        };
+
+        /// Builds a conversion specification for snprintf, with the width and precision arguments put in place
+        class Specification
+        {
+          public:
+            void append(const char *text, std::size_t length) noexcept
+            {
+                if (size + length < sizeof(text_)) {
+                    std::memcpy(&text_[size], text, length);
+                    size += length;
+                }
+                else {
+                    valid = false;
+                }
+                text_[size] = '\0';
+            }
+
+            void append(char c) noexcept
+            {
+                append(&c, 1);
+            }
+
+            void append(std::int64_t number) noexcept
+            {
+                char digits[24];
+                const auto length = std::snprintf(digits, sizeof(digits), "%lld", static_cast<long long>(number));
+                append(digits, static_cast<std::size_t>(length));
+            }
+
+            [[nodiscard]] const char *c_str() const noexcept
+            {
+                return valid ? text_ : nullptr;
+            }
+
+          private:
+            char text_[48] = {'\0'};
+            std::size_t size = 0;
+            bool valid       = true;
+        };
+
+        template <typename... Values>
+        int print(char *buffer, std::size_t size, const Specification &specification, Values... values) noexcept
+        {
+            const auto spec = specification.c_str();
+            if (spec == nullptr) {
+                return -1;
+            }
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wformat-nonliteral"
+            return std::snprintf(buffer, size, spec, values...);
+#pragma GCC diagnostic pop
+        }
+
+        int printSigned(char *buffer, std::size_t size, const Specification &spec, Length length, std::int64_t value)
+        {
+            switch (length) {
+            case Length::Long:
+                return print(buffer, size, spec, static_cast<long>(value));
+            case Length::LongLong:
+                return print(buffer, size, spec, static_cast<long long>(value));
+            case Length::Max:
+                return print(buffer, size, spec, static_cast<std::intmax_t>(value));
+            case Length::Size:
+                return print(buffer, size, spec, static_cast<std::make_signed_t<std::size_t>>(value));
+            case Length::PtrDiff:
+                return print(buffer, size, spec, static_cast<std::ptrdiff_t>(value));
+            default:
+                return print(buffer, size, spec, static_cast<int>(value));
+            }
+        }
+
+        int printUnsigned(char *buffer, std::size_t size, const Specification &spec, Length length, std::uint64_t value)
+        {
+            switch (length) {
+            case Length::Long:
+                return print(buffer, size, spec, static_cast<unsigned long>(value));
+            case Length::LongLong:
+                return print(buffer, size, spec, static_cast<unsigned long long>(value));
+            case Length::Max:
+                return print(buffer, size, spec, static_cast<std::uintmax_t>(value));
+            case Length::Size:
+                return print(buffer, size, spec, static_cast<std::size_t>(value));
+            case Length::PtrDiff:
+                return print(buffer, size, spec, static_cast<std::make_unsigned_t<std::ptrdiff_t>>(value));
+            default:
+                return print(buffer, size, spec, static_cast<unsigned int>(value));
+            }
+        }
+    } // namespace
+
+    Arguments::Arguments(const char *format, va_list args, std::size_t maxSize) noexcept
+    {
+        va_list list;
+        va_copy(list, args);
+        for (auto position = std::strchr(format, '%'); position != nullptr; position = std::strchr(position, '%')) {
+            const auto conversion = parse(position);
+            position              = conversion.end;
+            if (conversion.type == '%') {
+                continue;
+            }
+            if (conversion.type == 0) {
+                break;
+            }
+
+            Value value{};
+            if (conversion.widthArgument) {
+                value.kind    = Kind::Integer;
+                value.integer = static_cast<std::int64_t>(va_arg(list, int));
+                if (!add(value, maxSize)) {
+                    break;
+                }
+            }
+            auto precision = conversion.hasPrecision ? parsePrecision(conversion) : -1;
+            if (conversion.precisionArgument) {
+                precision     = va_arg(list, int);
+                value.kind    = Kind::Integer;
+                value.integer = static_cast<std::int64_t>(precision);
+                if (!add(value, maxSize)) {
+                    break;
+                }
+            }
+
+            const auto type = conversion.type;
+            if (type == 'n') {
+                static_cast<void>(va_arg(list, void *));
+                continue;
+            }
+            if (isSigned(type)) {
+                value.kind    = Kind::Integer;
+                value.integer = static_cast<std::uint64_t>(takeSigned(conversion.length, list));
+            }
+            else if (isUnsigned(type)) {
+                value.kind    = Kind::Integer;
+                value.integer = takeUnsigned(conversion.length, list);
+            }
+            else if (type == 'c') {
+                value.kind    = Kind::Integer;
+                value.integer = static_cast<std::uint64_t>(va_arg(list, int));
+            }
+            else if (type == 'p') {
+                value.kind    = Kind::Integer;
+                value.integer = reinterpret_cast<std::uintptr_t>(va_arg(list, void *));
+            }
+            else if (isReal(type)) {
+                if (conversion.length == Length::LongDouble) {
+                    value.kind     = Kind::LongReal;
+                    value.longReal = va_arg(list, long double);
+                }
+                else {
+                    value.kind = Kind::Real;
+                    value.real = va_arg(list, double);
+                }
+            }
+            else {
+                const char *string = va_arg(list, const char *);
+                if (string == nullptr) {
+                    string = nullString;
+                }
+                const auto spaceLeft = maxSize - std::min(maxSize, storedSize + sizeof(std::uint16_t));
+                auto maxLength       = std::min<std::size_t>(spaceLeft, std::numeric_limits<std::uint16_t>::max());
+                if (precision >= 0) {
+                    maxLength = std::min(maxLength, static_cast<std::size_t>(precision));
+                }
+                value.kind          = Kind::String;
+                value.string.data   = string;
+                value.string.length = static_cast<std::uint16_t>(strnlen(string, maxLength));
+            }
+            if (!add(value, maxSize)) {
+                break;
+            }
+        }
+        va_end(list);
+    }
+
+    bool Arguments::add(const Value &value, std::size_t maxSize) noexcept
+    {
+        std::size_t valueSize = 0;
+        switch (value.kind) {
+        case Kind::Integer:
+            valueSize = sizeof(value.integer);
+            break;
+        case Kind::Real:
+            valueSize = sizeof(value.real);
+            break;
+        case Kind::LongReal:
+            valueSize = sizeof(value.longReal);
+            break;
+        case Kind::String:
+            valueSize = sizeof(value.string.length) + value.string.length;
+            break;
+        }
+        if (count == maxArguments || storedSize + valueSize > maxSize) {
+            return false;
+        }
+        values[count++] = value;
+        storedSize += valueSize;
+        return true;
+    }
+
+    void Arguments::store(std::byte *destination) const noexcept
+    {
+        for (std::size_t i = 0; i < count; ++i) {
+            const auto &value = values[i];
+            switch (value.kind) {
+            case Kind::Integer:
+                std::memcpy(destination, &value.integer, sizeof(value.integer));
+                destination += sizeof(value.integer);
+                break;
+            case Kind::Real:
+                std::memcpy(destination, &value.real, sizeof(value.real));
+                destination += sizeof(value.real);
+                break;
+            case Kind::LongReal:
+                std::memcpy(destination, &value.longReal, sizeof(value.longReal));
+                destination += sizeof(value.longReal);
+                break;
+            case Kind::String:
+                std::memcpy(destination, &value.string.length, sizeof(value.string.length));
+                destination += sizeof(value.string.length);
+                std::memcpy(destination, value.string.data, value.string.length);
+                destination += value.string.length;
+                break;
+            }
+        }
+    }
+
+    std::size_t format(char *buffer,
+                       std::size_t bufferSize,
+                       const char *format,
+                       const std::byte *arguments,
+                       std::size_t argumentsSize) noexcept
+    {
+        if (bufferSize == 0) {
+            return 0;
+        }
+        buffer[0] = '\0';
+
+        std::size_t length = 0;
+        auto append        = [&](const char *text, std::size_t textLength) {
+            const auto copied = std::min(textLength, bufferSize - 1 - length);
+            std::memcpy(&buffer[length], text, copied);
+            length += copied;
+            buffer[length] = '\0';
+        };
+
+        Reader reader{arguments, argumentsSize};
+        auto position = format;
+        while (true) {
+            const auto percent = std::strchr(position, '%');
+            append(position, percent != nullptr ? percent - position : std::strlen(position));
+            if (percent == nullptr) {
+                break;
+            }
+
+            const auto conversion = parse(percent);
+            position              = conversion.end;
+            if (conversion.type == '%') {
+                append("%", 1);
+                continue;
+            }
+            if (conversion.type == 0) {
+                break;
+            }
+            if (conversion.type == 'n') {
+                continue;
+            }
+
+            Specification spec;
+            spec.append('%');
+            spec.append(conversion.flags, conversion.flagsLength);
+            if (conversion.widthArgument) {
+                std::int64_t width;
+                if (!reader.read(width)) {
+                    break;
+                }
+                spec.append(width);
+            }
+            else {
+                spec.append(conversion.width, conversion.widthLength);
+            }
+            if (conversion.precisionArgument) {
+                std::int64_t precision;
+                if (!reader.read(precision)) {
+                    break;
+                }
+                if (conversion.type != 's') {
+                    spec.append('.');
+                    spec.append(precision);
+                }
+            }
+            else if (conversion.hasPrecision && conversion.type != 's') {
+                spec.append('.');
+                spec.append(conversion.precision, conversion.precisionLength);
+            }
+
+            int written     = -1;
+            const auto type = conversion.type;
+            if (type == 's') {
+                // The string stored is cut to the precision already, and isn't null terminated
+                const char *string;
+                std::uint16_t stringLength;
+                if (!reader.read(string, stringLength)) {
+                    break;
+                }
+                spec.append(".*s", 3);
+                written = print(&buffer[length], bufferSize - length, spec, static_cast<int>(stringLength), string);
+            }
+            else {
+                spec.append(conversion.lengthText, conversion.lengthTextSize);
+                spec.append(type);
+                if (isReal(type) && conversion.length == Length::LongDouble) {
+                    long double value;
+                    if (!reader.read(value)) {
+                        break;
+                    }
+                    written = print(&buffer[length], bufferSize - length, spec, value);
+                }
+                else if (isReal(type)) {
+                    double value;
+                    if (!reader.read(value)) {
+                        break;
+                    }
+                    written = print(&buffer[length], bufferSize - length, spec, value);
+                }
+                else {
+                    std::uint64_t value;
+                    if (!reader.read(value)) {
+                        break;
+                    }
+                    if (isSigned(type)) {
+                        written = printSigned(&buffer[length],
+                                              bufferSize - length,
+                                              spec,
+                                              conversion.length,
+                                              static_cast<std::int64_t>(value));
+                    }
+                    else if (isUnsigned(type)) {
+                        written = printUnsigned(&buffer[length], bufferSize - length, spec, conversion.length, value);
+                    }
+                    else if (type == 'c') {
+                        written = print(&buffer[length], bufferSize - length, spec, static_cast<int>(value));
+                    }
+                    else {
+                        written = print(&buffer[length],
+                                        bufferSize - length,
+                                        spec,
+                                        reinterpret_cast<void *>(static_cast<std::uintptr_t>(value)));
+                    }
+                }
+            }
+            if (written < 0) {
+                break;
+            }
+            length = std::min(length + static_cast<std::size_t>(written), bufferSize - 1);
+        }
+        return length;
+    }
+} // namespace Log::deferred
@@ -0,0 +1,71 @@
+// Copyright (c) 2017-2021, Mudita Sp. z.o.o. All rights reserved.
+// For licensing, see https://github.com/mudita/MuditaOS/LICENSE.md
+
+#pragma once
+
+#include <array>
+#include <cstdarg>
+#include <cstddef>
+#include <cstdint>
+
+namespace Log::deferred
+{
+    /// Arguments of a printf-like format taken from a va_list, to be stored and formatted later on.
+    /// Taking them only walks the format, numbers are copied as they are and strings are copied at most up to the
+    /// size given, so it costs a fraction of formatting them.
+    /// Formatting stops at the first conversion not supported (e.g. of wide characters) or past the last argument
+    /// stored, as no more than maxArguments are taken.
+    class Arguments
+    {
+      public:
+        static constexpr std::size_t maxArguments = 16;
+
+        Arguments(const char *format, va_list args, std::size_t maxSize) noexcept;
+
+        /// \return number of bytes needed to store the arguments
+        [[nodiscard]] std::size_t size() const noexcept
+        {
+            return storedSize;
+        }
+        void store(std::byte *destination) const noexcept;
+
+      private:
+        enum class Kind : std::uint8_t
+        {
+            Integer,
+            Real,
+            LongReal,
+            String
+        };
+
+        struct Value
+        {
+            Kind kind;
+            union
+            {
+                std::uint64_t integer;
+                double real;
+                long double longReal;
+                struct
+                {
+                    const char *data;
+                    std::uint16_t length;
+                } string;
+            };
+        };
+
+        bool add(const Value &value, std::size_t maxSize) noexcept;
+
+        std::array<Value, maxArguments> values;
+        std::size_t count      = 0;
+        std::size_t storedSize = 0;
+    };
+
+    /// Formats the format with the arguments stored like snprintf does
+    /// \return number of characters written, without the terminating null character
+    std::size_t format(char *buffer,
+                       std::size_t bufferSize,
+                       const char *format,
+                       const std::byte *arguments,
+                       std::size_t argumentsSize) noexcept;
+} // namespace Log::deferred
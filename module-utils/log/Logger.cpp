@@ -3,30 +3,58 @@
 
 #include "critical.hpp"
 #include <fstream>
+#include "DeferredFormat.hpp"
 #include "LockGuard.hpp"
 #include <Logger.hpp>
 #include <Utils.hpp>
+#include <cstdio>
+#include <cstring>
+#include <limits>
 #include <portmacro.h>
 #include <ticks.hpp>
 #include "macros.h"
 
 namespace Log
 {
-    std::map<std::string, logger_level> Logger::filtered = {{"ApplicationManager", logger_level::LOGINFO},
+    namespace
+    {
+        /// Log taken, followed by the name of the task logging, the copy of the format if it's kept in the record
+        /// and the arguments
+        struct Record
+        {
+            TickType_t ticks;
+            const char *file;
+            const char *function;
+            /// nullptr if the format is copied
+            const char *format;
+            int line;
+            std::uint16_t formatSize;
+            std::uint8_t taskNameLength;
+            /// noLevel for logs printed as they are, without the header
+            std::uint8_t level;
+            std::uint8_t device;
+        };
+
+        constexpr std::uint8_t noLevel      = std::numeric_limits<std::uint8_t>::max();
+        constexpr std::size_t maxFormatSize = 256;
+    } // namespace
+
+    const std::map<std::string, logger_level, std::less<>> Logger::filtered = {
+        {"ApplicationManager", logger_level::LOGINFO},
 #if (!LOG_SENSITIVE_DATA_ENABLED)
-                                                            {"CellularMux", logger_level::LOGINFO},
-                                                            {"ServiceCellular", logger_level::LOGINFO},
+        {"CellularMux", logger_level::LOGINFO},
+        {"ServiceCellular", logger_level::LOGINFO},
 #endif
-                                                            {"ServiceAntenna", logger_level::LOGERROR},
-                                                            {"ServiceAudio", logger_level::LOGINFO},
-                                                            {"ServiceBluetooth", logger_level::LOGINFO},
-                                                            {"ServiceBluetooth_w1", logger_level::LOGINFO},
-                                                            {"ServiceFota", logger_level::LOGINFO},
-                                                            {"ServiceEink", logger_level::LOGINFO},
-                                                            {"ServiceDB", logger_level::LOGINFO},
-                                                            {CRIT_STR, logger_level::LOGTRACE},
-                                                            {IRQ_STR, logger_level::LOGTRACE}};
-    const char *Logger::levelNames[]                     = {"TRACE", "DEBUG", "INFO", "WARN", "ERROR", "FATAL"};
+        {"ServiceAntenna", logger_level::LOGERROR},
+        {"ServiceAudio", logger_level::LOGINFO},
+        {"ServiceBluetooth", logger_level::LOGINFO},
+        {"ServiceBluetooth_w1", logger_level::LOGINFO},
+        {"ServiceFota", logger_level::LOGINFO},
+        {"ServiceEink", logger_level::LOGINFO},
+        {"ServiceDB", logger_level::LOGINFO},
+        {CRIT_STR, logger_level::LOGTRACE},
+        {IRQ_STR, logger_level::LOGTRACE}};
+    const char *Logger::levelNames[] = {"TRACE", "DEBUG", "INFO", "WARN", "ERROR", "FATAL"};
 
     std::ostream &operator<<(std::ostream &stream, const Application &application)
     {
@@ -35,7 +63,7 @@ namespace Log
         return stream;
     }
 
-    Logger::Logger() : circularBuffer{circularBufferSize}, rotator{".log"}
+    Logger::Logger() : records{recordBufferSize}, circularBuffer{circularBufferSize}, rotator{".log"}
     {}
 
     void Logger::enableColors(bool enable)
@@ -50,14 +78,16 @@ namespace Log
         }
     }
 
-    auto Logger::getLogLevel(const std::string &name) -> logger_level
+    auto Logger::getLogLevel(const char *name) -> logger_level
     {
-        return filtered[name];
+        const auto it = filtered.find(name);
+        return it != filtered.end() ? it->second : LOGTRACE;
     }
 
     auto Logger::getLogs() -> std::string
     {
         LockGuard lock(mutex);
+        drain();
 
         std::string logs;
         while (!circularBuffer.isEmpty()) {
@@ -78,25 +108,20 @@ namespace Log
 #else
         enableColors(false);
 #endif
+        startDrainTask();
     }
 
+    /// @return: number of characters printed like printf, the record is formatted later on
+    /// @return: -1 if the record was lost as the record buffer is full
     auto Logger::log(Device device, const char *fmt, va_list args) -> int
     {
-        LockGuard lock(mutex);
-
-        loggerBufferCurrentPos = 0;
-
-        const auto sizeLeft = loggerBufferSizeLeft();
-        const auto result   = vsnprintf(&loggerBuffer[loggerBufferCurrentPos], sizeLeft, fmt, args);
-        if (0 <= result) {
-            const auto numOfBytesAddedToBuffer = static_cast<size_t>(result);
-            loggerBufferCurrentPos += (numOfBytesAddedToBuffer < sizeLeft) ? numOfBytesAddedToBuffer : (sizeLeft - 1);
+        va_list argsCopy;
+        va_copy(argsCopy, args);
+        const auto length = std::vsnprintf(nullptr, 0, fmt, argsCopy);
+        va_end(argsCopy);
 
-            logToDevice(device, loggerBuffer, loggerBufferCurrentPos);
-            circularBuffer.put(std::string(loggerBuffer, loggerBufferCurrentPos));
-            return loggerBufferCurrentPos;
-        }
-        return -1;
+        const auto result = put(device, std::nullopt, nullptr, -1, nullptr, fmt, args);
+        return (result < 0) ? result : length;
     }
 
     auto Logger::log(
@@ -105,32 +130,165 @@ namespace Log
         if (!filterLogs(level)) {
             return -1;
         }
+        return put(Device::DEFAULT, level, file, line, function, fmt, args);
+    }
+
+    auto Logger::logAssert(const char *fmt, va_list args) -> int
+    {
         LockGuard lock(mutex);
 
-        loggerBufferCurrentPos = 0;
-        addLogHeader(level, file, line, function);
+        // Logs taken before the assertion go first, nothing will be formatted after it
+        drain();
+        logToDevice(fmt, args);
+
+        return loggerBufferCurrentPos;
+    }
 
-        const auto sizeLeft = loggerBufferSizeLeft();
-        const auto result   = vsnprintf(&loggerBuffer[loggerBufferCurrentPos], sizeLeft, fmt, args);
-        if (0 <= result) {
-            const auto numOfBytesAddedToBuffer = static_cast<size_t>(result);
-            loggerBufferCurrentPos += (numOfBytesAddedToBuffer < sizeLeft) ? numOfBytesAddedToBuffer : (sizeLeft - 1);
-            loggerBufferCurrentPos += snprintf(&loggerBuffer[loggerBufferCurrentPos], loggerBufferSizeLeft(), "\n");
+    void Logger::flush()
+    {
+        LockGuard lock(mutex);
+        drain();
+    }
+
+    /// @return: size of the record taken
+    /// @return: -1 if the record was lost as the record buffer is full
+    auto Logger::put(Device device,
+                     std::optional<logger_level> level,
+                     const char *file,
+                     int line,
+                     const char *function,
+                     const char *fmt,
+                     va_list args) -> int
+    {
+        const auto ticks    = cpp_freertos::Ticks::GetTicks();
+        const auto taskName = std::string_view{getTaskDesc()}.substr(0, std::numeric_limits<std::uint8_t>::max());
+        // Formats of the log macros are literals, formats given to printf may be built at runtime so are copied
+        const auto formatSize = level.has_value() ? 0 : strnlen(fmt, maxFormatSize - 1) + 1;
+        const deferred::Arguments arguments{fmt, args, maxArgumentsSize};
+        const auto size = sizeof(Record) + taskName.size() + formatSize + arguments.size();
+
+        auto data = records.reserve(size);
+        if (data == nullptr) {
+            return -1;
+        }
+        const Record record{ticks,
+                            file,
+                            function,
+                            formatSize == 0 ? fmt : nullptr,
+                            line,
+                            static_cast<std::uint16_t>(formatSize),
+                            static_cast<std::uint8_t>(taskName.size()),
+                            level.has_value() ? static_cast<std::uint8_t>(*level) : noLevel,
+                            static_cast<std::uint8_t>(device)};
+        auto position = data;
+        std::memcpy(position, &record, sizeof(record));
+        position += sizeof(record);
+        std::memcpy(position, taskName.data(), taskName.size());
+        position += taskName.size();
+        if (formatSize != 0) {
+            std::memcpy(position, fmt, formatSize - 1);
+            position[formatSize - 1] = std::byte{0};
+            position += formatSize;
+        }
+        arguments.store(position);
+        records.commit(data);
+
+        if (const auto drainTaskHandle_ = drainTaskHandle.load(); drainTaskHandle_ == nullptr) {
+            flush();
+        }
+        else if (drainWaiting.exchange(false)) {
+            if (isIRQ()) {
+                BaseType_t higherPriorityTaskWoken = pdFALSE;
+                vTaskNotifyGiveFromISR(drainTaskHandle_, &higherPriorityTaskWoken);
+                portEND_SWITCHING_ISR(higherPriorityTaskWoken);
+            }
+            else {
+                xTaskNotifyGive(drainTaskHandle_);
+            }
+        }
+        return static_cast<int>(size);
+    }
+
+    void Logger::drain()
+    {
+        records.consume([this](const std::byte *data, std::size_t size) { formatRecord(data, size); });
+
+        if (const auto lostRecords = records.takeLostRecords(); lostRecords > 0) {
+            loggerBufferCurrentPos = 0;
+            addLogHeader(LOGWARN, cpp_freertos::Ticks::GetTicks(), getTaskDesc());
+            loggerBufferCurrentPos += snprintf(&loggerBuffer[loggerBufferCurrentPos],
+                                               loggerBufferSizeLeft(),
+                                               "%u logs were lost, the log buffer was full\n",
+                                               static_cast<unsigned>(lostRecords));
+            loggerBufferCurrentPos = std::min(loggerBufferCurrentPos, LOGGER_BUFFER_SIZE - 1);
 
             logToDevice(Device::DEFAULT, loggerBuffer, loggerBufferCurrentPos);
             circularBuffer.put(std::string(loggerBuffer, loggerBufferCurrentPos));
-            return loggerBufferCurrentPos;
         }
-        return -1;
     }
 
-    auto Logger::logAssert(const char *fmt, va_list args) -> int
+    void Logger::formatRecord(const std::byte *data, std::size_t size)
     {
-        LockGuard lock(mutex);
+        Record record;
+        std::memcpy(&record, data, sizeof(record));
+        auto position = data + sizeof(record);
+        const std::string_view taskName{reinterpret_cast<const char *>(position), record.taskNameLength};
+        position += record.taskNameLength;
+        auto format = record.format;
+        if (record.formatSize != 0) {
+            format = reinterpret_cast<const char *>(position);
+            position += record.formatSize;
+        }
 
-        logToDevice(fmt, args);
+        loggerBufferCurrentPos = 0;
+        if (record.level != noLevel) {
+            addLogHeader(static_cast<logger_level>(record.level),
+                         record.ticks,
+                         taskName,
+                         record.file,
+                         record.line,
+                         record.function);
+        }
+        loggerBufferCurrentPos += deferred::format(&loggerBuffer[loggerBufferCurrentPos],
+                                                   loggerBufferSizeLeft(),
+                                                   format,
+                                                   position,
+                                                   size - static_cast<std::size_t>(position - data));
+        if (record.level != noLevel && loggerBufferCurrentPos < LOGGER_BUFFER_SIZE - 1) {
+            loggerBuffer[loggerBufferCurrentPos++] = '\n';
+        }
 
-        return loggerBufferCurrentPos;
+        logToDevice(static_cast<Device>(record.device), loggerBuffer, loggerBufferCurrentPos);
+        circularBuffer.put(std::string(loggerBuffer, loggerBufferCurrentPos));
+    }
+
+    void Logger::startDrainTask()
+    {
+        if (drainTaskHandle.load() != nullptr || xTaskGetSchedulerState() != taskSCHEDULER_RUNNING) {
+            return;
+        }
+        TaskHandle_t handle = nullptr;
+        if (xTaskCreate(drainTask, drainTaskName, drainTaskStackDepth, this, drainTaskPriority, &handle) == pdPASS) {
+            drainTaskHandle.store(handle);
+        }
+    }
+
+    void Logger::drainTask(void *parameters)
+    {
+        auto logger = static_cast<Logger *>(parameters);
+        while (true) {
+            logger->drainWaiting.store(true);
+            bool pending;
+            {
+                LockGuard lock(logger->mutex);
+                pending = !logger->records.empty();
+            }
+            if (!pending) {
+                ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
+            }
+            logger->drainWaiting.store(false);
+            logger->flush();
+        }
     }
 
     /// @param logPath: file path to store the log
@@ -158,8 +316,6 @@ namespace Log
 
         int status = 1;
         {
-            const auto &logs = getLogs();
-
             LockGuard lock(logFileMutex);
             std::ofstream logFile(logPath, std::fstream::out | std::fstream::app);
             if (!logFile.good()) {
@@ -173,7 +329,26 @@ namespace Log
             if (firstDump) {
                 addFileHeader(logFile);
             }
-            logFile.write(logs.data(), logs.size());
+
+            flush();
+            std::size_t count;
+            {
+                LockGuard lock(mutex);
+                count = circularBuffer.getSize();
+            }
+            // Logs are written one by one, the drain task waits for the mutex only as long as taking one of them
+            for (; count > 0; --count) {
+                std::string log;
+                {
+                    LockGuard lock(mutex);
+                    auto [result, msg] = circularBuffer.get();
+                    if (!result) {
+                        break;
+                    }
+                    log = std::move(msg);
+                }
+                logFile.write(log.data(), log.size());
+            }
             if (logFile.bad()) {
                 status = -EIO;
             }
@@ -201,20 +376,26 @@ namespace Log
         return getLogLevel(getTaskDesc()) <= level;
     }
 
-    void Logger::addLogHeader(logger_level level, const char *file, int line, const char *function)
+    void Logger::addLogHeader(logger_level level,
+                              TickType_t ticks,
+                              std::string_view taskName,
+                              const char *file,
+                              int line,
+                              const char *function)
     {
         loggerBufferCurrentPos += snprintf(&loggerBuffer[loggerBufferCurrentPos],
                                            LOGGER_BUFFER_SIZE - loggerBufferCurrentPos,
                                            "%" PRIu32 " ms ",
-                                           cpp_freertos::Ticks::TicksToMs(cpp_freertos::Ticks::GetTicks()));
+                                           cpp_freertos::Ticks::TicksToMs(ticks));
 
         loggerBufferCurrentPos += snprintf(&loggerBuffer[loggerBufferCurrentPos],
                                            LOGGER_BUFFER_SIZE - loggerBufferCurrentPos,
-                                           "%s%-5s %s[%s] %s%s:%s:%d:%s ",
+                                           "%s%-5s %s[%.*s] %s%s:%s:%d:%s ",
                                            logColors->levelColors[level].data(),
                                            levelNames[level],
                                            logColors->serviceNameColor.data(),
-                                           getTaskDesc(),
+                                           static_cast<int>(taskName.size()),
+                                           taskName.data(),
                                            logColors->callerInfoColor.data(),
                                            file,
                                            function,
@@ -6,11 +6,17 @@
 #include <assert.h>
 #include <log/log.hpp>
 #include "LoggerBuffer.hpp"
+#include "RecordBuffer.hpp"
 #include "log_colors.hpp"
 #include <rotator/Rotator.hpp>
+#include <atomic>
 #include <map>
+#include <optional>
 #include <mutex.hpp>
+#include <FreeRTOS.h>
+#include <task.h>
 #include <string>
+#include <string_view>
 #include <filesystem>
 
 namespace Log
@@ -30,6 +36,10 @@ namespace Log
     };
     std::ostream &operator<<(std::ostream &stream, const Application &application);
 
+    /// Logs are put into a ring of binary records by the threads logging: the format pointer, the arguments as they
+    /// are and the time. Taking a record costs a walk over the format and a compare-and-swap, the logs are formatted,
+    /// sent to the device and kept for dumping by a drain task of a low priority, started by init. Until then, and
+    /// if there is no scheduler running, logs are formatted right away by the thread logging.
     class Logger
     {
       public:
@@ -46,6 +56,8 @@ namespace Log
             -> int;
         auto logAssert(const char *fmt, va_list args) -> int;
         auto dumpToFile(std::filesystem::path logPath) -> int;
+        /// Formats all the logs taken so far
+        void flush();
 
         static constexpr auto CRIT_STR = "CRIT";
         static constexpr auto IRQ_STR  = "IRQ";
@@ -53,17 +65,31 @@ namespace Log
       private:
         Logger();
 
+        auto put(Device device,
+                 std::optional<logger_level> level,
+                 const char *file,
+                 int line,
+                 const char *function,
+                 const char *fmt,
+                 va_list args) -> int;
+        /// Formats the records taken, to be called with the mutex locked
+        void drain();
+        void formatRecord(const std::byte *data, std::size_t size);
+        void startDrainTask();
+        static void drainTask(void *parameters);
+
         void addLogHeader(logger_level level,
+                          TickType_t ticks,
+                          std::string_view taskName,
                           const char *file     = nullptr,
                           int line             = -1,
                           const char *function = nullptr);
         [[nodiscard]] bool filterLogs(logger_level level);
         /// Filter out not interesting logs via thread Name
         /// its' using fact that:
-        /// - TRACE is level 0, for unedfined lookups it will be alvways trace
-        /// - it will be one time init for apps which doesn't tell what level they should have
-        /// - for others it will be o1 lookup so it's fine
-        [[nodiscard]] auto getLogLevel(const std::string &name) -> logger_level;
+        /// - TRACE is level 0, for undefined lookups it will be always trace
+        /// - the map is never modified, so it may be looked up by any thread without locking
+        [[nodiscard]] static auto getLogLevel(const char *name) -> logger_level;
         void logToDevice(const char *fmt, va_list args);
         void logToDevice(Device device, std::string_view logMsg, size_t length);
         [[nodiscard]] size_t loggerBufferSizeLeft() const noexcept
@@ -75,6 +101,7 @@ namespace Log
 
         void addFileHeader(std::ofstream &file) const;
 
+        /// Guards formatting the records and the logs formatted
         cpp_freertos::MutexStandard mutex;
         cpp_freertos::MutexStandard logFileMutex;
         logger_level level{LOGTRACE};
@@ -84,12 +111,21 @@ namespace Log
         size_t maxFileSize                    = MAX_LOG_FILE_SIZE;
 
         Application application;
+        RecordBuffer records;
         LoggerBuffer circularBuffer;
         utils::Rotator<MAX_LOG_FILES_COUNT> rotator;
         static constexpr size_t circularBufferSize = 1000;
+        static constexpr size_t recordBufferSize   = 32 * 1024;
+        static constexpr size_t maxArgumentsSize   = LOGGER_BUFFER_SIZE / 4;
+
+        std::atomic<TaskHandle_t> drainTaskHandle{nullptr};
+        std::atomic_bool drainWaiting{false};
+        static constexpr auto drainTaskName            = "LogDrain";
+        static constexpr auto drainTaskStackDepth      = 1024;
+        static constexpr UBaseType_t drainTaskPriority = tskIDLE_PRIORITY + 1;
 
         static const char *levelNames[];
-        static std::map<std::string, logger_level> filtered;
+        static const std::map<std::string, logger_level, std::less<>> filtered;
     };
 
     const char *getTaskDesc();
@@ -0,0 +1,93 @@
+// Copyright (c) 2017-2021, Mudita Sp. z.o.o. All rights reserved.
+// For licensing, see https://github.com/mudita/MuditaOS/LICENSE.md
+
+#include "RecordBuffer.hpp"
+
+#include <cassert>
+#include <cstring>
+
+namespace Log
+{
+    namespace
+    {
+        constexpr std::size_t alignUp(std::size_t size, std::size_t alignment) noexcept
+        {
+            return (size + alignment - 1) & ~(alignment - 1);
+        }
+    } // namespace
+
+    RecordBuffer::RecordBuffer(std::size_t capacity)
+        : capacity{capacity}, storage{std::make_unique<std::uint64_t[]>(capacity / sizeof(std::uint64_t))}
+    {
+        assert(capacity >= 2 * sizeof(Header) && (capacity & (capacity - 1)) == 0);
+    }
+
+    std::byte *RecordBuffer::reserve(std::size_t size) noexcept
+    {
+        if (size > getMaxRecordSize()) {
+            lostRecords.fetch_add(1, std::memory_order_relaxed);
+            return nullptr;
+        }
+
+        const auto total = alignUp(sizeof(Header) + size, alignment);
+        auto position    = writePosition.load(std::memory_order_relaxed);
+        std::size_t padding;
+        do {
+            // A record never wraps around, the space up to the end of the storage is skipped instead
+            const auto spaceToEnd = capacity - (position & (capacity - 1));
+            padding               = total <= spaceToEnd ? 0 : spaceToEnd;
+            if (position + padding + total - readPosition.load(std::memory_order_acquire) > capacity) {
+                lostRecords.fetch_add(1, std::memory_order_relaxed);
+                return nullptr;
+            }
+        } while (!writePosition.compare_exchange_weak(
+            position, position + padding + total, std::memory_order_acq_rel, std::memory_order_relaxed));
+
+        if (padding != 0) {
+            auto header = headerAt(position);
+            __atomic_store_n(
+                &header->state, static_cast<std::uint32_t>(padding) | paddingFlag | committedFlag, __ATOMIC_RELEASE);
+            position += padding;
+        }
+        auto header  = headerAt(position);
+        header->size = static_cast<std::uint32_t>(size);
+        return reinterpret_cast<std::byte *>(header + 1);
+    }
+
+    void RecordBuffer::commit(std::byte *record) noexcept
+    {
+        auto header      = reinterpret_cast<Header *>(record) - 1;
+        const auto total = alignUp(sizeof(Header) + header->size, alignment);
+        __atomic_store_n(&header->state, static_cast<std::uint32_t>(total) | committedFlag, __ATOMIC_RELEASE);
+    }
+
+    bool RecordBuffer::empty() const noexcept
+    {
+        const auto header = headerAt(readPosition.load(std::memory_order_relaxed));
+        return (__atomic_load_n(&header->state, __ATOMIC_ACQUIRE) & committedFlag) == 0;
+    }
+
+    std::size_t RecordBuffer::getMaxRecordSize() const noexcept
+    {
+        return capacity / 2 - sizeof(Header);
+    }
+
+    std::size_t RecordBuffer::takeLostRecords() noexcept
+    {
+        return lostRecords.exchange(0, std::memory_order_relaxed);
+    }
+
+    RecordBuffer::Header *RecordBuffer::headerAt(std::size_t position) const noexcept
+    {
+        return reinterpret_cast<Header *>(reinterpret_cast<std::byte *>(storage.get()) +
+                                          (position & (capacity - 1)));
+    }
+
+    std::size_t RecordBuffer::release(std::size_t position, std::size_t size) noexcept
+    {
+        std::memset(headerAt(position), 0, size);
+        position += size;
+        readPosition.store(position, std::memory_order_release);
+        return position;
+    }
+} // namespace Log
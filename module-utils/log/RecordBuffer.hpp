@@ -0,0 +1,83 @@
+// Copyright (c) 2017-2021, Mudita Sp. z.o.o. All rights reserved.
+// For licensing, see https://github.com/mudita/MuditaOS/LICENSE.md
+
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+
+namespace Log
+{
+    /// Ring of binary records of any size, written by any number of threads and read by a single one.
+    /// A writer reserves space for its record with a single compare-and-swap, writes the record in place and commits
+    /// it, so writers never wait for each other nor for the reader. If there is no space left, the record is dropped
+    /// and counted as lost, the reader is never overtaken.
+    /// Records are read in the order of their reservations, the reader stops at the first record not committed yet.
+    class RecordBuffer
+    {
+      public:
+        /// \param capacity in bytes, a power of two
+        explicit RecordBuffer(std::size_t capacity);
+
+        /// \return space for the record to be written to and committed, nullptr if there is no space for it
+        [[nodiscard]] std::byte *reserve(std::size_t size) noexcept;
+        /// Makes the record reserved visible to the reader, the record is aligned to 8 bytes
+        void commit(std::byte *record) noexcept;
+
+        /// Calls the function with the data and the size of each record committed, to be called by a single thread
+        /// \return number of records read
+        template <typename Function> std::size_t consume(Function function)
+        {
+            std::size_t count = 0;
+            auto position     = readPosition.load(std::memory_order_relaxed);
+            while (true) {
+                auto header      = headerAt(position);
+                const auto state = __atomic_load_n(&header->state, __ATOMIC_ACQUIRE);
+                if ((state & committedFlag) == 0) {
+                    break;
+                }
+                if ((state & paddingFlag) == 0) {
+                    function(reinterpret_cast<const std::byte *>(header + 1), header->size);
+                    ++count;
+                }
+                position = release(position, state & sizeMask);
+            }
+            return count;
+        }
+
+        /// \return true if there is no record committed to be read
+        [[nodiscard]] bool empty() const noexcept;
+        [[nodiscard]] std::size_t getCapacity() const noexcept
+        {
+            return capacity;
+        }
+        /// Largest record which may fit in the buffer
+        [[nodiscard]] std::size_t getMaxRecordSize() const noexcept;
+        /// \return number of records dropped since the last call
+        std::size_t takeLostRecords() noexcept;
+
+      private:
+        struct Header
+        {
+            std::uint32_t state;
+            std::uint32_t size;
+        };
+
+        static constexpr std::uint32_t committedFlag = 1U << 31;
+        static constexpr std::uint32_t paddingFlag   = 1U << 30;
+        static constexpr std::uint32_t sizeMask      = paddingFlag - 1;
+        static constexpr std::size_t alignment       = sizeof(std::uint64_t);
+
+        [[nodiscard]] Header *headerAt(std::size_t position) const noexcept;
+        /// Clears the space of the record read, so that no header can be found committed there later on
+        std::size_t release(std::size_t position, std::size_t size) noexcept;
+
+        const std::size_t capacity;
+        std::unique_ptr<std::uint64_t[]> storage;
+        std::atomic<std::size_t> writePosition{0};
+        std::atomic<std::size_t> readPosition{0};
+        std::atomic<std::size_t> lostRecords{0};
+    };
+} // namespace Log
@@ -9,9 +9,9 @@ std::pair<bool, std::string> StringCircularBuffer::get()
         return {false, ""};
     }
 
-    const std::string val = buffer[tail];
-    full                  = false;
-    tail                  = (tail + 1) % capacity;
+    std::string val = std::move(buffer[tail]);
+    full            = false;
+    tail            = (tail + 1) % capacity;
     --size;
 
     return {true, val};
@@ -26,6 +26,9 @@
  *  2)
  *   log_Init('valid file pointer',LOGINFO);
  *   Send logs(level higher or equal to LOGINFO) to STDOUT stream and also to file specified by user.
+ *
+ *  Logs are formatted later on by the logger, so the format has to be a string literal. The macros put an empty
+ *  literal in front of it, so any other format fails to compile.
  */
 
 #ifndef LOG_LOG_H_
@@ -69,15 +72,15 @@ extern "C"
  * Log functions (one per level).
  */
 #define LOG_PRINTF(...)              log_Printf(__VA_ARGS__)
-#define LOG_TRACE(...)               log_Log(LOGTRACE, __FILENAME__, __LINE__, __func__, __VA_ARGS__)
-#define LOG_DEBUG(...)               log_Log(LOGDEBUG, __FILENAME__, __LINE__, __func__, __VA_ARGS__)
-#define LOG_INFO(...)                log_Log(LOGINFO, __FILENAME__, __LINE__, __func__, __VA_ARGS__)
-#define LOG_WARN(...)                log_Log(LOGWARN, __FILENAME__, __LINE__, __func__, __VA_ARGS__)
-#define LOG_ERROR(...)               log_Log(LOGERROR, __FILENAME__, __LINE__, __func__, __VA_ARGS__)
-#define LOG_FATAL(...)               log_Log(LOGFATAL, __FILENAME__, __LINE__, __func__, __VA_ARGS__)
-#define LOG_CUSTOM(loggerLevel, ...) log_Log(loggerLevel, __FILENAME__, __LINE__, __func__, __VA_ARGS__)
+#define LOG_TRACE(...)               log_Log(LOGTRACE, __FILENAME__, __LINE__, __func__, "" __VA_ARGS__)
+#define LOG_DEBUG(...)               log_Log(LOGDEBUG, __FILENAME__, __LINE__, __func__, "" __VA_ARGS__)
+#define LOG_INFO(...)                log_Log(LOGINFO, __FILENAME__, __LINE__, __func__, "" __VA_ARGS__)
+#define LOG_WARN(...)                log_Log(LOGWARN, __FILENAME__, __LINE__, __func__, "" __VA_ARGS__)
+#define LOG_ERROR(...)               log_Log(LOGERROR, __FILENAME__, __LINE__, __func__, "" __VA_ARGS__)
+#define LOG_FATAL(...)               log_Log(LOGFATAL, __FILENAME__, __LINE__, __func__, "" __VA_ARGS__)
+#define LOG_CUSTOM(loggerLevel, ...) log_Log(loggerLevel, __FILENAME__, __LINE__, __func__, "" __VA_ARGS__)
 #if LOG_SENSITIVE_DATA_ENABLED
-#define LOG_SENSITIVE(loggerLevel, ...) log_Log(loggerLevel, __FILENAME__, __LINE__, __func__, __VA_ARGS__)
+#define LOG_SENSITIVE(loggerLevel, ...) log_Log(loggerLevel, __FILENAME__, __LINE__, __func__, "" __VA_ARGS__)
 #else
 #define LOG_SENSITIVE(loggerLevel, ...)
 #endif
@@ -0,0 +1,142 @@
+// Copyright (c) 2017-2021, Mudita Sp. z.o.o. All rights reserved.
+// For licensing, see https://github.com/mudita/MuditaOS/LICENSE.md
+
+#define CATCH_CONFIG_MAIN // This tells Catch to provide a main() - only do this in one cpp file
+#include <catch2/catch.hpp>
+
+#include "DeferredFormat.hpp"
+#include <cinttypes>
+#include <cstdarg>
+#include <cstdint>
+#include <cstdio>
+#include <string>
+#include <vector>
+
+namespace
+{
+    constexpr std::size_t maxArgumentsSize = 256;
+
+    std::string formatLater(std::size_t bufferSize, const char *fmt, ...) __attribute__((format(printf, 2, 3)));
+    std::string formatLater(std::size_t bufferSize, const char *fmt, ...)
+    {
+        va_list args;
+        va_start(args, fmt);
+        const Log::deferred::Arguments arguments{fmt, args, maxArgumentsSize};
+        va_end(args);
+
+        std::vector<std::byte> stored(arguments.size());
+        arguments.store(stored.data());
+
+        std::vector<char> buffer(bufferSize);
+        const auto length = Log::deferred::format(buffer.data(), buffer.size(), fmt, stored.data(), stored.size());
+        REQUIRE(length < bufferSize);
+        REQUIRE(buffer[length] == '\0');
+        return std::string(buffer.data(), length);
+    }
+
+    std::string formatNow(const char *fmt, ...) __attribute__((format(printf, 1, 2)));
+    std::string formatNow(const char *fmt, ...)
+    {
+        char buffer[512];
+        va_list args;
+        va_start(args, fmt);
+        vsnprintf(buffer, sizeof(buffer), fmt, args);
+        va_end(args);
+        return buffer;
+    }
+} // namespace
+
+#define REQUIRE_FORMATTED_AS_NOW(...) REQUIRE(formatLater(512, __VA_ARGS__) == formatNow(__VA_ARGS__))
+
+TEST_CASE("Deferred format")
+{
+    SECTION("Text only")
+    {
+        REQUIRE_FORMATTED_AS_NOW("no conversions at all");
+        REQUIRE_FORMATTED_AS_NOW("%% and %%%%");
+    }
+
+    SECTION("Integers")
+    {
+        REQUIRE_FORMATTED_AS_NOW("%d %i %u %x %X %o", -42, 42, 42U, 0xbeefU, 0xbeefU, 8U);
+        REQUIRE_FORMATTED_AS_NOW("%hhd %hu %ld %lu %lld %llx", -1, 65535, -100000L, 100000UL, -1LL, ~0ULL);
+        REQUIRE_FORMATTED_AS_NOW("%jd %zu %td", INTMAX_MIN, SIZE_MAX, static_cast<std::ptrdiff_t>(-3));
+        REQUIRE_FORMATTED_AS_NOW("[%-6d] [%06d] [%+d] [% d] [%#x]", 12, -12, 12, 12, 12U);
+        REQUIRE_FORMATTED_AS_NOW("%" PRIu32 " ms", UINT32_C(123456));
+    }
+
+    SECTION("Characters and pointers")
+    {
+        int value = 0;
+        REQUIRE_FORMATTED_AS_NOW("%c%c%c", 'a', 'b', 'c');
+        REQUIRE_FORMATTED_AS_NOW("%p", static_cast<void *>(&value));
+    }
+
+    SECTION("Reals")
+    {
+        REQUIRE_FORMATTED_AS_NOW("%f %e %g %.2f %10.3f", 6.5323, -1e-9, 0.5, 3.14159, 2.0);
+        REQUIRE_FORMATTED_AS_NOW("%lf %Lf", 1.5, 2.5L);
+    }
+
+    SECTION("Strings")
+    {
+        const std::string string = "string";
+        REQUIRE_FORMATTED_AS_NOW("%s, %s", "carray", string.c_str());
+        REQUIRE_FORMATTED_AS_NOW("[%10s] [%-10s] [%.3s]", "right", "left", "cut off");
+    }
+
+    SECTION("Width and precision arguments")
+    {
+        const char notTerminated[] = {'a', 'b', 'c', 'd'};
+        REQUIRE_FORMATTED_AS_NOW("[%*d] [%-*d] [%.*f]", 5, 1, 5, 2, 3, 1.23456);
+        REQUIRE_FORMATTED_AS_NOW("[%.*s] [%*.*s]", 2, notTerminated, 6, 3, notTerminated);
+    }
+
+    SECTION("Null string")
+    {
+        const char *volatile string = nullptr;
+        REQUIRE(formatLater(512, "%s", string) == "(null)");
+    }
+
+    SECTION("Unsupported conversion stops formatting")
+    {
+        REQUIRE(formatLater(512, "%d %ls %d", 1, L"wide", 2) == "1 ");
+    }
+
+    SECTION("Formatting stops past the last argument stored")
+    {
+        REQUIRE(formatLater(512,
+                            "%d %d %d %d %d %d %d %d %d %d %d %d %d %d %d %d|%d",
+                            1,
+                            2,
+                            3,
+                            4,
+                            5,
+                            6,
+                            7,
+                            8,
+                            9,
+                            10,
+                            11,
+                            12,
+                            13,
+                            14,
+                            15,
+                            16,
+                            17) == "1 2 3 4 5 6 7 8 9 10 11 12 13 14 15 16|");
+    }
+
+    SECTION("Strings are cut to the space left")
+    {
+        const std::string string(2 * maxArgumentsSize, 'X');
+        const auto formatted = formatLater(1024, "%d %s", 1, string.c_str());
+        REQUIRE(formatted.size() == 2 + maxArgumentsSize - sizeof(std::uint64_t) - sizeof(std::uint16_t));
+        REQUIRE(formatted.find_first_not_of('X', 2) == std::string::npos);
+    }
+
+    SECTION("Output is cut to the buffer size")
+    {
+        REQUIRE(formatLater(8, "value: %d", 123456) == "value: ");
+        REQUIRE(formatLater(10, "%s and %s", "first", "second") == "first and");
+    }
+}
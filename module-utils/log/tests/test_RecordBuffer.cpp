@@ -0,0 +1,126 @@
+// Copyright (c) 2017-2021, Mudita Sp. z.o.o. All rights reserved.
+// For licensing, see https://github.com/mudita/MuditaOS/LICENSE.md
+
+#define CATCH_CONFIG_MAIN // This tells Catch to provide a main() - only do this in one cpp file
+#include <catch2/catch.hpp>
+
+#include "RecordBuffer.hpp"
+#include <cstring>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace
+{
+    bool put(Log::RecordBuffer &buffer, const std::string &text)
+    {
+        auto record = buffer.reserve(text.size());
+        if (record == nullptr) {
+            return false;
+        }
+        std::memcpy(record, text.data(), text.size());
+        buffer.commit(record);
+        return true;
+    }
+
+    std::vector<std::string> takeAll(Log::RecordBuffer &buffer)
+    {
+        std::vector<std::string> texts;
+        buffer.consume([&texts](const std::byte *data, std::size_t size) {
+            texts.emplace_back(reinterpret_cast<const char *>(data), size);
+        });
+        return texts;
+    }
+} // namespace
+
+TEST_CASE("Record buffer")
+{
+    Log::RecordBuffer buffer{256};
+
+    SECTION("Empty buffer")
+    {
+        REQUIRE(buffer.empty());
+        REQUIRE(takeAll(buffer).empty());
+        REQUIRE(buffer.takeLostRecords() == 0);
+    }
+
+    SECTION("Records are read in order")
+    {
+        REQUIRE(put(buffer, "first"));
+        REQUIRE(put(buffer, "second"));
+        REQUIRE(!buffer.empty());
+        REQUIRE(takeAll(buffer) == std::vector<std::string>{"first", "second"});
+        REQUIRE(buffer.empty());
+    }
+
+    SECTION("Reading stops at the first record not committed")
+    {
+        REQUIRE(put(buffer, "first"));
+        auto second = buffer.reserve(6);
+        REQUIRE(second != nullptr);
+        REQUIRE(put(buffer, "third"));
+
+        REQUIRE(takeAll(buffer) == std::vector<std::string>{"first"});
+        std::memcpy(second, "second", 6);
+        buffer.commit(second);
+        REQUIRE(takeAll(buffer) == std::vector<std::string>{"second", "third"});
+    }
+
+    SECTION("Records are lost if there is no space for them")
+    {
+        const std::string text(100, 'X');
+        REQUIRE(put(buffer, text));
+        REQUIRE(put(buffer, text));
+        REQUIRE(!put(buffer, text));
+        REQUIRE(!put(buffer, std::string(buffer.getMaxRecordSize() + 1, 'X')));
+        REQUIRE(buffer.takeLostRecords() == 2);
+        REQUIRE(buffer.takeLostRecords() == 0);
+
+        REQUIRE(takeAll(buffer).size() == 2);
+        REQUIRE(put(buffer, text));
+    }
+
+    SECTION("Records wrap around the end of the buffer")
+    {
+        for (int i = 0; i < 100; ++i) {
+            const std::string text(static_cast<std::size_t>(1 + i % 70), static_cast<char>('a' + i % 26));
+            REQUIRE(put(buffer, text));
+            REQUIRE(takeAll(buffer) == std::vector<std::string>{text});
+        }
+    }
+}
+
+TEST_CASE("Record buffer written by many threads")
+{
+    constexpr auto threadsCount     = 4;
+    constexpr auto recordsPerThread = 10000;
+    Log::RecordBuffer buffer{1024};
+
+    std::vector<std::thread> threads;
+    for (int thread = 0; thread < threadsCount; ++thread) {
+        threads.emplace_back([&buffer, thread]() {
+            for (int i = 0; i < recordsPerThread;) {
+                const std::string text = std::to_string(thread) + ":" + std::to_string(i);
+                if (put(buffer, text)) {
+                    ++i;
+                }
+            }
+        });
+    }
+
+    std::vector<int> next(threadsCount, 0);
+    auto received = 0;
+    while (received < threadsCount * recordsPerThread) {
+        for (const auto &text : takeAll(buffer)) {
+            const auto separator = text.find(':');
+            const auto thread    = std::stoi(text.substr(0, separator));
+            REQUIRE(std::stoi(text.substr(separator + 1)) == next[thread]);
+            ++next[thread];
+            ++received;
+        }
+    }
+    for (auto &thread : threads) {
+        thread.join();
+    }
+    REQUIRE(buffer.empty());
+}
@@ -53,12 +53,12 @@ TEST_CASE("Test if logs are dumped to a file without rotation")
     REQUIRE(countFiles(logsDir) == 0);
 
     // Dump logs.
-    LOG_ERROR(TestLog);
+    LOG_ERROR("%s", TestLog);
     Log::Logger::get().dumpToFile(testLogFile);
     REQUIRE(countFiles(logsDir) == 1);
     REQUIRE(checkIfLogFilesExist(testLogFile, 1));
 
-    LOG_ERROR(TestLog);
+    LOG_ERROR("%s", TestLog);
     Log::Logger::get().dumpToFile(testLogFile);
     REQUIRE(countFiles(logsDir) == 1);
     REQUIRE(checkIfLogFilesExist(testLogFile, 1));
@@ -87,27 +87,27 @@ TEST_CASE("Test if log files rotate")
 
     // Dump logs.
     // Dumping logs to a file causes a log rotation.
-    LOG_ERROR(TestLog);
+    LOG_ERROR("%s", TestLog);
     Log::Logger::get().dumpToFile(testLogFile);
     REQUIRE(countFiles(logsDir) == 1);
     REQUIRE(checkIfLogFilesExist(testLogFile, 1));
 
-    LOG_ERROR(TestLog);
+    LOG_ERROR("%s", TestLog);
     Log::Logger::get().dumpToFile(testLogFile);
     REQUIRE(countFiles(logsDir) == 2);
     REQUIRE(checkIfLogFilesExist(testLogFile, 2));
 
-    LOG_ERROR(TestLog);
+    LOG_ERROR("%s", TestLog);
     Log::Logger::get().dumpToFile(testLogFile);
     REQUIRE(countFiles(logsDir) == 3);
     REQUIRE(checkIfLogFilesExist(testLogFile, 3));
 
-    LOG_ERROR(TestLog);
+    LOG_ERROR("%s", TestLog);
     Log::Logger::get().dumpToFile(testLogFile);
     REQUIRE(countFiles(logsDir) == 3);
     REQUIRE(checkIfLogFilesExist(testLogFile, 3));
 
-    LOG_ERROR(TestLog);
+    LOG_ERROR("%s", TestLog);
     Log::Logger::get().dumpToFile(testLogFile);
     REQUIRE(countFiles(logsDir) == 3);
     REQUIRE(checkIfLogFilesExist(testLogFile, 3));
@@ -4,9 +4,26 @@
 #pragma once
 
 #include <purefs/fs/filesystem_operations.hpp>
+#include <cstdint>
 
 namespace purefs::fs::drivers
 {
+    /** Geometry of the littlefs volume passed as the mount data
+     * Sizes left zero are derived from the disk, read and program units default to the sector size
+     */
+    struct littlefs_params
+    {
+        //! Erase block size the volume was formatted with
+        std::uint32_t block_size;
+        //! Min read unit, multiple of the sector size
+        std::uint32_t read_size;
+        //! Min program unit, multiple of the sector size
+        std::uint32_t prog_size;
+        //! Size of the volume and per file caches, multiple of the read and program units
+        std::uint32_t cache_size;
+        //! Size of the allocator lookahead bitmap in bytes, multiple of 8
+        std::uint32_t lookahead_size;
+    };
 
     /** Filesystem specific driver for the littlefs */
     class filesystem_littlefs final : public filesystem_operations
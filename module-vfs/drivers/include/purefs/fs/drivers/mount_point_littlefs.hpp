@@ -4,6 +4,8 @@
 #include <purefs/fs/mount_point.hpp>
 #include <lfs.h>
 
+#include <atomic>
+
 namespace purefs::fs::drivers
 {
 
@@ -26,6 +28,24 @@ namespace purefs::fs::drivers
         {
             return &m_lfs_mount;
         }
+        //! Whether the volume was modified during its previous mount, as stored on the volume
+        [[nodiscard]] auto written_hint() const noexcept
+        {
+            return m_written_hint;
+        }
+        auto written_hint(bool hint) noexcept -> void
+        {
+            m_written_hint = hint;
+        }
+        //! Whether the volume has been modified since mount
+        [[nodiscard]] auto written() const noexcept
+        {
+            return m_written.load(std::memory_order_relaxed);
+        }
+        auto mark_written() noexcept -> void
+        {
+            m_written.store(true, std::memory_order_relaxed);
+        }
 
       private:
         auto native_root() const noexcept -> std::string override
@@ -35,5 +55,7 @@ namespace purefs::fs::drivers
         struct lfs_config m_lfs_conf
         {};
         lfs_t m_lfs_mount{};
+        bool m_written_hint{};
+        std::atomic<bool> m_written{};
     };
 } // namespace purefs::fs::drivers
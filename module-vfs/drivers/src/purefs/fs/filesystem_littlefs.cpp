@@ -25,6 +25,10 @@ namespace
 {
     // NOTE: lfs block size is configured during format
     static constexpr auto c_lfs_block_size = 32U * 1024U;
+    // Default size of the caches if not given in the mount params
+    static constexpr lfs_size_t c_lfs_cache_size = 4U * 1024U;
+    // Custom attribute of the root directory telling whether the volume was modified during its previous mount
+    static constexpr uint8_t c_lfs_written_attr = 0x70;
 
     template <typename T> auto lfs_to_errno(T error) -> T
     {
@@ -118,14 +122,15 @@ namespace
                                              size_t part_sectors_count,
                                              const void *data)
     {
+        purefs::fs::drivers::littlefs_params params{};
         if (data) {
-            // NOTE: block size from mount param
-            cfg->block_size = *(reinterpret_cast<const uint32_t *>(data));
+            params = *(reinterpret_cast<const purefs::fs::drivers::littlefs_params *>(data));
         }
-        else {
-            cfg->block_size = c_lfs_block_size;
+        if (params.block_size == 0) {
+            params.block_size = c_lfs_block_size;
             LOG_WARN("LFS: mount block size not specified using default value");
         }
+        cfg->block_size      = params.block_size;
         cfg->block_cycles    = 512;
         cfg->block_count     = 0; // Read later from super block
         const auto total_siz = uint64_t(sector_size) * uint64_t(part_sectors_count);
@@ -133,15 +138,83 @@ namespace
             LOG_ERROR("Block size doesn't match partition size");
             return -ERANGE;
         }
-        cfg->block_count    = total_siz / cfg->block_size - 1;
-        cfg->lookahead_size = std::min<lfs_size_t>(131072U, ((cfg->block_count >> 3U) + 1U) << 3U);
-        cfg->read_size      = cfg->block_size;
-        cfg->prog_size      = cfg->block_size;
-        cfg->cache_size     = cfg->block_size;
-        LOG_INFO("LFS: block count %u block size %u", unsigned(cfg->block_count), unsigned(cfg->block_size));
+        cfg->block_count = total_siz / cfg->block_size - 1;
+        cfg->read_size   = params.read_size ? params.read_size : sector_size;
+        cfg->prog_size   = params.prog_size ? params.prog_size : sector_size;
+        if (cfg->read_size % sector_size || cfg->prog_size % sector_size || cfg->block_size % cfg->read_size ||
+            cfg->block_size % cfg->prog_size) {
+            LOG_ERROR("LFS: read size %u or prog size %u doesn't match sector size %u and block size %u",
+                      unsigned(cfg->read_size),
+                      unsigned(cfg->prog_size),
+                      unsigned(sector_size),
+                      unsigned(cfg->block_size));
+            return -EINVAL;
+        }
+        if (params.cache_size) {
+            cfg->cache_size = params.cache_size;
+        }
+        else {
+            // Largest multiple of both units not over the default cache size, but at least a single unit
+            const auto unit = std::max(cfg->read_size, cfg->prog_size);
+            cfg->cache_size = std::max(unit, std::min(cfg->block_size, c_lfs_cache_size) / unit * unit);
+        }
+        if (cfg->cache_size % cfg->read_size || cfg->cache_size % cfg->prog_size ||
+            cfg->block_size % cfg->cache_size) {
+            LOG_ERROR("LFS: cache size %u doesn't match read, prog or block size", unsigned(cfg->cache_size));
+            return -EINVAL;
+        }
+        if (params.lookahead_size) {
+            cfg->lookahead_size = params.lookahead_size;
+        }
+        else {
+            cfg->lookahead_size = std::min<lfs_size_t>(131072U, ((cfg->block_count >> 3U) + 1U) << 3U);
+        }
+        if (cfg->lookahead_size % 8) {
+            LOG_ERROR("LFS: lookahead size %u isn't a multiple of 8", unsigned(cfg->lookahead_size));
+            return -EINVAL;
+        }
+        LOG_INFO("LFS: block count %u block size %u read size %u prog size %u cache size %u lookahead size %u",
+                 unsigned(cfg->block_count),
+                 unsigned(cfg->block_size),
+                 unsigned(cfg->read_size),
+                 unsigned(cfg->prog_size),
+                 unsigned(cfg->cache_size),
+                 unsigned(cfg->lookahead_size));
         return 0;
     }
 
+    // The lookahead buffer is empty after mount, so the first block allocation traverses the whole filesystem to
+    // find free blocks. Volumes modified during their previous mount are likely to be modified again, so their
+    // lookahead buffer is filled on mount instead, keeping the traversal off the first write.
+    auto read_written_hint(lfs_t *lfs) -> bool
+    {
+        uint8_t written{};
+        const auto ret = lfs_getattr(lfs, "/", c_lfs_written_attr, &written, sizeof written);
+        return ret == sizeof written && written != 0;
+    }
+
+    auto store_written_hint(lfs_t *lfs, bool written) -> void
+    {
+        const uint8_t attr = written ? 1 : 0;
+        const auto ret     = lfs_setattr(lfs, "/", c_lfs_written_attr, &attr, sizeof attr);
+        if (ret) {
+            LOG_WARN("LFS: unable to store the written hint %i", ret);
+        }
+    }
+
+    auto prewarm_allocator(lfs_t *lfs) -> void
+    {
+        // lfs_fs_gc fills the lookahead buffer since littlefs 2.8, older releases have no public call doing that
+#if defined(LFS_VERSION) && LFS_VERSION >= 0x00020008
+        const auto ret = lfs_fs_gc(lfs);
+        if (ret) {
+            LOG_WARN("LFS: unable to fill the lookahead buffer %i", ret);
+        }
+#else
+        static_cast<void>(lfs);
+#endif
+    }
+
 } // namespace
 
 namespace purefs::fs::drivers
@@ -209,6 +282,13 @@ namespace purefs::fs::drivers
             auto lerr              = lfs_fun(mntp->lfs_mount(), native_path.c_str(), std::forward<Args>(args)...);
             return lfs_to_errno(lerr);
         }
+
+        auto mark_written(filesystem_littlefs::fsmount fmnt) noexcept -> void
+        {
+            if (auto mntp = std::static_pointer_cast<mount_point_littlefs>(fmnt); mntp) {
+                mntp->mark_written();
+            }
+        }
     } // namespace
 
     auto filesystem_littlefs::mount_prealloc(std::shared_ptr<blkdev::internal::disk_handle> diskh,
@@ -258,6 +338,12 @@ namespace purefs::fs::drivers
             LOG_ERROR("LFS mount error %i", err);
         }
         if (!err) {
+            if (!(vmnt->flags() & mount_flags::read_only)) {
+                vmnt->written_hint(read_written_hint(vmnt->lfs_mount()));
+                if (vmnt->written_hint()) {
+                    prewarm_allocator(vmnt->lfs_mount());
+                }
+            }
             filesystem_operations::mount(mnt, data);
         }
         else {
@@ -273,6 +359,9 @@ namespace purefs::fs::drivers
             LOG_ERROR("Non LITTLEFS mount point");
             return -EIO;
         }
+        if (!(vmnt->flags() & mount_flags::read_only) && vmnt->written() != vmnt->written_hint()) {
+            store_written_hint(vmnt->lfs_mount(), vmnt->written());
+        }
         auto lerr = lfs_unmount(vmnt->lfs_mount());
         if (!lerr) {
             littlefs::internal::remove_volume(vmnt->lfs_config());
@@ -314,6 +403,9 @@ namespace purefs::fs::drivers
             LOG_ERROR("Non LITTLEFS mount point");
             return nullptr;
         }
+        if ((flags & O_ACCMODE) != O_RDONLY) {
+            vmnt->mark_written();
+        }
         const auto fspath = vmnt->native_path(path);
         const auto fsflag = translate_flags(flags);
         auto filep        = std::make_shared<file_handle_littlefs>(mnt, fspath, flags);
@@ -372,11 +464,13 @@ namespace purefs::fs::drivers
 
     auto filesystem_littlefs::unlink(fsmount mnt, std::string_view name) noexcept -> int
     {
+        mark_written(mnt);
         return invoke_lfs(mnt, name, ::lfs_remove);
     }
 
     auto filesystem_littlefs::rmdir(fsmount mnt, std::string_view name) noexcept -> int
     {
+        mark_written(mnt);
         return invoke_lfs(mnt, name, ::lfs_remove);
     }
 
@@ -387,6 +481,7 @@ namespace purefs::fs::drivers
             LOG_ERROR("Non LITTLEFS mount point");
             return -EBADF;
         }
+        mntp->mark_written();
         const auto native_old = mntp->native_path(oldname);
         const auto native_new = mntp->native_path(newname);
         auto lerr             = lfs_rename(mntp->lfs_mount(), native_old.c_str(), native_new.c_str());
@@ -411,6 +506,7 @@ namespace purefs::fs::drivers
 
     auto filesystem_littlefs::mkdir(fsmount mnt, std::string_view path, int mode) noexcept -> int
     {
+        mark_written(mnt);
         return invoke_lfs(mnt, path, ::lfs_mkdir);
     }
 
@@ -77,11 +77,11 @@ namespace purefs::fs::drivers::littlefs::internal
                 if (!diskmm) {
                     return LFS_ERR_IO;
                 }
-                const auto lba = (uint64_t(lfsc->block_size) * block) / ctx->sector_size;
                 if (off % ctx->sector_size) {
                     LOG_ERROR("Partial offset not supported");
                     return LFS_ERR_IO;
                 }
+                const auto lba           = (uint64_t(lfsc->block_size) * block + off) / ctx->sector_size;
                 const std::size_t lba_sz = size / ctx->sector_size;
                 if (size % ctx->sector_size) {
                     LOG_ERROR("Bounary read sz error");
@@ -105,13 +105,17 @@ namespace purefs::fs::drivers::littlefs::internal
                 if (!diskmm) {
                     return LFS_ERR_IO;
                 }
-                const auto lba = (uint64_t(lfsc->block_size) * block) / ctx->sector_size;
                 if (off % ctx->sector_size) {
                     LOG_ERROR("Partial offset not supported");
                     return LFS_ERR_IO;
                 }
+                const auto lba           = (uint64_t(lfsc->block_size) * block + off) / ctx->sector_size;
                 const std::size_t lba_sz = size / ctx->sector_size;
-                const auto err           = diskmm->write(ctx->disk_h, buffer, lba, lba_sz);
+                if (size % ctx->sector_size) {
+                    LOG_ERROR("Boundary write sz error");
+                    return LFS_ERR_IO;
+                }
+                const auto err = diskmm->write(ctx->disk_h, buffer, lba, lba_sz);
                 if (err) {
                     LOG_ERROR("Sector read error %i", err);
                 }
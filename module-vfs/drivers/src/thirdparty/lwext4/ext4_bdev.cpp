@@ -87,7 +87,21 @@ namespace purefs::fs::drivers::ext4::internal
 
             int close(struct ext4_blockdev *bdev)
             {
-                return 0;
+                auto ctx = reinterpret_cast<context *>(bdev->bdif->p_user);
+                if (!ctx) {
+                    return -EIO;
+                }
+                cpp_freertos::LockGuard _lck(ctx->mutex);
+                auto diskmm = ctx->disk.lock();
+                if (!diskmm) {
+                    return -EIO;
+                }
+                // Sectors left in the disk manager cache are written back, the library never syncs the device
+                const auto err = diskmm->sync(ctx->disk_h);
+                if (err) {
+                    LOG_ERROR("Unable to sync the device errno: %i", err);
+                }
+                return -err;
             }
 
         } // namespace io
@@ -0,0 +1,127 @@
+// Copyright (c) 2017-2021, Mudita Sp. z.o.o. All rights reserved.
+// For licensing, see https://github.com/mudita/MuditaOS/LICENSE.md
+
+#pragma once
+
+#include <purefs/blkdev/disk.hpp>
+
+#include <cstdint>
+#include <memory>
+#include <unordered_map>
+#include <vector>
+
+namespace cpp_freertos
+{
+    class MutexRecursive;
+    class MutexStandard;
+}
+
+namespace purefs::blkdev::internal
+{
+    /** Write-back sector cache placed by the disk manager between the filesystems and the disk driver.
+     * Sectors are kept in LRU order with dirty tracking, written sectors reach the disk on eviction, sync,
+     * cleanup or when the device leaves the active power state, in runs of consecutive sectors.
+     * Reads continuing the previous read are extended with read-ahead sectors.
+     * Requests larger than a quarter of the cache go straight to the disk, keeping the cached sectors coherent.
+     * Vectored requests serve the ranges cached whole from the cache and pass the others to the disk in one request.
+     * Asynchronous requests with no sector cached are passed to the disk, the others complete before the submit
+     * returns. Until the disk completes such a request, its sectors are not cached and requests touching them go
+     * straight to the disk, so that the cache holds neither data older than the request nor data the request would
+     * overwrite later.
+     */
+    class disk_cache final : public disk
+    {
+      public:
+        //! Default cache size in bytes
+        static constexpr std::size_t default_size = 128 * 1024;
+        //! Max sectors read ahead of a sequential read
+        static constexpr std::size_t read_ahead_sectors = 16;
+        //! Max sectors transferred to or from the disk in a single request
+        static constexpr std::size_t max_run_sectors = 32;
+
+        explicit disk_cache(std::shared_ptr<disk> disk, std::size_t cache_size = default_size);
+        disk_cache(const disk_cache &) = delete;
+        auto operator=(const disk_cache &) -> disk_cache & = delete;
+        ~disk_cache();
+
+        auto probe(unsigned flags) -> int override;
+        auto cleanup() -> int override;
+        auto write(const void *buf, sector_t lba, std::size_t count, hwpart_t hwpart) -> int override;
+        auto read(void *buf, sector_t lba, std::size_t count, hwpart_t hwpart) -> int override;
+        auto readv(const std::vector<io_vec> &vecs, hwpart_t hwpart) -> int override;
+        auto writev(const std::vector<io_vec> &vecs, hwpart_t hwpart) -> int override;
+        auto submit(io_request req) -> int override;
+        auto erase(sector_t lba, std::size_t count, hwpart_t hwpart) -> int override;
+        auto sync() -> int override;
+        auto pm_control(pm_state target_state) -> int override;
+        auto pm_read(pm_state &current_state) -> int override;
+        [[nodiscard]] auto status() const -> media_status override;
+        [[nodiscard]] auto get_info(info_type what, hwpart_t hwpart) const -> scount_t override;
+
+      private:
+        static constexpr auto npos = std::size_t(-1);
+        struct entry
+        {
+            sector_t lba{};
+            hwpart_t hwpart{};
+            bool dirty{};
+            std::size_t prev{};
+            std::size_t next{};
+        };
+        //! Sector range of an asynchronous request in progress on the disk
+        struct in_flight_range
+        {
+            std::uint32_t request{};
+            sector_t lba{};
+            std::size_t count{};
+            hwpart_t hwpart{};
+        };
+        static auto key(sector_t lba, hwpart_t hwpart) noexcept -> std::uint64_t
+        {
+            return (lba << 8) | hwpart;
+        }
+        auto sector_data(std::size_t idx) const noexcept -> std::uint8_t *
+        {
+            return m_data.get() + idx * m_sector_size;
+        }
+        auto find(sector_t lba, hwpart_t hwpart) const -> std::size_t;
+        auto is_dirty(sector_t lba, hwpart_t hwpart) const -> bool;
+        auto is_cached(const io_vec &vec, hwpart_t hwpart) const -> bool;
+        auto overlay_dirty(const io_vec &vec, hwpart_t hwpart) const -> void;
+        auto refresh_clean(const io_vec &vec, hwpart_t hwpart) -> void;
+        auto link_front(std::size_t idx) noexcept -> void;
+        auto unlink(std::size_t idx) noexcept -> void;
+        auto touch(std::size_t idx) noexcept -> void;
+        auto release(std::size_t idx) -> void;
+        auto reserve(std::size_t count) -> int;
+        auto insert(sector_t lba, hwpart_t hwpart) -> std::size_t;
+        auto write_back(std::size_t idx) -> int;
+        auto write_run(sector_t lba, std::size_t count, hwpart_t hwpart) -> int;
+        auto flush() -> int;
+        auto read_run(std::uint8_t *buf, sector_t lba, std::size_t count, sector_t req_end, hwpart_t hwpart) -> int;
+        auto fetch_count(sector_t lba, std::size_t misses, bool sequential, hwpart_t hwpart) const -> std::size_t;
+        auto is_in_flight(sector_t lba, std::size_t count, hwpart_t hwpart) const -> bool;
+        auto start_in_flight(const io_request &req) -> std::uint32_t;
+        auto end_in_flight(std::uint32_t request) -> void;
+
+      private:
+        const std::shared_ptr<disk> m_disk;
+        const std::size_t m_cache_size;
+        std::size_t m_sector_size{};
+        std::size_t m_capacity{};
+        std::size_t m_max_run{};
+        std::unique_ptr<std::uint8_t[]> m_data;
+        std::unique_ptr<std::uint8_t[]> m_scratch;
+        //! Cached sectors, followed by the sentinel of the LRU list, most recent first
+        std::vector<entry> m_entries;
+        std::vector<std::size_t> m_free;
+        std::unordered_map<std::uint64_t, std::size_t> m_index;
+        sector_t m_last_read_end{};
+        hwpart_t m_last_read_hwpart{};
+        std::unique_ptr<cpp_freertos::MutexRecursive> m_lock;
+        std::vector<in_flight_range> m_in_flight;
+        std::uint32_t m_last_request{};
+        //! Guards the requests in progress alone, as the disk may complete them while the cache lock is held
+        std::unique_ptr<cpp_freertos::MutexStandard> m_in_flight_lock;
+    };
+} // namespace purefs::blkdev::internal
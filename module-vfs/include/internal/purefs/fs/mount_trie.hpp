@@ -0,0 +1,45 @@
+// Copyright (c) 2017-2021, Mudita Sp. z.o.o. All rights reserved.
+// For licensing, see https://github.com/mudita/MuditaOS/LICENSE.md
+
+#pragma once
+
+#include <map>
+#include <memory>
+#include <string>
+#include <tuple>
+#include <vector>
+
+namespace purefs::fs::internal
+{
+    class mount_point;
+
+    /** Prefix tree of the mount points indexed by the path components
+     * It is immutable, a new one is built on each mount and umount, so lookups don't need locking
+     */
+    class mount_trie
+    {
+      public:
+        using mount_map = std::map<std::string, std::shared_ptr<mount_point>>;
+
+        mount_trie() = default;
+        explicit mount_trie(const mount_map &mounts);
+        mount_trie(const mount_trie &) = delete;
+        auto operator=(const mount_trie &) -> mount_trie & = delete;
+
+        /** Find the mount point containing the path
+         * @param[in] path Absolute normalized path
+         * @return mount point object and its path length or nullptr when no mount point contains the path
+         */
+        auto find(std::string_view path) const noexcept -> std::tuple<std::shared_ptr<mount_point>, size_t>;
+
+      private:
+        struct node
+        {
+            std::string name;                   //! Path component
+            std::shared_ptr<mount_point> mount; //! Mount point ending at the node if any
+            std::size_t path_len{};             //! Mount point path length
+            std::vector<node> children;
+        };
+        node m_root;
+    };
+} // namespace purefs::fs::internal
@@ -3,7 +3,9 @@
 
 #pragma once
 #include <cstdint>
+#include <functional>
 #include <memory>
+#include <vector>
 
 namespace purefs::blkdev
 {
@@ -50,12 +52,40 @@ namespace purefs::blkdev
         power_off      //! Device is in poweroff state
     };
 
+    //! Scatter-gather element, consecutive sectors transferred to or from the buffer
+    struct io_vec
+    {
+        sector_t lba;      //! First sector
+        std::size_t count; //! Sectors count
+        void *buf;         //! Data buffer, only read from when writing
+    };
+
+    //! Block I/O operation
+    enum class io_op
+    {
+        read, //! Read sectors into the buffers
+        write //! Write sectors from the buffers
+    };
+
+    //! Completion of an asynchronous request, called with zero on success otherwise error
+    using io_completion = std::function<void(int)>;
+
+    //! Asynchronous block I/O request
+    struct io_request
+    {
+        io_op op;                  //! Operation
+        std::vector<io_vec> vecs;  //! Sector ranges with buffers
+        hwpart_t hwpart;           //! Hardware partition
+        io_completion on_complete; //! Called once the whole request is done
+    };
+
     //! Disk manager flags
     struct flags
     {
         enum _flags
         {
-            no_parts_scan = 0x1 //! Don't scan partitions on disc
+            no_parts_scan   = 0x1, //! Don't scan partitions on disc
+            no_sector_cache = 0x2  //! Don't put the sector cache between the disc and the filesystems
         };
     };
 } // namespace purefs::blkdev
@@ -45,6 +45,29 @@ namespace purefs::blkdev
          */
         virtual auto read(void *buf, sector_t lba, std::size_t count, hwpart_t hwpart) -> int = 0;
 
+        /** Read scattered sector ranges from block device or partition
+         * @param[in] vecs Sector ranges with buffers for read
+         * @param[in] hwpart Hardware partition
+         * @return zero on success otherwise error
+         * @note Default implementation reads the ranges one by one
+         */
+        virtual auto readv(const std::vector<io_vec> &vecs, hwpart_t hwpart) -> int;
+
+        /** Write scattered sector ranges onto block device or partition
+         * @param[in] vecs Sector ranges with data buffers to write
+         * @param[in] hwpart Hardware partition
+         * @return zero on success otherwise error
+         * @note Default implementation writes the ranges one by one
+         */
+        virtual auto writev(const std::vector<io_vec> &vecs, hwpart_t hwpart) -> int;
+
+        /** Submit the asynchronous request
+         * @param[in] req Request to execute, its completion is called once the request is done
+         * @return zero if the request is accepted otherwise error, completion is not called then
+         * @note Default implementation executes the request synchronously and calls the completion before return
+         */
+        virtual auto submit(io_request req) -> int;
+
         /** Erase selected area on the block device or partition
          * @param[in] lba First sector to erase
          * @param[in] count Sectors count for erase
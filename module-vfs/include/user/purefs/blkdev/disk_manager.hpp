@@ -60,6 +60,30 @@ namespace purefs::blkdev
 
         auto read(disk_fd dfd, void *buf, sector_t lba, std::size_t count) -> int;
         auto read(std::string_view device_name, void *buf, sector_t lba, std::size_t count) -> int;
+        /** Read scattered sector ranges from block device or partition
+         * @param[in] dfd Disk manager fd
+         * @param[in] vecs Sector ranges with buffers for read
+         * @return zero on success otherwise error
+         */
+        auto readv(disk_fd dfd, std::vector<io_vec> vecs) -> int;
+        auto readv(std::string_view device_name, std::vector<io_vec> vecs) -> int;
+        /** Write scattered sector ranges onto block device or partition
+         * @param[in] dfd Disk manager fd
+         * @param[in] vecs Sector ranges with data buffers to write
+         * @return zero on success otherwise error
+         */
+        auto writev(disk_fd dfd, std::vector<io_vec> vecs) -> int;
+        auto writev(std::string_view device_name, std::vector<io_vec> vecs) -> int;
+        /** Submit the asynchronous request to block device or partition
+         * @param[in] dfd Disk manager fd
+         * @param[in] op Read or write operation
+         * @param[in] vecs Sector ranges with buffers, which have to be valid until the completion
+         * @param[in] on_complete Completion called with the request result, possibly before return
+         * @return zero if the request is accepted otherwise error, completion is not called then
+         */
+        auto submit(disk_fd dfd, io_op op, std::vector<io_vec> vecs, io_completion on_complete) -> int;
+        auto submit(std::string_view device_name, io_op op, std::vector<io_vec> vecs, io_completion on_complete)
+            -> int;
         /** Erase selected area on the block device or partition
          * @param[in] dfd Disk manager fd
          * @param[in] lba First sector to erase
@@ -147,6 +171,7 @@ namespace purefs::blkdev
       private:
         static auto parse_device_name(std::string_view device) -> std::tuple<std::string_view, part_t>;
         static auto part_lba_to_disk_lba(disk_fd disk, sector_t part_lba, size_t count) -> scount_t;
+        static auto part_vecs_to_disk_vecs(disk_fd disk, std::vector<io_vec> &vecs) -> int;
 
       private:
         std::unordered_map<std::string, std::shared_ptr<disk>> m_dev_map;
@@ -6,6 +6,11 @@
 #include <memory>
 #include <string>
 
+namespace cpp_freertos
+{
+    class MutexRecursive;
+}
+
 namespace purefs::fs::internal
 {
     class mount_point;
@@ -15,9 +20,8 @@ namespace purefs::fs::internal
       public:
         file_handle(const file_handle &) = delete;
         auto operator=(const file_handle &) = delete;
-        virtual ~file_handle()              = default;
-        file_handle(std::shared_ptr<mount_point> mp, unsigned flags) : m_mount_point(mp), m_flags(flags)
-        {}
+        virtual ~file_handle();
+        file_handle(std::shared_ptr<mount_point> mp, unsigned flags);
         [[nodiscard]] auto error() const noexcept
         {
             return m_error;
@@ -38,10 +42,45 @@ namespace purefs::fs::internal
         {
             return {};
         }
+        /** Operations on the same file are serialized by the file lock
+         * @note Called by the VFS core around the filesystem operations
+         */
+        auto lock() const noexcept -> void;
+        auto unlock() const noexcept -> void;
+        //! File closed while an operation was waiting for the lock
+        [[nodiscard]] auto is_closed() const noexcept
+        {
+            return m_closed;
+        }
+        auto mark_closed() noexcept -> void
+        {
+            m_closed = true;
+        }
 
       private:
         const std::weak_ptr<mount_point> m_mount_point;
         int m_error{};
         const unsigned m_flags{};
+        bool m_closed{};
+        const std::unique_ptr<cpp_freertos::MutexRecursive> m_lock;
+    };
+
+    //! File handle locked for the scope
+    class file_locker
+    {
+      public:
+        explicit file_locker(const file_handle &file) : m_file(file)
+        {
+            m_file.lock();
+        }
+        ~file_locker()
+        {
+            m_file.unlock();
+        }
+        file_locker(const file_locker &) = delete;
+        auto operator=(const file_locker &) = delete;
+
+      private:
+        const file_handle &m_file;
     };
 } // namespace purefs::fs::internal
@@ -4,6 +4,8 @@
 #pragma once
 #include <string>
 #include <memory>
+#include <atomic>
+#include <vector>
 #include <list>
 #include <array>
 #include <map>
@@ -36,6 +38,11 @@ namespace sys
     class Service;
 }
 
+namespace purefs::fs::internal
+{
+    class mount_trie;
+}
+
 namespace purefs::fs
 {
     /** This is the filesystem class layer
@@ -174,10 +181,19 @@ namespace purefs::fs
          * @param[out] Normalized path
          */
         static auto normalize_path(std::string_view path) noexcept -> std::string;
+        /** Normalize full path in place
+         * @param[in,out] path Unnormalized full path replaced by the normalized one
+         * @note Canonical absolute path is left untouched after a single scan
+         */
+        static auto normalize_path_in_place(std::string &path) noexcept -> void;
+        /** Publish the mount points lookup tree built from the mount points map
+         * @note Called with the filesystem lock held after each change of the mount points
+         */
+        auto publish_mount_points() -> void;
         /** Add handle to file descriptor
          */
         auto add_filehandle(fsfile file) noexcept -> int;
-        auto remove_filehandle(int fds) noexcept -> fsfile;
+        auto remove_filehandle(int fds, const fsfile &file) noexcept -> bool;
         auto find_filehandle(int fds) const noexcept -> fsfile;
         auto autodetect_filesystem_type(std::string_view dev_or_part) const noexcept -> std::string;
 
@@ -195,6 +211,10 @@ namespace purefs::fs
                 return -EBADF;
             }
             else {
+                internal::file_locker _lck(*fil);
+                if (fil->is_closed()) {
+                    return -EBADF;
+                }
                 auto mp = fil->mntpoint();
                 if (!mp) {
                     return -ENOENT;
@@ -282,14 +302,26 @@ namespace purefs::fs
                 }
             }
         }
+        /** Close the file if the descriptor still refers to it
+         * @note Descriptor closed concurrently and reused for another file is left untouched
+         */
+        auto close_handle(fsfile fil, int fd) noexcept -> int;
         auto cleanup_opened_files(std::string_view mount_point) -> void;
 
       private:
         std::weak_ptr<blkdev::disk_manager> m_diskmm;
         std::unordered_map<std::string, std::shared_ptr<filesystem_operations>> m_fstypes;
         std::map<std::string, std::shared_ptr<internal::mount_point>> m_mounts;
+        //! Mount points lookup tree read without locking
+        std::atomic<const internal::mount_trie *> m_mount_trie{};
+        //! Number of lookups in progress, the replaced trees are freed when there are none
+        mutable std::atomic<unsigned> m_mount_trie_readers{};
+        std::unique_ptr<const internal::mount_trie> m_mount_trie_owner;
+        std::vector<std::unique_ptr<const internal::mount_trie>> m_mount_trie_retired;
         std::unordered_set<std::string> m_partitions;
+        //! Opened files table, safe for concurrent use
         internal::handle_mapper<fsfile> m_fds;
+        //! Serializes filesystem registration, mount and umount only
         std::unique_ptr<cpp_freertos::MutexRecursive> m_lock;
         std::shared_ptr<internal::notifier> m_notifier;
     };
@@ -3,45 +3,112 @@
 
 #pragma once
 
+#include <memory>
 #include <vector>
+
+namespace cpp_freertos
+{
+    class MutexStandard;
+}
+
 namespace purefs::fs::internal
 {
+    //! Lock of the handle mapper table
+    class handle_mapper_lock
+    {
+      public:
+        handle_mapper_lock();
+        ~handle_mapper_lock();
+        handle_mapper_lock(const handle_mapper_lock &) = delete;
+        auto operator=(const handle_mapper_lock &) = delete;
+        auto lock() const noexcept -> void;
+        auto unlock() const noexcept -> void;
 
+      private:
+        std::unique_ptr<cpp_freertos::MutexStandard> m_lock;
+    };
+
+    /** Table of handles indexed by numbers reused after removal
+     * All the operations are serialized by the table lock, which is held only for the table access,
+     * so the handles are returned by value
+     */
     template <typename T> class handle_mapper
     {
+        class guard
+        {
+          public:
+            explicit guard(const handle_mapper_lock &lock) : m_lock(lock)
+            {
+                m_lock.lock();
+            }
+            ~guard()
+            {
+                m_lock.unlock();
+            }
+            guard(const guard &) = delete;
+            auto operator=(const guard &) = delete;
+
+          private:
+            const handle_mapper_lock &m_lock;
+        };
+
       public:
-        T const &operator[](std::size_t index) const
+        T operator[](std::size_t index) const
         {
+            guard _lck(lock);
             return data[index];
         }
-        T &operator[](std::size_t index)
+        //! Handle under the index or empty one if there is none
+        T find(std::size_t index) const
         {
-            return data[index];
+            guard _lck(lock);
+            return (index < data.size()) ? data[index] : T{};
         }
-        void remove(std::size_t index)
+        //! Remove the handle under the index
+        //! @return handle removed or empty one if there was none
+        T remove(std::size_t index)
         {
+            guard _lck(lock);
+            if (index >= data.size() || data[index] == T{}) {
+                return {};
+            }
+            T ret = std::move(data[index]);
+            data[index] = {};
             unused.push_back(index);
+            return ret;
+        }
+        //! Remove the handle under the index only if it is still the one given
+        //! @return true if the handle was removed
+        bool remove(std::size_t index, const T &value)
+        {
+            guard _lck(lock);
+            if (index >= data.size() || value == T{} || data[index] != value) {
+                return false;
+            }
             data[index] = {};
+            unused.push_back(index);
+            return true;
         }
         bool exists(std::size_t index) const
         {
+            guard _lck(lock);
             return index < data.size();
         }
         std::size_t insert(T const &value);
-        auto begin() const
-        {
-            return data.begin();
-        }
-        auto end() const
+        //! Copy of the handles stored, to be iterated without holding the lock
+        auto snapshot() const -> std::vector<T>
         {
-            return data.end();
+            guard _lck(lock);
+            return data;
         }
         auto size() const
         {
+            guard _lck(lock);
             return data.size();
         }
         auto clear() -> void
         {
+            guard _lck(lock);
             data.clear();
             unused.clear();
         }
@@ -50,10 +117,12 @@ namespace purefs::fs::internal
       private:
         std::vector<T> data;
         std::vector<std::size_t> unused;
+        handle_mapper_lock lock;
     };
 
     template <typename T> std::size_t handle_mapper<T>::insert(T const &value)
     {
+        guard _lck(lock);
         if (unused.empty()) {
             data.push_back(value);
             return data.size() - 1;
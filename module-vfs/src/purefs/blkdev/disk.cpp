@@ -6,6 +6,34 @@
 
 namespace purefs::blkdev
 {
+    auto disk::readv(const std::vector<io_vec> &vecs, hwpart_t hwpart) -> int
+    {
+        for (const auto &vec : vecs) {
+            const auto err = read(vec.buf, vec.lba, vec.count, hwpart);
+            if (err) {
+                return err;
+            }
+        }
+        return 0;
+    }
+    auto disk::writev(const std::vector<io_vec> &vecs, hwpart_t hwpart) -> int
+    {
+        for (const auto &vec : vecs) {
+            const auto err = write(vec.buf, vec.lba, vec.count, hwpart);
+            if (err) {
+                return err;
+            }
+        }
+        return 0;
+    }
+    auto disk::submit(io_request req) -> int
+    {
+        const auto err = (req.op == io_op::read) ? readv(req.vecs, req.hwpart) : writev(req.vecs, req.hwpart);
+        if (req.on_complete) {
+            req.on_complete(err);
+        }
+        return 0;
+    }
     auto disk::erase(sector_t lba, std::size_t count, hwpart_t hwpart) -> int
     {
         return -ENOTSUP;
@@ -0,0 +1,550 @@
+// Copyright (c) 2017-2021, Mudita Sp. z.o.o. All rights reserved.
+// For licensing, see https://github.com/mudita/MuditaOS/LICENSE.md
+
+#include <purefs/blkdev/disk_cache.hpp>
+#include <log/log.hpp>
+#include <mutex.hpp>
+#include <errno.h>
+#include <algorithm>
+#include <cstring>
+
+namespace purefs::blkdev::internal
+{
+    disk_cache::disk_cache(std::shared_ptr<disk> disk, std::size_t cache_size)
+        : m_disk(std::move(disk)), m_cache_size(cache_size), m_lock(std::make_unique<cpp_freertos::MutexRecursive>()),
+          m_in_flight_lock(std::make_unique<cpp_freertos::MutexStandard>())
+    {}
+
+    disk_cache::~disk_cache()
+    {
+        const auto err = flush();
+        if (err) {
+            LOG_ERROR("Unable to write back the sector cache errno: %i", err);
+        }
+    }
+
+    auto disk_cache::probe(unsigned flags) -> int
+    {
+        auto err = m_disk->probe(flags);
+        if (err < 0) {
+            return err;
+        }
+        const auto sector_size = m_disk->get_info(info_type::sector_size, default_hw_partition);
+        if (sector_size <= 0) {
+            LOG_ERROR("Unable to get sector size, sector cache disabled");
+            return err;
+        }
+        cpp_freertos::LockGuard _lck(*m_lock);
+        m_sector_size = sector_size;
+        m_capacity    = std::max<std::size_t>(m_cache_size / m_sector_size, 1);
+        m_max_run     = std::min(max_run_sectors, m_capacity);
+        m_data        = std::make_unique<std::uint8_t[]>(m_capacity * m_sector_size);
+        m_scratch     = std::make_unique<std::uint8_t[]>(m_max_run * m_sector_size);
+        m_entries.assign(m_capacity + 1, {});
+        m_entries[m_capacity].prev = m_capacity;
+        m_entries[m_capacity].next = m_capacity;
+        m_free.clear();
+        for (std::size_t idx = m_capacity; idx > 0; --idx) {
+            m_free.push_back(idx - 1);
+        }
+        m_index.clear();
+        m_index.reserve(m_capacity);
+        return err;
+    }
+
+    auto disk_cache::cleanup() -> int
+    {
+        cpp_freertos::LockGuard _lck(*m_lock);
+        const auto err = flush();
+        if (err) {
+            LOG_ERROR("Unable to write back the sector cache errno: %i", err);
+        }
+        for (auto &[key, idx] : m_index) {
+            m_entries[idx] = {};
+            m_free.push_back(idx);
+        }
+        m_index.clear();
+        if (m_capacity) {
+            m_entries[m_capacity].prev = m_capacity;
+            m_entries[m_capacity].next = m_capacity;
+        }
+        const auto ret = m_disk->cleanup();
+        return err ? err : ret;
+    }
+
+    auto disk_cache::write(const void *buf, sector_t lba, std::size_t count, hwpart_t hwpart) -> int
+    {
+        cpp_freertos::LockGuard _lck(*m_lock);
+        if (!m_capacity) {
+            return m_disk->write(buf, lba, count, hwpart);
+        }
+        auto src = reinterpret_cast<const std::uint8_t *>(buf);
+        if (count > m_capacity / 4 || is_in_flight(lba, count, hwpart)) {
+            // Large write or one racing an asynchronous request goes to the disk, the copies of the sectors cached
+            // are refreshed
+            const auto err = m_disk->write(buf, lba, count, hwpart);
+            if (err) {
+                return err;
+            }
+            refresh_clean({lba, count, const_cast<void *>(buf)}, hwpart);
+            return 0;
+        }
+        for (std::size_t sect = 0; sect < count; ++sect) {
+            auto idx = find(lba + sect, hwpart);
+            if (idx == npos) {
+                const auto err = reserve(1);
+                if (err) {
+                    return err;
+                }
+                idx = insert(lba + sect, hwpart);
+            }
+            else {
+                touch(idx);
+            }
+            std::memcpy(sector_data(idx), src + sect * m_sector_size, m_sector_size);
+            m_entries[idx].dirty = true;
+        }
+        return 0;
+    }
+
+    auto disk_cache::read(void *buf, sector_t lba, std::size_t count, hwpart_t hwpart) -> int
+    {
+        cpp_freertos::LockGuard _lck(*m_lock);
+        if (!m_capacity) {
+            return m_disk->read(buf, lba, count, hwpart);
+        }
+        auto dst = reinterpret_cast<std::uint8_t *>(buf);
+        if (count > m_capacity / 4 || is_in_flight(lba, count, hwpart)) {
+            // Large read or one racing an asynchronous request comes from the disk, with the sectors not written
+            // back yet put over
+            const auto err = m_disk->read(buf, lba, count, hwpart);
+            if (err) {
+                return err;
+            }
+            overlay_dirty({lba, count, buf}, hwpart);
+            return 0;
+        }
+        const auto sequential = hwpart == m_last_read_hwpart && lba == m_last_read_end && lba != 0;
+        m_last_read_hwpart    = hwpart;
+        m_last_read_end       = lba + count;
+        const auto req_end    = lba + count;
+        for (auto sect = lba; sect < req_end;) {
+            const auto idx = find(sect, hwpart);
+            if (idx != npos) {
+                std::memcpy(dst + (sect - lba) * m_sector_size, sector_data(idx), m_sector_size);
+                touch(idx);
+                ++sect;
+                continue;
+            }
+            std::size_t misses = 1;
+            while (sect + misses < req_end && misses < m_max_run && find(sect + misses, hwpart) == npos) {
+                ++misses;
+            }
+            const auto fetch = fetch_count(sect, misses, sequential && sect + misses == req_end, hwpart);
+            const auto err   = read_run(dst + (sect - lba) * m_sector_size, sect, fetch, req_end, hwpart);
+            if (err) {
+                return err;
+            }
+            sect += misses;
+        }
+        return 0;
+    }
+
+    auto disk_cache::readv(const std::vector<io_vec> &vecs, hwpart_t hwpart) -> int
+    {
+        cpp_freertos::LockGuard _lck(*m_lock);
+        if (!m_capacity) {
+            return m_disk->readv(vecs, hwpart);
+        }
+        // Ranges found whole in the cache are copied, the others are read from the disk in a single request
+        std::vector<io_vec> direct;
+        for (const auto &vec : vecs) {
+            if (vec.count > m_capacity / 4 || !is_cached(vec, hwpart)) {
+                direct.push_back(vec);
+            }
+        }
+        if (!direct.empty()) {
+            const auto err = m_disk->readv(direct, hwpart);
+            if (err) {
+                return err;
+            }
+            for (const auto &vec : direct) {
+                overlay_dirty(vec, hwpart);
+            }
+        }
+        for (const auto &vec : vecs) {
+            if (vec.count > m_capacity / 4 || !is_cached(vec, hwpart)) {
+                continue;
+            }
+            auto dst = reinterpret_cast<std::uint8_t *>(vec.buf);
+            for (std::size_t sect = 0; sect < vec.count; ++sect) {
+                const auto idx = find(vec.lba + sect, hwpart);
+                std::memcpy(dst + sect * m_sector_size, sector_data(idx), m_sector_size);
+                touch(idx);
+            }
+        }
+        return 0;
+    }
+
+    auto disk_cache::writev(const std::vector<io_vec> &vecs, hwpart_t hwpart) -> int
+    {
+        cpp_freertos::LockGuard _lck(*m_lock);
+        if (!m_capacity) {
+            return m_disk->writev(vecs, hwpart);
+        }
+        // Ranges found whole in the cache are written back later, the others go to the disk in a single request
+        std::vector<io_vec> direct;
+        for (const auto &vec : vecs) {
+            if (vec.count > m_capacity / 4 || !is_cached(vec, hwpart)) {
+                direct.push_back(vec);
+            }
+        }
+        if (!direct.empty()) {
+            const auto err = m_disk->writev(direct, hwpart);
+            if (err) {
+                return err;
+            }
+            for (const auto &vec : direct) {
+                refresh_clean(vec, hwpart);
+            }
+        }
+        for (const auto &vec : vecs) {
+            if (vec.count > m_capacity / 4 || !is_cached(vec, hwpart)) {
+                continue;
+            }
+            auto src = reinterpret_cast<const std::uint8_t *>(vec.buf);
+            for (std::size_t sect = 0; sect < vec.count; ++sect) {
+                const auto idx = find(vec.lba + sect, hwpart);
+                std::memcpy(sector_data(idx), src + sect * m_sector_size, m_sector_size);
+                m_entries[idx].dirty = true;
+                touch(idx);
+            }
+        }
+        return 0;
+    }
+
+    auto disk_cache::submit(io_request req) -> int
+    {
+        cpp_freertos::LockGuard _lck(*m_lock);
+        if (!m_capacity) {
+            return m_disk->submit(std::move(req));
+        }
+        // Requests with no sector in the cache are left to the disk, the others are served synchronously
+        const auto cached = std::any_of(std::begin(req.vecs), std::end(req.vecs), [this, &req](const auto &vec) {
+            for (std::size_t sect = 0; sect < vec.count; ++sect) {
+                if (find(vec.lba + sect, req.hwpart) != npos) {
+                    return true;
+                }
+            }
+            return false;
+        });
+        if (!cached) {
+            const auto request = start_in_flight(req);
+            req.on_complete    = [this, request, on_complete = std::move(req.on_complete)](int err) {
+                end_in_flight(request);
+                if (on_complete) {
+                    on_complete(err);
+                }
+            };
+            const auto err = m_disk->submit(std::move(req));
+            if (err) {
+                end_in_flight(request);
+            }
+            return err;
+        }
+        return disk::submit(std::move(req));
+    }
+
+    auto disk_cache::erase(sector_t lba, std::size_t count, hwpart_t hwpart) -> int
+    {
+        cpp_freertos::LockGuard _lck(*m_lock);
+        const auto err = m_disk->erase(lba, count, hwpart);
+        if (err) {
+            return err;
+        }
+        std::vector<std::size_t> erased;
+        for (const auto &[key, idx] : m_index) {
+            const auto &ent = m_entries[idx];
+            if (ent.hwpart == hwpart && ent.lba >= lba && ent.lba < lba + count) {
+                erased.push_back(idx);
+            }
+        }
+        for (const auto idx : erased) {
+            release(idx);
+        }
+        return 0;
+    }
+
+    auto disk_cache::sync() -> int
+    {
+        cpp_freertos::LockGuard _lck(*m_lock);
+        const auto err = flush();
+        if (err) {
+            return err;
+        }
+        return m_disk->sync();
+    }
+
+    auto disk_cache::pm_control(pm_state target_state) -> int
+    {
+        cpp_freertos::LockGuard _lck(*m_lock);
+        if (target_state != pm_state::active) {
+            const auto err = flush();
+            if (err) {
+                LOG_ERROR("Unable to write back the sector cache errno: %i", err);
+                return err;
+            }
+        }
+        return m_disk->pm_control(target_state);
+    }
+
+    auto disk_cache::pm_read(pm_state &current_state) -> int
+    {
+        return m_disk->pm_read(current_state);
+    }
+
+    auto disk_cache::status() const -> media_status
+    {
+        return m_disk->status();
+    }
+
+    auto disk_cache::get_info(info_type what, hwpart_t hwpart) const -> scount_t
+    {
+        return m_disk->get_info(what, hwpart);
+    }
+
+    auto disk_cache::find(sector_t lba, hwpart_t hwpart) const -> std::size_t
+    {
+        const auto it = m_index.find(key(lba, hwpart));
+        return (it != std::end(m_index)) ? it->second : npos;
+    }
+
+    auto disk_cache::is_dirty(sector_t lba, hwpart_t hwpart) const -> bool
+    {
+        const auto idx = find(lba, hwpart);
+        return idx != npos && m_entries[idx].dirty;
+    }
+
+    auto disk_cache::is_cached(const io_vec &vec, hwpart_t hwpart) const -> bool
+    {
+        for (std::size_t sect = 0; sect < vec.count; ++sect) {
+            if (find(vec.lba + sect, hwpart) == npos) {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    auto disk_cache::overlay_dirty(const io_vec &vec, hwpart_t hwpart) const -> void
+    {
+        auto dst = reinterpret_cast<std::uint8_t *>(vec.buf);
+        for (const auto &[key, idx] : m_index) {
+            const auto &ent = m_entries[idx];
+            if (ent.dirty && ent.hwpart == hwpart && ent.lba >= vec.lba && ent.lba < vec.lba + vec.count) {
+                std::memcpy(dst + (ent.lba - vec.lba) * m_sector_size, sector_data(idx), m_sector_size);
+            }
+        }
+    }
+
+    auto disk_cache::refresh_clean(const io_vec &vec, hwpart_t hwpart) -> void
+    {
+        auto src = reinterpret_cast<const std::uint8_t *>(vec.buf);
+        for (const auto &[key, idx] : m_index) {
+            auto &ent = m_entries[idx];
+            if (ent.hwpart == hwpart && ent.lba >= vec.lba && ent.lba < vec.lba + vec.count) {
+                std::memcpy(sector_data(idx), src + (ent.lba - vec.lba) * m_sector_size, m_sector_size);
+                ent.dirty = false;
+            }
+        }
+    }
+
+    auto disk_cache::link_front(std::size_t idx) noexcept -> void
+    {
+        auto &head                = m_entries[m_capacity];
+        m_entries[idx].prev       = m_capacity;
+        m_entries[idx].next       = head.next;
+        m_entries[head.next].prev = idx;
+        head.next                 = idx;
+    }
+
+    auto disk_cache::unlink(std::size_t idx) noexcept -> void
+    {
+        auto &ent                = m_entries[idx];
+        m_entries[ent.prev].next = ent.next;
+        m_entries[ent.next].prev = ent.prev;
+    }
+
+    auto disk_cache::touch(std::size_t idx) noexcept -> void
+    {
+        unlink(idx);
+        link_front(idx);
+    }
+
+    auto disk_cache::release(std::size_t idx) -> void
+    {
+        unlink(idx);
+        m_index.erase(key(m_entries[idx].lba, m_entries[idx].hwpart));
+        m_entries[idx] = {};
+        m_free.push_back(idx);
+    }
+
+    auto disk_cache::reserve(std::size_t count) -> int
+    {
+        while (m_free.size() < count) {
+            const auto victim = m_entries[m_capacity].prev;
+            if (m_entries[victim].dirty) {
+                const auto err = write_back(victim);
+                if (err) {
+                    return err;
+                }
+            }
+            release(victim);
+        }
+        return 0;
+    }
+
+    auto disk_cache::insert(sector_t lba, hwpart_t hwpart) -> std::size_t
+    {
+        const auto idx = m_free.back();
+        m_free.pop_back();
+        auto &ent  = m_entries[idx];
+        ent.lba    = lba;
+        ent.hwpart = hwpart;
+        ent.dirty  = false;
+        link_front(idx);
+        m_index.emplace(key(lba, hwpart), idx);
+        return idx;
+    }
+
+    auto disk_cache::write_back(std::size_t idx) -> int
+    {
+        // Written together with the dirty sectors around it
+        const auto hwpart = m_entries[idx].hwpart;
+        auto first        = m_entries[idx].lba;
+        auto last         = first;
+        while (first > 0 && last - first + 1 < m_max_run && is_dirty(first - 1, hwpart)) {
+            --first;
+        }
+        while (last - first + 1 < m_max_run && is_dirty(last + 1, hwpart)) {
+            ++last;
+        }
+        return write_run(first, last - first + 1, hwpart);
+    }
+
+    auto disk_cache::write_run(sector_t lba, std::size_t count, hwpart_t hwpart) -> int
+    {
+        for (std::size_t sect = 0; sect < count; ++sect) {
+            std::memcpy(m_scratch.get() + sect * m_sector_size, sector_data(find(lba + sect, hwpart)), m_sector_size);
+        }
+        const auto err = m_disk->write(m_scratch.get(), lba, count, hwpart);
+        if (err) {
+            LOG_ERROR("Sector cache write back error errno: %i on block: %u cnt: %u",
+                      err,
+                      unsigned(lba),
+                      unsigned(count));
+            return err;
+        }
+        for (std::size_t sect = 0; sect < count; ++sect) {
+            m_entries[find(lba + sect, hwpart)].dirty = false;
+        }
+        return 0;
+    }
+
+    auto disk_cache::flush() -> int
+    {
+        std::vector<std::uint64_t> dirty;
+        for (const auto &[key, idx] : m_index) {
+            if (m_entries[idx].dirty) {
+                dirty.push_back(key);
+            }
+        }
+        // Ordered by the hardware partition and the sector, so that consecutive sectors go in a single write
+        std::sort(std::begin(dirty), std::end(dirty), [](auto a, auto b) {
+            return std::make_pair(a & 0xFF, a >> 8) < std::make_pair(b & 0xFF, b >> 8);
+        });
+        int ret{};
+        for (std::size_t first = 0; first < dirty.size();) {
+            const auto hwpart = hwpart_t(dirty[first] & 0xFF);
+            const auto lba    = sector_t(dirty[first] >> 8);
+            std::size_t count = 1;
+            while (first + count < dirty.size() && count < m_max_run &&
+                   dirty[first + count] == key(lba + count, hwpart)) {
+                ++count;
+            }
+            const auto err = write_run(lba, count, hwpart);
+            if (err) {
+                ret = err;
+            }
+            first += count;
+        }
+        return ret;
+    }
+
+    auto disk_cache::fetch_count(sector_t lba, std::size_t misses, bool sequential, hwpart_t hwpart) const
+        -> std::size_t
+    {
+        if (!sequential || misses >= m_max_run) {
+            return misses;
+        }
+        const auto sectors = m_disk->get_info(info_type::sector_count, hwpart);
+        if (sectors <= 0) {
+            return misses;
+        }
+        auto fetch      = misses;
+        const auto last = std::min<std::size_t>(m_max_run, misses + read_ahead_sectors);
+        while (fetch < last && lba + fetch < sector_t(sectors) && find(lba + fetch, hwpart) == npos &&
+               !is_in_flight(lba + fetch, 1, hwpart)) {
+            ++fetch;
+        }
+        return fetch;
+    }
+
+    auto disk_cache::is_in_flight(sector_t lba, std::size_t count, hwpart_t hwpart) const -> bool
+    {
+        cpp_freertos::LockGuard _lck(*m_in_flight_lock);
+        return std::any_of(std::begin(m_in_flight), std::end(m_in_flight), [&](const auto &range) {
+            return range.hwpart == hwpart && range.lba < lba + count && lba < range.lba + range.count;
+        });
+    }
+
+    auto disk_cache::start_in_flight(const io_request &req) -> std::uint32_t
+    {
+        cpp_freertos::LockGuard _lck(*m_in_flight_lock);
+        const auto request = ++m_last_request;
+        for (const auto &vec : req.vecs) {
+            m_in_flight.push_back({request, vec.lba, vec.count, req.hwpart});
+        }
+        return request;
+    }
+
+    auto disk_cache::end_in_flight(std::uint32_t request) -> void
+    {
+        cpp_freertos::LockGuard _lck(*m_in_flight_lock);
+        m_in_flight.erase(std::remove_if(std::begin(m_in_flight),
+                                         std::end(m_in_flight),
+                                         [request](const auto &range) { return range.request == request; }),
+                          std::end(m_in_flight));
+    }
+
+    auto disk_cache::read_run(std::uint8_t *buf, sector_t lba, std::size_t count, sector_t req_end, hwpart_t hwpart)
+        -> int
+    {
+        // Room is made before reading, as writing back evicted sectors uses the same scratch buffer
+        auto err = reserve(count);
+        if (err) {
+            return err;
+        }
+        err = m_disk->read(m_scratch.get(), lba, count, hwpart);
+        if (err) {
+            return err;
+        }
+        for (std::size_t sect = 0; sect < count; ++sect) {
+            const auto data = m_scratch.get() + sect * m_sector_size;
+            if (lba + sect < req_end) {
+                std::memcpy(buf + sect * m_sector_size, data, m_sector_size);
+            }
+            std::memcpy(sector_data(insert(lba + sect, hwpart)), data, m_sector_size);
+        }
+        return 0;
+    }
+} // namespace purefs::blkdev::internal
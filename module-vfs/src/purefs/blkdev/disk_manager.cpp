@@ -9,10 +9,9 @@
 #include <charconv>
 #include <tuple>
 #include <purefs/blkdev/disk_handle.hpp>
+#include <purefs/blkdev/disk_cache.hpp>
 #include <purefs/blkdev/partition_parser.hpp>
 
-/** NOTE: Device manager implementation without sector cache
- */
 namespace purefs::blkdev
 {
     namespace
@@ -41,6 +40,9 @@ namespace purefs::blkdev
             return -EEXIST;
         }
         else {
+            if (!(flags & flags::no_sector_cache)) {
+                disk = std::make_shared<internal::disk_cache>(disk);
+            }
             auto ret = disk->probe(flags);
             if (ret < 0) {
                 LOG_ERROR("Unable to probe the disc errno %i", ret);
@@ -193,6 +195,74 @@ namespace purefs::blkdev
             return disk->read(buf, calc_lba, count, dfd->system_partition());
         }
     }
+    auto disk_manager::part_vecs_to_disk_vecs(disk_fd disk, std::vector<io_vec> &vecs) -> int
+    {
+        for (auto &vec : vecs) {
+            const auto calc_lba = part_lba_to_disk_lba(disk, vec.lba, vec.count);
+            if (calc_lba < 0) {
+                return calc_lba;
+            }
+            vec.lba = calc_lba;
+        }
+        return 0;
+    }
+    auto disk_manager::readv(disk_fd dfd, std::vector<io_vec> vecs) -> int
+    {
+        if (!dfd) {
+            LOG_ERROR("Disk handle doesn't exists");
+            return -EINVAL;
+        }
+        auto disk = dfd->disk();
+        if (!disk) {
+            LOG_ERROR("Disk doesn't exists");
+            return -ENOENT;
+        }
+        const auto err = part_vecs_to_disk_vecs(dfd, vecs);
+        if (err) {
+            return err;
+        }
+        else {
+            return disk->readv(vecs, dfd->system_partition());
+        }
+    }
+    auto disk_manager::writev(disk_fd dfd, std::vector<io_vec> vecs) -> int
+    {
+        if (!dfd) {
+            LOG_ERROR("Disk handle doesn't exists");
+            return -EINVAL;
+        }
+        auto disk = dfd->disk();
+        if (!disk) {
+            LOG_ERROR("Disk doesn't exists");
+            return -ENOENT;
+        }
+        const auto err = part_vecs_to_disk_vecs(dfd, vecs);
+        if (err) {
+            return err;
+        }
+        else {
+            return disk->writev(vecs, dfd->system_partition());
+        }
+    }
+    auto disk_manager::submit(disk_fd dfd, io_op op, std::vector<io_vec> vecs, io_completion on_complete) -> int
+    {
+        if (!dfd) {
+            LOG_ERROR("Disk handle doesn't exists");
+            return -EINVAL;
+        }
+        auto disk = dfd->disk();
+        if (!disk) {
+            LOG_ERROR("Disk doesn't exists");
+            return -ENOENT;
+        }
+        const auto err = part_vecs_to_disk_vecs(dfd, vecs);
+        if (err) {
+            return err;
+        }
+        else {
+            return disk->submit({op, std::move(vecs), dfd->system_partition(), std::move(on_complete)});
+        }
+    }
     auto disk_manager::erase(disk_fd dfd, sector_t lba, std::size_t count) -> int
     {
         if (!dfd) {
@@ -388,6 +458,33 @@ namespace purefs::blkdev
         else
             return -ENOENT;
     }
+    auto disk_manager::readv(std::string_view device_name, std::vector<io_vec> vecs) -> int
+    {
+        auto dfd = device_handle(device_name);
+        if (dfd)
+            return readv(dfd, std::move(vecs));
+        else
+            return -ENOENT;
+    }
+    auto disk_manager::writev(std::string_view device_name, std::vector<io_vec> vecs) -> int
+    {
+        auto dfd = device_handle(device_name);
+        if (dfd)
+            return writev(dfd, std::move(vecs));
+        else
+            return -ENOENT;
+    }
+    auto disk_manager::submit(std::string_view device_name,
+                              io_op op,
+                              std::vector<io_vec> vecs,
+                              io_completion on_complete) -> int
+    {
+        auto dfd = device_handle(device_name);
+        if (dfd)
+            return submit(dfd, op, std::move(vecs), std::move(on_complete));
+        else
+            return -ENOENT;
+    }
     auto disk_manager::erase(std::string_view device_name, sector_t lba, std::size_t count) -> int
     {
         auto dfd = device_handle(device_name);
@@ -0,0 +1,25 @@
+// Copyright (c) 2017-2021, Mudita Sp. z.o.o. All rights reserved.
+// For licensing, see https://github.com/mudita/MuditaOS/LICENSE.md
+
+#include <purefs/fs/file_handle.hpp>
+#include <mutex.hpp>
+
+namespace purefs::fs::internal
+{
+    file_handle::file_handle(std::shared_ptr<mount_point> mp, unsigned flags)
+        : m_mount_point(mp), m_flags(flags), m_lock(std::make_unique<cpp_freertos::MutexRecursive>())
+    {}
+
+    file_handle::~file_handle()
+    {}
+
+    auto file_handle::lock() const noexcept -> void
+    {
+        m_lock->Lock();
+    }
+
+    auto file_handle::unlock() const noexcept -> void
+    {
+        m_lock->Unlock();
+    }
+} // namespace purefs::fs::internal
@@ -3,15 +3,16 @@
 #include <purefs/fs/filesystem.hpp>
 #include <purefs/fs/filesystem_operations.hpp>
 #include <purefs/fs/mount_point.hpp>
+#include <purefs/fs/mount_trie.hpp>
 #include <purefs/blkdev/disk_manager.hpp>
 #include <purefs/fs/thread_local_cwd.hpp>
 #include <purefs/blkdev/disk_handle.hpp>
 #include <purefs/fs/notifier.hpp>
 #include <purefs/fs/fsnotify.hpp>
 #include <log/log.hpp>
-#include <split_sv.hpp>
 #include <errno.h>
 #include <mutex.hpp>
+#include <algorithm>
 
 namespace purefs::fs
 {
@@ -32,7 +33,32 @@ namespace purefs::fs
             }
             return spath1 == spath2;
         }
-    }
+
+        //! Absolute path without empty, "." and ".." components nor trailing separator
+        auto is_canonical_path(std::string_view path) noexcept
+        {
+            if (path.empty() || path[0] != '/') {
+                return false;
+            }
+            if (path.size() == 1) {
+                return true;
+            }
+            std::size_t comp_len{};
+            for (std::size_t pos = 1; pos <= path.size(); ++pos) {
+                if (pos == path.size() || path[pos] == '/') {
+                    const auto comp = path.substr(pos - comp_len, comp_len);
+                    if (comp.empty() || comp == "." || comp == "..") {
+                        return false;
+                    }
+                    comp_len = 0;
+                }
+                else {
+                    ++comp_len;
+                }
+            }
+            return true;
+        }
+    } // namespace
     filesystem::filesystem(std::shared_ptr<blkdev::disk_manager> diskmm)
         : m_diskmm(diskmm), m_lock(std::make_unique<cpp_freertos::MutexRecursive>()),
           m_notifier(std::make_unique<internal::notifier>())
@@ -41,6 +67,20 @@ namespace purefs::fs
     filesystem::~filesystem()
     {}
 
+    auto filesystem::publish_mount_points() -> void
+    {
+        auto trie = std::make_unique<const internal::mount_trie>(m_mounts);
+        m_mount_trie.store(trie.get());
+        if (m_mount_trie_owner) {
+            m_mount_trie_retired.push_back(std::move(m_mount_trie_owner));
+        }
+        m_mount_trie_owner = std::move(trie);
+        // Lookups started from now on see the new tree only
+        if (m_mount_trie_readers.load() == 0) {
+            m_mount_trie_retired.clear();
+        }
+    }
+
     auto filesystem::register_filesystem(std::string_view fsname, std::shared_ptr<filesystem_operations> fops) -> int
     {
         if (fops == nullptr) {
@@ -147,6 +187,7 @@ namespace purefs::fs
                 if (!ret_mnt) {
                     m_mounts.emplace(std::make_pair(target, mnt_point));
                     m_partitions.emplace(dev_or_part);
+                    publish_mount_points();
                 }
                 else {
                     return ret_mnt;
@@ -184,6 +225,7 @@ namespace purefs::fs
             m_partitions.erase(std::string(diskh->name()));
         }
         m_mounts.erase(mnti);
+        publish_mount_points();
         return {};
     }
 
@@ -199,23 +241,11 @@ namespace purefs::fs
     auto filesystem::find_mount_point(std::string_view path) const noexcept
         -> std::tuple<std::shared_ptr<internal::mount_point>, size_t>
     {
-        size_t longest_match{};
-        std::shared_ptr<internal::mount_point> mount_pnt;
-        cpp_freertos::LockGuard _lck(*m_lock);
-        for (const auto &mntp : m_mounts) {
-            const auto slen = mntp.first.size();
-            if ((slen < longest_match) || (slen > path.size())) {
-                continue;
-            }
-            if ((slen > 1) && (path[slen] != '/') && (path[slen] != '\0')) {
-                continue;
-            }
-            if (path.compare(0, slen, mntp.first) == 0) {
-                mount_pnt     = mntp.second;
-                longest_match = slen;
-            }
-        }
-        return std::make_tuple(mount_pnt, longest_match);
+        m_mount_trie_readers.fetch_add(1);
+        const auto trie = m_mount_trie.load();
+        auto ret = trie ? trie->find(path) : std::make_tuple(std::shared_ptr<internal::mount_point>(), size_t(0));
+        m_mount_trie_readers.fetch_sub(1);
+        return ret;
     }
 
     auto filesystem::absolute_path(std::string_view path) noexcept -> std::string
@@ -227,76 +257,70 @@ namespace purefs::fs
         else {
             ret.append(internal::get_thread_local_cwd_path()).append("/").append(path);
         }
-        return normalize_path(ret);
+        normalize_path_in_place(ret);
+        return ret;
     }
 
     auto filesystem::normalize_path(std::string_view path) noexcept -> std::string
     {
-        std::string ret;
-        auto paths = utils::split<std::list, std::string_view>(path, "/");
-        for (auto it = std::begin(paths); it != std::end(paths);) {
-            if (!it->compare(".")) {
-                it = paths.erase(it);
+        std::string ret{path};
+        normalize_path_in_place(ret);
+        return ret;
+    }
+
+    auto filesystem::normalize_path_in_place(std::string &path) noexcept -> void
+    {
+        if (is_canonical_path(path)) {
+            return;
+        }
+        if (path.empty() || path[0] != '/') {
+            path.insert(0, 1, '/');
+        }
+        // Components are compacted towards the front, the output never overtakes the input
+        std::size_t out{};
+        for (std::size_t pos = 1; pos <= path.size();) {
+            const auto end = std::min(path.find('/', pos), path.size());
+            const auto len = end - pos;
+            if (len == 0 || (len == 1 && path[pos] == '.')) {
+                // Empty or current directory component
             }
-            else if (!it->compare("..")) {
-                auto pit = it;
-                --pit;
-                if (pit != std::end(paths)) {
-                    it = paths.erase(pit);
-                    if (it != std::end(paths))
-                        it = paths.erase(it);
-                }
-                else {
-                    it = paths.erase(it);
+            else if (len == 2 && path[pos] == '.' && path[pos + 1] == '.') {
+                if (out > 0) {
+                    out = path.rfind('/', out - 1);
                 }
             }
             else {
-                ++it;
+                path[out++] = '/';
+                std::copy(std::begin(path) + pos, std::begin(path) + end, std::begin(path) + out);
+                out += len;
             }
+            pos = end + 1;
         }
-        for (auto ep : paths) {
-            if (!ep.empty()) {
-                ret.append("/").append(ep);
-            }
+        if (out == 0) {
+            path[out++] = '/';
         }
-        if (ret.empty())
-            ret.append("/");
-        return ret;
+        path.resize(out);
     }
 
     auto filesystem::add_filehandle(fsfile file) noexcept -> int
     {
-        cpp_freertos::LockGuard _lck(*m_lock);
         return m_fds.insert(file) + first_file_descriptor;
     }
 
-    auto filesystem::remove_filehandle(int fds) noexcept -> fsfile
+    auto filesystem::remove_filehandle(int fds, const fsfile &file) noexcept -> bool
     {
         if (fds < first_file_descriptor) {
-            return nullptr;
-        }
-        fds -= first_file_descriptor;
-        cpp_freertos::LockGuard _lck(*m_lock);
-        fsfile ret{};
-        if (m_fds.exists(fds)) {
-            ret = m_fds[fds];
-            m_fds.remove(fds);
+            return false;
         }
-        return ret;
+        return m_fds.remove(fds - first_file_descriptor, file);
     }
 
     auto filesystem::find_filehandle(int fds) const noexcept -> fsfile
     {
-        fsfile ret{};
         if (fds < first_file_descriptor) {
-            return ret;
-        }
-        fds -= first_file_descriptor;
-        cpp_freertos::LockGuard _lck(*m_lock);
-        if (m_fds.exists(fds)) {
-            ret = m_fds[fds];
+            return nullptr;
         }
-        return ret;
+        return m_fds.find(fds - first_file_descriptor);
     }
 
     auto filesystem::autodetect_filesystem_type(std::string_view dev_or_part) const noexcept -> std::string
@@ -334,15 +358,16 @@ namespace purefs::fs
     auto filesystem::cleanup_opened_files(std::string_view mount_point) -> void
     {
         LOG_INFO("Closing opened files on mntpoint: %s before umount.", std::string(mount_point).c_str());
-        for (auto fd = 0U; fd < m_fds.size(); ++fd) {
-            const auto filp = m_fds[fd];
+        const auto files = m_fds.snapshot();
+        for (auto fd = 0U; fd < files.size(); ++fd) {
+            const auto &filp = files[fd];
             if (!filp)
                 continue;
             const auto mp = filp->mntpoint();
             if (!mp)
                 continue;
             if (compare_mount_points(mp->mount_path(), mount_point)) {
-                const auto err = close(fd + first_file_descriptor);
+                const auto err = close_handle(filp, fd + first_file_descriptor);
                 LOG_WARN("Emergency closing: %s result: %i.", filp->open_path().c_str(), err);
             }
         }
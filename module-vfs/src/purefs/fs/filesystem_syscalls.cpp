@@ -184,9 +184,32 @@ namespace purefs::fs
 
     auto filesystem::close(int fd) noexcept -> int
     {
-        auto ret = invoke_fops(&filesystem_operations::close, fd);
+        auto fil = find_filehandle(fd);
+        if (!fil) {
+            return -EBADF;
+        }
+        return close_handle(fil, fd);
+    }
+
+    auto filesystem::close_handle(fsfile fil, int fd) noexcept -> int
+    {
+        // Operations in progress on the file are finished before it is closed
+        internal::file_locker _lck(*fil);
+        if (fil->is_closed()) {
+            return -EBADF;
+        }
+        auto mp = fil->mntpoint();
+        if (!mp) {
+            return -ENOENT;
+        }
+        auto fsops = mp->fs_ops();
+        if (!fsops) {
+            return -EIO;
+        }
+        auto ret = fsops->close(fil);
         if (!ret) {
-            ret = (remove_filehandle(fd)) ? (0) : (-EBADF);
+            fil->mark_closed();
+            ret = (remove_filehandle(fd, fil)) ? (0) : (-EBADF);
             m_notifier->notify_close(fd);
         }
         return ret;
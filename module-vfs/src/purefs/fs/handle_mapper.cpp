@@ -0,0 +1,24 @@
+// Copyright (c) 2017-2021, Mudita Sp. z.o.o. All rights reserved.
+// For licensing, see https://github.com/mudita/MuditaOS/LICENSE.md
+
+#include <purefs/fs/handle_mapper.hpp>
+#include <mutex.hpp>
+
+namespace purefs::fs::internal
+{
+    handle_mapper_lock::handle_mapper_lock() : m_lock(std::make_unique<cpp_freertos::MutexStandard>())
+    {}
+
+    handle_mapper_lock::~handle_mapper_lock()
+    {}
+
+    auto handle_mapper_lock::lock() const noexcept -> void
+    {
+        m_lock->Lock();
+    }
+
+    auto handle_mapper_lock::unlock() const noexcept -> void
+    {
+        m_lock->Unlock();
+    }
+} // namespace purefs::fs::internal
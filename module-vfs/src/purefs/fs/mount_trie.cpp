@@ -0,0 +1,70 @@
+// Copyright (c) 2017-2021, Mudita Sp. z.o.o. All rights reserved.
+// For licensing, see https://github.com/mudita/MuditaOS/LICENSE.md
+
+#include <purefs/fs/mount_trie.hpp>
+#include <purefs/fs/mount_point.hpp>
+#include <algorithm>
+
+namespace purefs::fs::internal
+{
+    namespace
+    {
+        //! Next non empty path component starting at the pos, which is moved past it
+        auto next_component(std::string_view path, std::size_t &pos) noexcept -> std::string_view
+        {
+            while (pos < path.size() && path[pos] == '/') {
+                ++pos;
+            }
+            const auto start = pos;
+            pos              = std::min(path.find('/', start), path.size());
+            return path.substr(start, pos - start);
+        }
+    } // namespace
+
+    mount_trie::mount_trie(const mount_map &mounts)
+    {
+        for (const auto &[path, mount] : mounts) {
+            auto node = &m_root;
+            for (std::size_t pos{}; pos < path.size();) {
+                const auto name = next_component(path, pos);
+                if (name.empty()) {
+                    break;
+                }
+                auto child = std::find_if(
+                    std::begin(node->children), std::end(node->children), [name](auto &c) { return c.name == name; });
+                if (child == std::end(node->children)) {
+                    node->children.push_back({std::string(name), nullptr, 0, {}});
+                    child = std::prev(std::end(node->children));
+                }
+                node = &*child;
+            }
+            node->mount    = mount;
+            node->path_len = path.size();
+        }
+    }
+
+    auto mount_trie::find(std::string_view path) const noexcept -> std::tuple<std::shared_ptr<mount_point>, size_t>
+    {
+        auto best = m_root.mount ? &m_root : nullptr;
+        auto node = &m_root;
+        for (std::size_t pos{}; pos < path.size();) {
+            const auto name = next_component(path, pos);
+            if (name.empty()) {
+                break;
+            }
+            const auto child = std::find_if(
+                std::begin(node->children), std::end(node->children), [name](auto &c) { return c.name == name; });
+            if (child == std::end(node->children)) {
+                break;
+            }
+            node = &*child;
+            if (node->mount) {
+                best = node;
+            }
+        }
+        if (!best) {
+            return std::make_tuple(nullptr, 0);
+        }
+        return std::make_tuple(best->mount, best->path_len);
+    }
+} // namespace purefs::fs::internal
@@ -31,6 +31,8 @@ namespace purefs::subsystem
         constexpr auto block_size_max_shift     = 21;
         constexpr auto block_size_min_shift     = 8;
         constexpr uint32_t nvrom_lfs_block_size = 128U;
+        // Caches of the user partition, larger than the default for the small files read on boot
+        constexpr uint32_t user_lfs_cache_size = 8U * 1024U;
         namespace json
         {
             constexpr auto os_type = "ostype";
@@ -209,14 +211,12 @@ namespace purefs::subsystem
         }
         if (user_part.type == lfs_part_code) {
             const int lfs_block_log2 = read_mbr_lfs_erase_size(disk, default_blkdev_name, user_part.physical_number);
-            uint32_t lfs_block_size  = 0;
-            uint32_t *lfs_block_size_ptr = nullptr;
+            fs::drivers::littlefs_params lfs_params{};
+            lfs_params.cache_size = user_lfs_cache_size;
             if (lfs_block_log2 >= block_size_min_shift && lfs_block_log2 <= block_size_max_shift) {
-                lfs_block_size     = 1U << lfs_block_log2;
-                lfs_block_size_ptr = &lfs_block_size;
+                lfs_params.block_size = 1U << lfs_block_log2;
             }
-            err =
-                vfs->mount(user_part.name, purefs::dir::getUserDiskPath().string(), "littlefs", 0, lfs_block_size_ptr);
+            err = vfs->mount(user_part.name, purefs::dir::getUserDiskPath().string(), "littlefs", 0, &lfs_params);
         }
         else {
             err = vfs->mount(user_part.name, purefs::dir::getUserDiskPath().string(), "ext4");
@@ -227,11 +227,14 @@ namespace purefs::subsystem
         fs::internal::set_default_thread_cwd(user_dir);
 
         // Mount NVRAM memory
+        fs::drivers::littlefs_params nvrom_lfs_params{};
+        nvrom_lfs_params.block_size = nvrom_lfs_block_size;
+
         err = vfs->mount(default_nvrom_name,
                          purefs::dir::getMfgConfPath().c_str(),
                          "littlefs",
                          fs::mount_flags::read_only,
-                         &nvrom_lfs_block_size);
+                         &nvrom_lfs_params);
         if (err) {
             LOG_WARN("Unable to mount NVROM partition err %i. Possible: NVROM unavailable", err);
             err = 0;
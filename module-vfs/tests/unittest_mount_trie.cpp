@@ -0,0 +1,75 @@
+// Copyright (c) 2017-2021, Mudita Sp. z.o.o. All rights reserved.
+// For licensing, see https://github.com/mudita/MuditaOS/LICENSE.md
+#define CATCH_CONFIG_MAIN
+#include <catch2/catch.hpp>
+#include <purefs/fs/mount_trie.hpp>
+#include <purefs/fs/mount_point.hpp>
+
+namespace
+{
+    struct mount_point_mock final : public purefs::fs::internal::mount_point
+    {
+        explicit mount_point_mock(std::string_view path) : mount_point(nullptr, path, 0, nullptr)
+        {}
+
+      private:
+        auto native_root() const noexcept -> std::string override
+        {
+            return {};
+        }
+    };
+
+    auto make_mounts(std::initializer_list<std::string_view> paths)
+    {
+        purefs::fs::internal::mount_trie::mount_map mounts;
+        for (const auto path : paths) {
+            mounts.emplace(path, std::make_shared<mount_point_mock>(path));
+        }
+        return mounts;
+    }
+
+    auto find_path(const purefs::fs::internal::mount_trie &trie, std::string_view path)
+        -> std::tuple<std::string, size_t>
+    {
+        const auto [mnt, len] = trie.find(path);
+        return std::make_tuple(mnt ? mnt->mount_path() : std::string{}, len);
+    }
+} // namespace
+
+TEST_CASE("Mount trie lookup")
+{
+    using purefs::fs::internal::mount_trie;
+    using result = std::tuple<std::string, size_t>;
+
+    SECTION("No mount points")
+    {
+        const mount_trie trie;
+        REQUIRE(find_path(trie, "/sys/user") == result{"", 0});
+    }
+
+    SECTION("Longest mount point containing the path is found")
+    {
+        const mount_trie trie(make_mounts({"/sys", "/sys/user", "/mnt"}));
+        REQUIRE(find_path(trie, "/sys") == result{"/sys", 4});
+        REQUIRE(find_path(trie, "/sys/current/file.txt") == result{"/sys", 4});
+        REQUIRE(find_path(trie, "/sys/user") == result{"/sys/user", 9});
+        REQUIRE(find_path(trie, "/sys/user/music/a.mp3") == result{"/sys/user", 9});
+        REQUIRE(find_path(trie, "/mnt/x") == result{"/mnt", 4});
+    }
+
+    SECTION("Only whole path components match")
+    {
+        const mount_trie trie(make_mounts({"/sys", "/sys/user"}));
+        REQUIRE(find_path(trie, "/system") == result{"", 0});
+        REQUIRE(find_path(trie, "/sys/username") == result{"/sys", 4});
+        REQUIRE(find_path(trie, "/") == result{"", 0});
+    }
+
+    SECTION("Root mount point contains every path")
+    {
+        const mount_trie trie(make_mounts({"/", "/sys"}));
+        REQUIRE(find_path(trie, "/") == result{"/", 1});
+        REQUIRE(find_path(trie, "/other/file") == result{"/", 1});
+        REQUIRE(find_path(trie, "/sys/file") == result{"/sys", 4});
+    }
+}